@@ -19,16 +19,29 @@
  *    - ramp up and dowm of LED intensity
  *    - the 3 PWM are new driven by an ISR rourine to ensure ramp up and down responsivness.
  *    - added a 1s watchdog to reset the program.
+ *    - overlapping frames (streaming mode): a new frequency every hopSize samples.
+ *    - the fundamental is tracked from frame to frame.
+ *    - the ADC is triggered by a timer and its DMA fills blocks of samples:
+ *      no interrupt per sample, no sampling jitter.
+ *    - results go out as binary telemetry records (pitch, peaks, frames, spectra),
+ *      from a queue that never blocks the loop (extras/telemetry_decode.py reads them).
+ *    - the signal lives in static storage (static_signal.h): no heap, and the
+ *      search band is checked at compile time.
+ *    - a gate (gate.h) skips the frames in silence and restarts the pitch
+ *      tracking on every new note (spectral flux onset).
+ *    - the strobe (strobe.h) never stops: frequency and duty change at period
+ *      boundaries, the frequency glides to the pitch with sub-count precision.
  */
 
 #include <spectrum.h>
+#include <static_signal.h>
 #include <peak.h>
 #include <peak_list.h>
-#include <pwm_lib.h>      // Copyright (C) 2015,2016 Antonio C. Domínguez Brito (<adominguez@iusiani.ulpgc.es>). 
-                          // División de Robótica y Oceanografía Computacional (<http://www.roc.siani.es>) and 
-                          // Departamento de Informática y Sistemas (<http://www.dis.ulpgc.es>). 
-                          // Universidad de Las Palmas de Gran  Canaria (ULPGC) (<http://www.ulpgc.es>).
-                          // GNU General Public License (GPL) license.
+#include <acquisition.h>
+#include <gate.h>
+#include <profile.h>
+#include <telemetry.h>
+#include <strobe.h>
                           
 #include <DueTimer.h>     // https://github.com/ivanseidel/DueTimer, 
                           // MIT License
@@ -46,7 +59,6 @@
 /*
  * PMW for LED RGB output
  */
-#define PWM_MULTIPLIER    100000000    // hundredths of microseconds (1e-8 seconds)
 #define MAX_DUTY          0.5          // Max duty cycle in % (max LED intensity)
 #define RAMP_UP_TIME      2.0          // seconds from no LED intensity to max intensity 
 #define RAMP_DN_TIME      4.0          // seconds from max LED intensity to no intensity
@@ -74,6 +86,23 @@
  */
 #define FREQUENCY_OFFSET  1.0 
 
+/*
+ * Stage profiling: set PROFILING to 1 to time the pipeline's stages and
+ * print their statistics every PROFILE_DUMP_FRAMES frames
+ */
+#define PROFILING            0
+#define PROFILE_DUMP_FRAMES  100
+
+/*
+ * Telemetry: every frame sends its pitch and peak list.  Every DUMP_FRAMES
+ * frames, the time domain frame and its spectrum are sent too (0: never).
+ * A 1024 point frame or spectrum takes about 2 KB: at 115200 baud, a dump
+ * every 20 frames or more keeps up (records that do not fit are dropped).
+ */
+#define SERIAL_SPEED         115200
+#define TELEMETRY_SIZE       8192   // transmit queue (bytes)
+#define DUMP_FRAMES          0
+
 /*
  *  Three green leds form a 'vu meter' to show audio signal strength
  *  One led indicates signal clipping
@@ -97,7 +126,7 @@
  * We use a 4000 Hz sampling frequency. This is mare than 4 times greater that 
  * the analog signal frequency.
  */
-const double samplingFrequency = 4000.0; // in Hz, must be less than 10000 Hz
+constexpr double samplingFrequency = 4000.0; // in Hz, must be less than 10000 Hz
 
 /*
  * With a sampling frequency of 4000 Hz and a sample number of 1024, the minimum
@@ -106,36 +135,49 @@ const double samplingFrequency = 4000.0; // in Hz, must be less than 10000 Hz
  */
 const int signalLength = 1024;
 
+/*
+ * The signal is processed every hopSize new samples, over the latest 
+ * signalLength samples (75% overlap).  A new frequency is available every
+ * 64 ms instead of every 256 ms, with the same frequency resolution.
+ */
+const int hopSize = 256;
+
+/*
+ * The ADC's DMA fills blocks of hopSize samples, in a ring of blockNumber 
+ * blocks.  If processing takes longer than a hop, the following frames are
+ * processed late, not skipped (up to blockNumber - 2 hops).
+ */
+const int blockNumber = 6;
+
 /*
  * Signal processing variables
- * Two channels are required.
- * One channel is acquired via a timer interrupt handler 
- * while the other channel is processed in the main loop
+ * The ADC's DMA fills the acquisition's blocks, the main loop moves them 
+ * to the signal's ring buffer one hop at a time and processes the latest 
+ * frame.  The blocks need no critical zone.
  * 
- * Special care must be taken with variables that are shared between
+ * Special care must be taken with other variables that are shared between
  * the interrupt handler and the main loop.  Reads and writes from and to 
  * these variables must be placed in a 'critical zone' (by disabling 
  * interrupts)
  */
 
-signal_t* sig[2];
-volatile int acquisition_channel = 0;
-volatile int processing_channel = 1;
+Signal<signalLength, (unsigned long) samplingFrequency, ZeroPad::On> sig;
+static_assert(decltype(sig)::is_searchable(MIN_FREQUENCY, MAX_FREQUENCY), "search band out of the spectrum");
+acquisition_t* acquisition;
+gate_t* gate;
+telemetry_t* telemetry;
 volatile int npeaks = 0;
 volatile double frequency;
 
 /*
- * PWM objects to drive RGB LEDs
+ * Strobe driving the RGB LEDs (PWM channels 0 to 2 on pins 35, 37 and 39)
  */
-using namespace arduino_due::pwm_lib;
-pwm<pwm_pin::PWMH0_PC3> pwm_red;   //pwm_pin35;
-pwm<pwm_pin::PWMH1_PC5> pwm_green; //pwm_pin37;
-pwm<pwm_pin::PWMH2_PC7> pwm_blue;  //pwm_pin39;
+strobe_t* strobe;
 
 /*
  * Alpha filter IIR tap
  */
-volatile double smooth = 0.0;
+double smooth = 0.0;
 
 /* for debugging
 char ttt[3][100];
@@ -182,22 +224,6 @@ void WDT_Handler(void)  {
 }
 
 
-/*
- * Data acquistion interrupt handler
- */
-void acquisition_handler(void) {
-  
-  int sample;
-
-  noInterrupts();
-  
-  sample = analogRead(CHANNEL);
-  add_sample(sig[acquisition_channel], sample);
-  smooth = smooth * (1.0 - ALPHA) + abs(sample-512) * ALPHA;
-
-  interrupts();
-}
-
 /*
  * LED display interrupt handler
  */
@@ -210,8 +236,9 @@ void led_display_handler(void) {
  */
 void setup()
 {
-  Serial.begin(9600);
-  Serial.println("AutoStrobe2\n");
+  Serial.begin(SERIAL_SPEED);
+  telemetry = create_telemetry(TELEMETRY_SIZE, serialWrite, NULL);
+  send_text(telemetry, "AutoStrobe2");
 
   pinMode(LED_BUILTIN, OUTPUT); digitalWrite(LED_BUILTIN, 0);
   pinMode(VU_PIN_1, OUTPUT);    digitalWrite(VU_PIN_1, 0);
@@ -219,26 +246,28 @@ void setup()
   pinMode(VU_PIN_3, OUTPUT);    digitalWrite(VU_PIN_3, 0);
   pinMode(VU_CLIP,  OUTPUT);    digitalWrite(VU_CLIP,  0);
 
-  // create 2 signal channels 
-  sig[0] = create_signal(signalLength, samplingFrequency, ZERO_PADDING_ENABLED);  
-  sig[1] = create_signal(signalLength, samplingFrequency, ZERO_PADDING_ENABLED);  
+  // samples go to the signal's ring buffer, from its acquisition
+  enable_streaming(sig, hopSize);
+  acquisition = create_acquisition(&due_adc_backend, NULL, CHANNEL, samplingFrequency, 
+                                   hopSize, blockNumber);
+  enable_tracking(get_peak_list(sig), 1);     // steadier pitch, narrower peak search
+  gate = create_gate(10);                      // same 10 bit scale as the signal
 
-  // stop RBG PWM
-  led_stop();
+  // start the RGB strobe, dark (uses PWM channels 0 to 2 and the PWM interrupt)
+  strobe = create_strobe(&due_pwm_backend, NULL);
+  start_strobe(strobe, MIN_FREQUENCY + FREQUENCY_OFFSET);
 
-  // start signal acquisition
-  Timer0.attachInterrupt(acquisition_handler);
-  Timer0.setFrequency(samplingFrequency); 
-  // data_acquisition handler must have a higher priority than led display handler
-  // otherwise data_acquisition rate is not stable.
-  NVIC_SetPriority(TC0_IRQn, 0);         
-  Timer0.start();
+  // start signal acquisition (uses TC0 channel 0, DueTimer's Timer0)
+  // the ADC interrupt (once per block) has a higher priority than led display handler
+  start_acquisition(acquisition);
 
   Timer3.attachInterrupt(led_display_handler);
   Timer3.setPeriod(UPDATE_INTERVAL * 1000);
   NVIC_SetPriority(TC3_IRQn, 1);
   Timer3.start();
 
+  enable_profiling(PROFILING);
+
   enableWatchdog(WATCHDOG_DELAY);
 }
 
@@ -250,51 +279,72 @@ void loop()
   peak_list_t* peak_list;
   peak_t fundamental;
   
-  volatile int is_full;
-  volatile int smooth_safe;
+  const uint16_t* block;
+  static int profiledFrames = 0;
+  static int dumpedFrames = 0;
 
-  // get data acquisition status
-  noInterrupts();   // enter critical zone
-  
-    is_full = is_buffer_full(sig[acquisition_channel]);
-    smooth_safe = smooth;
-    
-  interrupts();     // exit critical zone
-
-  // update vu meter display 
-  display_vu_meter(smooth_safe);
+  // hand queued telemetry to the serial port, as much as it takes
+  service_telemetry(telemetry);
 
-  // ensure that data acquisition has completed
-  if (!is_full) {
+  // move the next block to the signal
+  block = get_block(acquisition);
+  if (block == NULL) {
     return;
   }
+  profile_begin(PROFILE_ACQUIRE);
+  for (int i = 0; i < hopSize; i++) {
+    int sample = block[i] >> 2;   // 12 bit ADC value, on analogRead()'s 10 bit scale
+    add_sample(sig, sample);
+    add_gate_sample(gate, sample);
+    smooth = smooth * (1.0 - ALPHA) + abs(sample-512) * ALPHA;
+  }
+  release_block(acquisition);
+  profile_end(PROFILE_ACQUIRE);
 
-  /*
-   * The acquistion buffer is full.  Process the signal.
-   */
-  // First, prepare and launch data acquisition on the second channel 
-
-  noInterrupts();    // enter critical zone
+  // update vu meter display 
+  display_vu_meter(smooth);
 
-    // swap acquisition channel
-    int temp = acquisition_channel;
-    acquisition_channel = processing_channel;
-    processing_channel = temp;
+  // copy the latest frame once the signal's ring is full
+  if (!is_buffer_full(sig)) {
+    return;
+  }
 
-    // get ready for the next acquistion
-    erase_signal(sig[acquisition_channel]);
+  // a new note: its pitch may be far from the tracked one
+  if (take_onset(gate) >= 0) {
+    reset_tracking(get_peak_list(sig));
+  }
 
-  interrupts();     // exit critical zone
+  // no note: skip the frame and let the LEDs ramp down
+  if (!is_gate_open(gate)) {
+    schedule_frame(sig, hopSize);
+    noInterrupts();    // enter critical zone
+      npeaks = 0;
+    interrupts();      // exit critical zone
+    restartWatchdog();
+    return;
+  }
+  profile_begin(PROFILE_FRAME);
+  load_latest_frame(sig);
 
-  // Then, process the signal on the first channel
+  /*
+   * A new frame was loaded.  Process the signal while acquisition goes on.
+   */
 
   // compute spectrum using a FFT
-  remove_bias(sig[processing_channel]);
-  compute_spectrum(sig[processing_channel]);
+  remove_bias(sig);
+  int dump = DUMP_FRAMES > 0 && ++dumpedFrames == DUMP_FRAMES;
+  if (dump) {
+    send_frame(telemetry, sig);
+  }
+  compute_spectrum(sig);
+  if (dump) {
+    send_spectrum(telemetry, sig);
+    dumpedFrames = 0;
+  }
 
   // compute the peak list
-  compute_peak_list(sig[processing_channel], MIN_FREQUENCY, MAX_FREQUENCY);
-  peak_list = get_peak_list(sig[processing_channel]);
+  compute_peak_list(sig, MIN_FREQUENCY, MAX_FREQUENCY);
+  peak_list = get_peak_list(sig);
   fundamental = find_fundamental_frequency(peak_list);
   
   noInterrupts();    // enter critical zone
@@ -304,7 +354,17 @@ void loop()
 
   interrupts();      // exit critical zone
 
-  printFrequency(fundamental);
+  profile_begin(PROFILE_OUTPUT);
+  sendResults(fundamental, peak_list);
+  profile_end(PROFILE_OUTPUT);
+  profile_end(PROFILE_FRAME);
+
+  // print and restart the stage statistics
+  if (PROFILING && ++profiledFrames == PROFILE_DUMP_FRAMES) {
+    dump_profile(printLine);
+    reset_profile();
+    profiledFrames = 0;
+  }
 
   // flash LED_BUILTIN to show the program is running.
   digitalWrite(LED_BUILTIN, alive);
@@ -316,16 +376,14 @@ void loop()
 
 void drivePWM(int npeaks, double frequency) 
 {
-  static double last_valid_frequency;
+  static double last_valid_frequency = MIN_FREQUENCY;
   static int status = LED_OFF;
   static int ramp_up_counter;
   static int ramp_up_target;
   static int ramp_dn_counter;
   static int ramp_dn_target;
 
-  uint32_t period;
-  double precise_period;
-  uint32_t duty;
+  double duty;
 
   
   if (npeaks > 0) {
@@ -336,7 +394,7 @@ void drivePWM(int npeaks, double frequency)
   switch (status) {
 
     case LED_OFF:
-    led_stop();
+    set_strobe(strobe, last_valid_frequency + FREQUENCY_OFFSET, 0.0);
     
     if (npeaks > 0) {
       status = RAMP_UP;
@@ -346,11 +404,8 @@ void drivePWM(int npeaks, double frequency)
     break;
     
     case RAMP_UP:    
-    precise_period = PWM_MULTIPLIER / (last_valid_frequency + FREQUENCY_OFFSET); 
-    period = round(precise_period);
-    duty   = round(precise_period * MAX_DUTY * ramp_up_counter / ramp_up_target);
-    led_stop();
-    led_start(period, duty);
+    duty = MAX_DUTY * ramp_up_counter / ramp_up_target;
+    set_strobe(strobe, last_valid_frequency + FREQUENCY_OFFSET, duty);
 
     if (npeaks <= 0) {
       status = RAMP_DN;
@@ -366,11 +421,8 @@ void drivePWM(int npeaks, double frequency)
     break;
     
     case RAMP_DN:
-    precise_period = PWM_MULTIPLIER / (last_valid_frequency + FREQUENCY_OFFSET); 
-    period = round(precise_period);
-    duty   = round(precise_period * MAX_DUTY * (ramp_dn_target-ramp_dn_counter) / ramp_dn_target);
-    led_stop();
-    led_start(period, duty);
+    duty = MAX_DUTY * (ramp_dn_target-ramp_dn_counter) / ramp_dn_target;
+    set_strobe(strobe, last_valid_frequency + FREQUENCY_OFFSET, duty);
 
     if (npeaks > 0) {
       status = RAMP_UP;
@@ -386,11 +438,7 @@ void drivePWM(int npeaks, double frequency)
     break;
     
     case LED_ON:
-    precise_period = PWM_MULTIPLIER / (last_valid_frequency + FREQUENCY_OFFSET); 
-    period = round(precise_period);
-    duty   = round(precise_period * MAX_DUTY);
-    led_stop();
-    led_start(period, duty);
+    set_strobe(strobe, last_valid_frequency + FREQUENCY_OFFSET, MAX_DUTY);
     
     if (npeaks <= 0) {
       status = RAMP_DN;
@@ -401,65 +449,19 @@ void drivePWM(int npeaks, double frequency)
   }
 }
 
-void printFrequency(peak_t peak) 
-{
-  char s1[30], s2[30];
-  static int heart_beat = 0;
-  if (heart_beat) {
-    strcpy(s1, " *");
-    heart_beat = 0;
-  }
-  else {
-    strcpy(s1, "  ");
-    heart_beat = 1;
-  }
-  
-  sprintf(s2, " F = %8.2f Hz\r", peak.frequency);
-  strcat(s1, s2);
-  Serial.print(s1);
+int serialWrite(void* context, const uint8_t* data, int length) {
+  int room = Serial.availableForWrite();
+  return Serial.write(data, length < room ? length : room);
 }
 
-void printPeak(peak_t peak) 
+void sendResults(peak_t fundamental, peak_list_t* peak_list) 
 {
-  char s[200];
-  sprintf(s, "Peak: %3d, %5.1f, %7.1f", peak.index, peak.frequency, peak.power);
-  Serial.println(s);
-  /*sprintf(s, "Debug: %1d, %1d, %5.1f, %5.1f, %5.1f, %5.1f, %5.1f, %5.1f", peak.ispeak, peak.added, peak.p[0], peak.p[1], peak.p[2], peak.p[3], peak.p[4], peak.early_freq);
-  Serial.println(s);*/
-}
-
-void printd(double d) {
-  char s[100];
-  sprintf(s, "%4.2f", d);
-  Serial.println(s);
-}
-
-void printSignal(int index) {
-  char s[100];
-  double *a = get_signal_array(sig[index]);
-  int len = get_length(sig[index]);
-  for (int i = 0; i < len; i++) {
-    sprintf(s, "%4d %5.1f", i, a[i]);
-    Serial.println(s);
-  }
-}
-
-void led_start(uint32_t period, uint32_t duty) {
-  pwm_red.start(period, duty);
-  pwm_green.start(period, duty);
-  pwm_blue.start(period, duty);  
-}
-
-void led_stop() {
-  pwm_red.stop();
-  pwm_green.stop();
-  pwm_blue.stop();
+  send_pitch(telemetry, &fundamental, list_size(peak_list), get_dropped_blocks(acquisition));
+  send_peak_list(telemetry, peak_list);
 }
 
-void led_set_duty(uint32_t duty) {
-  pwm_red.set_duty(duty);
-  pwm_green.set_duty(duty);
-  pwm_blue.set_duty(duty);
+void printLine(const char* s) {
+  send_text(telemetry, s);
 }
 
 void display_vu_meter(double smooth) {
@@ -1,7 +1,11 @@
 #include <FastLED.h>
+#include <effects.h>
+#include <scheduler.h>
+#include <dither.h>
 #define DATA_PIN 14
 #define SCALE_DOWN_SHIFT 4
 #define MAX_INTENSITY (SCALE_DOWN_SHIFT==0?255:256>>SCALE_DOWN_SHIFT)
+#define FULL_INTENSITY 255
 
 #define MS_DELAY 50
 #define MS_FADE_OUT_DELAY 25
@@ -129,9 +133,57 @@ CRGB visible_colors[NUM_VISIBLE_COLORS] = {
   CRGB::Yellow,
 };
 
-unsigned long start_time;
-#define set_timer()                       start_time = millis()
-#define break_on_timer_elapsed(ms_delay)  if (millis() - start_time > ms_delay) break
+
+// ***************************************************
+//                  EFFECT ENGINE
+// ***************************************************
+
+// Effects are state machines run by the scheduler (libraries/Effects):
+// loop() never waits, the time between frames is free for serial control.
+// An effect plays until its time is up, then the next one crossfades in.
+
+#define FRAME_INTERVAL     10    // ms, 100 frames per second
+#define MS_CROSSFADE       1000
+#define MS_FADE_OUT        ((MAX_INTENSITY / 2) * MS_FADE_OUT_DELAY)
+#define MS_START_SEQUENCE  (7 * MS_START_SEQUENCE_DELAY)
+
+// The effects draw at full range into 'frame'.  The dither layer scales
+// it down to MAX_INTENSITY in 8.8 fixed point and sends it to 'leds',
+// carrying the fractions from one refresh to the next: a channel has
+// more than the 16 steps of MAX_INTENSITY, fades do not stair-step.
+// Between the scheduler's frames, the last frame is sent again, dithered.
+// A frame of NUM_LEDS takes 30 us per LED plus a 50 us latch on the wire
+// (interrupts off): refreshing every other wire time leaves half of the
+// time to loop().
+#define DITHER_REFRESH_US  (2 * (NUM_LEDS * 30 + 50))
+
+// the state of any effect
+typedef union effect_slot {
+  flash_t flash;
+  theater_chase_t theater_chase;
+  bounce_t bounce;
+  kitt_t kitt;
+  twinkle_t twinkle;
+  running_lights_t running_lights;
+  changing_colors_t changing_colors;
+  rainbow_t rainbow;
+  chase_rainbow_t chase_rainbow;
+  fire_t fire;
+  meteor_t meteor;
+  modulation_t modulation;
+} effect_slot_t;
+
+// the playing effect and the next one (they are both played during a crossfade)
+effect_slot_t slots[2];
+int slot = 0;
+
+CRGB frame[NUM_LEDS];
+CRGB layers[2][NUM_LEDS];
+uint8_t dither_error[3 * NUM_LEDS];
+scheduler_t scheduler;
+dither_t dither;
+int starting = 1;
+unsigned long stats_start;
 
 
 // ***************************************************
@@ -139,17 +191,20 @@ unsigned long start_time;
 // ***************************************************
 
 void setup() {
-  FastLED.addLeds<WS2812, DATA_PIN, GRB>(leds, NUM_LEDS).setCorrection( TypicalLEDStrip );
+  // the dither layer corrects the colors and dithers (see EFFECT ENGINE):
+  // FastLED's correction would quantize the dithered low levels again
+  FastLED.addLeds<WS2812, DATA_PIN, GRB>(leds, NUM_LEDS).setCorrection( UncorrectedColor );
   // FastLED.setMaxPowerInVoltsAndMilliamps(5,400);
+  FastLED.setDither(DISABLE_DITHER);
 
   // scale max led luminosity to reduce power consumption
-  // All colors in color arrays have their Max luminosity scaled down 
-  // with a bitwise right shift of SCALE_DOWN_SHIFT.
-  
-  scale_down_color_array(primary_colors,   NUM_PRIMARY_COLORS);
-  scale_down_color_array(secondary_colors, NUM_SECONDARY_COLORS);
-  scale_down_color_array(simple_colors,    NUM_SIMPLE_COLORS);
-  scale_down_color_array(visible_colors,   NUM_VISIBLE_COLORS);
+  // The dither layer scales the whole strip down by 2^SCALE_DOWN_SHIFT
+  // (MAX_INTENSITY / 256); the colors stay at full range.
+  // This is suitable when leds are used at night.
+  // Also, using SCALE_DOWN_SHIFT of 3 (1/8th of original intensity) on a system
+  // comprising 314 leds (using WS2812B) significantly reduces current consumption.
+  // ex: theatre_chase() will consume approx. 0.4 Amp with with CRGB::Grey scaled down
+  // rather and 2.6 Amp with the original CRGB::Grey.
 
   // set pin D19 (A5) in high impedance mode so we can hook 
   // the signal resistor onto this terminal on the break out board
@@ -158,64 +213,36 @@ void setup() {
   pinMode(19, INPUT);  
   delay(10);
 
-//  Serial.begin(9600);
-//  delay(10);
+  // serial control: 'n' next effect, 'f' fade out, 's' frame statistics
+  Serial.begin(9600);
+  delay(10);
 
-//  Serial.println(sin16(32768.0));    // -> 0                           === sin(pi   ou 180 deg)
-//  Serial.println(sin16(32768.0/2));  // -> 32645 (32645/32767 = 0,996) === sin(pi/2 ou  90 deg)
-//  Serial.println(sin16(32768.0/6));  // -> 16279 (16279/32767 = 0,497) === sin(pi/6 ou  30 deg) 
-//  Serial.println(sin16(32768.0/4));  // -> 23170 (23170/32767 = 0,707) === sin(pi/4 ou  45 deg)
+  init_dither(&dither, frame, leds, dither_error, NUM_LEDS, MAX_INTENSITY, DITHER_REFRESH_US, show_strip, NULL);
+  set_dither_correction(&dither, TypicalLEDStrip);
+  init_scheduler(&scheduler, frame, NUM_LEDS, FRAME_INTERVAL, dither_show, &dither);
+  set_layers(&scheduler, layers[0], layers[1]);
+  stats_start = millis();
 
   show_start_sequence();
 }
 
+// flash strip 3 times to show we are restarting, then fade out (see loop())
 void show_start_sequence() {
-
-  // flash strip 3 times to show we are restarting
-  for (int i = 0; i < 3; i++) {
-    fill_solid(leds, NUM_LEDS, WHITE);
-    showStrip();
-    delay(MS_START_SEQUENCE_DELAY);
-    
-    fill_solid(leds, NUM_LEDS, BLACK);
-    showStrip();
-    delay(MS_START_SEQUENCE_DELAY);
-  }
-  
-  fill_solid(leds, NUM_LEDS, WHITE);
-  showStrip();
-  delay(MS_START_SEQUENCE_DELAY);
-  auto_fade_out();
+  play_effect(&scheduler, init_flash(&slots[slot].flash, WHITE, 3, MS_START_SEQUENCE_DELAY, MS_START_SEQUENCE));
 }
 
-
-// Scale down color by bitwise shifting each color component by SCALE_DOWN_SHIFT.
-// This is suitable when leds are used at night.
-// Also, using SCALE_DOWN_SHIFT of 3 (1/8th of original intensity) on a system
-// comprising 314 leds (using WS2812B) significantly reduces current consumption.
-// ex: theatre_chase() will consume approx. 0.4 Amp with with CRGB::Grey scaled down
-// rather and 2.6 Amp with the original CRGB::Grey.
-
-CRGB scale_down_color(CRGB color) {
-  color.r = color.r >> SCALE_DOWN_SHIFT;
-  color.g = color.g >> SCALE_DOWN_SHIFT;
-  color.b = color.b >> SCALE_DOWN_SHIFT;
-  return color;
+void show_strip(void* context, uint8_t level) {
+  FastLED.show(level);
 }
 
-void scale_down_color_array(CRGB color_array[], int n) {
-  for (int i = 0; i < n; i++) {
-    color_array[i] = scale_down_color(color_array[i]);
-  }
-} 
 
 // ***************************************************
 //                  MAIN LOOP
 // ***************************************************
 
-// array of "auto" functions (callable without parameter) 
-#define NUM_FUNCTIONS 33
-void (*display_functions[NUM_FUNCTIONS])() = {
+// array of "auto" functions: each one starts its effect in a slot
+#define NUM_FUNCTIONS 32
+effect_t* (*display_functions[NUM_FUNCTIONS])(effect_slot_t* s) = {
   auto_changing_colors,
   auto_changing_colors,
   auto_changing_colors,
@@ -247,21 +274,75 @@ void (*display_functions[NUM_FUNCTIONS])() = {
   auto_theater_chase_rainbow,
   auto_rainbow_cycle,
   auto_rainbow_cycle,
-  auto_rainbow_cycle,
-  auto_nope
+  auto_rainbow_cycle
  };
 
-void auto_nope() {}
-
 void loop() {
+  unsigned long now = millis();
 
-  
+  run_scheduler(&scheduler, now);
+  refresh_dither(&dither, micros());
+
+  if (starting) {
+    // the start sequence fades out, then the effects begin
+    if (is_effect_expired(get_effect(&scheduler), now)) {
+      fade_out(&scheduler, MS_FADE_OUT, now);
+      starting = 0;
+    }
+  }
+  else if (is_scheduler_idle(&scheduler)) {
+    // an effect ended by itself (theater chase rainbow)
+    next_effect(now);
+  }
+  else if (!is_fading(&scheduler) && is_effect_expired(get_effect(&scheduler), now)) {
+    next_effect(now);
+  }
+
+  serial_control(now);
+}
+
+void next_effect(unsigned long now) {
   int index = random(NUM_FUNCTIONS);
-  display_functions[index](); 
+  slot = 1 - slot;
+  crossfade_effect(&scheduler, display_functions[index](&slots[slot]), MS_CROSSFADE, now);
+}
+
+void serial_control(unsigned long now) {
+  if (!Serial.available()) return;
+
+  switch (Serial.read()) {
+    case 'n':
+      if (!starting && !is_fading(&scheduler)) next_effect(now);
+      break;
+    case 'f':
+      if (!starting) fade_out(&scheduler, MS_FADE_OUT, now);
+      break;
+    case 's':
+      print_frame_stats(now);
+      break;
+  }
+}
 
+void print_frame_stats(unsigned long now) {
+  unsigned long elapsed = now - stats_start;
 
-  // for (int i = 0; i < NUM_FUNCTIONS; i++) display_functions[i]();
+  Serial.print("frames ");
+  Serial.print(scheduler.frames);
+  Serial.print(", dropped ");
+  Serial.print(scheduler.dropped);
+  Serial.print(", overruns ");
+  Serial.print(scheduler.overruns);
+  Serial.print(", refreshes ");
+  Serial.print(dither.refreshes);
+  Serial.print(", max frame ");
+  Serial.print(scheduler.max_frame_us);
+  Serial.print(" us, busy ");
+  Serial.print(elapsed > 0 ? scheduler.busy_us / (elapsed * 10.0) : 0.0);
+  Serial.println(" %");
 
+  reset_frame_stats(&scheduler);
+  dither.refreshes = 0;
+  stats_start = now;
 }
 
 // ***************************************************
@@ -276,930 +357,125 @@ CRGB get_random_color(CRGB color_array[], int n) {
 #define get_random_simple_color()     get_random_color(simple_colors,NUM_SIMPLE_COLORS)
 #define get_random_visible_color()    get_random_color(visible_colors,NUM_VISIBLE_COLORS)
 
-int get_random_pixel_index() {
-  return random(NUM_LEDS);
-}
-
-int get_random_pixel_index_unbalanced() {
-  int range = random(3);
-  switch (range) {
-    case 0: return random(NUM_LEDS_MIN);
-    case 1: return random(NUM_LEDS_MID);
-    case 2: return random(NUM_LEDS);
-  }
-}
-
-// ***************************************************
-//                    FADE OUT
-// ***************************************************
-
-void auto_fade_out() {
-  fade_out(MS_FADE_OUT_DELAY);
-}
-
-void fade_out(int ms_delay) {
-  CRGB buff[NUM_LEDS_BUFF_SIZE];
-  float scale;
-
-  memcpy(buff, leds, sizeof(leds));
-
-  for (int i = MAX_INTENSITY; i >= 0 ; i=i-2) {
-    scale = (float)i / MAX_INTENSITY;
-    for (int j = 0; j < NUM_LEDS; j++) {
-      leds[j].r = scale * buff[j].r;
-      leds[j].g = scale * buff[j].g;
-      leds[j].b = scale * buff[j].b;
-    }    
-    showStrip();
-    delay(ms_delay);
-  }
-}
-
 // ***************************************************
 //                TWO COLORS MODULATION
 // ***************************************************
 
-#define MIN_PERIOD      1000  // in ms
-#define MAX_PERIOD      4000  // in ms
 #define TIME_INCREMENT  10    // in ms
-#define NO_COLOR        -1
-#define SIN16_2_PI      65536
-#define SIN16_MOINS_PI_SUR_2  (65536>>2)
-
-void auto_two_colors_modulation() {
-  CRGB color;
-  bool enabled[3];
-  int ms_period[3];
-  int ms_elapsed[3];
-  int color_disabled;
-  int color_to_disable;
-  unsigned long start_time;
-
-  enabled[0] = true;
-  enabled[1] = true;
-  enabled[2] = false;
-  color_disabled = 2;
-  color = BLACK;
-  
-  for (int i = 0; i < 3; i++) {
-    if (enabled[i]) {
-      ms_period[i]  = MIN_PERIOD + random(MAX_PERIOD - MIN_PERIOD);
-      ms_elapsed[i] = 0;
-    }
-    else {
-      ms_period[i]  = 0;
-      ms_elapsed[i] = 0;
-    }
-  }
 
-  set_timer();
-
-  while (1) {
-
-    // Check if a timer has elapsed. 
-    // This will be the next color to disable.
-    color_to_disable = NO_COLOR;
-    for (int i = 0; i < 3; i++) {
-      if (enabled[i]) ms_elapsed[i] += TIME_INCREMENT;
-      if (ms_elapsed[i] > ms_period[i]) {
-        color_to_disable = i;
-        break;
-      }
-    }
-
-    // if a timer has elapsed for a color, disable this color
-    // and enable the color that was disabled before.
-    if (color_to_disable != NO_COLOR) {
-      enabled[color_disabled]       = true;
-      ms_period[color_disabled]     = MIN_PERIOD + random(MAX_PERIOD - MIN_PERIOD);
-      ms_elapsed[color_disabled]    = 0;
-
-      enabled[color_to_disable]     = false;
-      ms_period[color_to_disable]   = 0;
-      ms_elapsed[color_to_disable]  = 0;
-      // intensity[color_to_disable]   = 0;
-      
-      color_disabled = color_to_disable;
-    }
-
-    for (int i = 0; i < 3; i++) {
-      if (enabled[i]) {
-        float angle = SIN16_2_PI*(float)ms_elapsed[i]/ms_period[i] + SIN16_MOINS_PI_SUR_2;
-        uint16_t sin16_arg = (uint16_t)((long)angle % SIN16_2_PI);
-        color.raw[i] = (byte)((MAX_INTENSITY>>1)*(1.0+(float)sin16(sin16_arg)/32767.0));
-      }
-      set_strip(color);
-      showStrip();
-    }
-
-    delay(TIME_INCREMENT);
-    break_on_timer_elapsed(MS_ANIMATION_TIME_LONG);
-  }
-  
-  fade_out(MS_DELAY);
-}
-
-void set_strip(CRGB color) {
-  for (int i = 0; i < NUM_LEDS; i++) {
-    leds[i] = color;
-  }  
-}
-
-void set_half_strip(CRGB color, bool even) {
-  int start_index = even ? 0 : 1;
-  for (int i = start_index; i < NUM_LEDS; i=i+2) {
-    leds[i] = color;
-  }
-}
-
-void set_strip_odd_half(CRGB color) {
-  for (int i = 1; i < NUM_LEDS; i=i+2) {
-    leds[i] = color;
-  }
-}
-
-
-
-// ***************************************************
-//                        WIPE
-// ***************************************************
-
-void auto_wipe_forward() {
-  wipe_forward(get_random_simple_color(), MS_DELAY);
-  auto_fade_out();
-}
-
-void auto_wipe_forward_and_erase() {
-  wipe_forward(get_random_simple_color(), MS_DELAY);
-  wipe_forward(BLACK, MS_DELAY);
-}
- 
-void auto_wipe_backward_and_erase() {
-  wipe_backward(get_random_simple_color(), MS_DELAY);
-  wipe_backward(BLACK, MS_DELAY);
-}
-
-void wipe_forward(const CRGB color, int ms_delay) {
-  for(int i=0; i<NUM_LEDS; i++) {
-      leds[i] = color;
-      showStrip();
-      delay(ms_delay);
-  }
-}
-
-void wipe_backward(const CRGB color, int ms_delay) {
-  int j = NUM_LEDS-1;
-  for(int i=0; i<NUM_LEDS; i++) {
-      leds[j--] = color;
-      showStrip();
-      delay(ms_delay);
-  }
+effect_t* auto_two_colors_modulation(effect_slot_t* s) {
+  return init_modulation(&s->modulation, FULL_INTENSITY, TIME_INCREMENT, MS_ANIMATION_TIME_LONG);
 }
 
 // ***************************************************
 //                    THEATER CHASE
 // ***************************************************
 
-void auto_theater_chase_forward() {
-  CRGB color = get_random_simple_color();
-  set_timer();
-  while(1) {
-    theater_chase_forward (color, THEATER_CHASE_DELAY, THEATER_CHASE_COUNT, true);
-    showStrip();
-    break_on_timer_elapsed(MS_ANIMATION_TIME_SHORT);
-  }
-  theater_chase_forward(color, THEATER_CHASE_DELAY, THEATER_CHASE_COUNT, false);
-  auto_fade_out();
-}
-
-void auto_theater_chase_backward() {
-  CRGB color = get_random_simple_color();
-  set_timer();
-  while(1) {
-    theater_chase_backward(color, THEATER_CHASE_DELAY, THEATER_CHASE_COUNT, true);
-    showStrip();
-    break_on_timer_elapsed(MS_ANIMATION_TIME_SHORT);
-  }
-  theater_chase_backward(color, THEATER_CHASE_DELAY, THEATER_CHASE_COUNT, false);
-  auto_fade_out();
-}
-
-
-void theater_chase_forward(CRGB color, int ms_delay, int n, bool erase_last) {
-  for (int j=0; j<n; j++) {  //do n cycles of chasing
-    for (int q=0; q < 3; q++) {
-      for (int i=0; i < NUM_LEDS; i=i+3) {
-        set_pixel_color(i+q, color);    //turn every third pixel on
-      }
-      showStrip();
-     
-      delay(ms_delay);
-     
-      for (int i=0; i < NUM_LEDS; i=i+3) {
-        set_pixel_color(i+q, BLACK);        //turn every third pixel off
-      }
-    }
-  }
-}
-
-void theater_chase_backward(CRGB color, int ms_delay, int n, bool erase_last) {
-  for (int j=0; j<n; j++) {  //do n cycles of chasing
-    for (int q=2; q >= 0; q--) {
-      for (int i=0; i < NUM_LEDS; i=i+3) {
-        set_pixel_color(i+q, color);    //turn every third pixel on
-      }
-      showStrip();
-     
-      delay(ms_delay);
-     
-      for (int i=0; i < NUM_LEDS; i=i+3) {
-        set_pixel_color(i+q, BLACK);        //turn every third pixel off
-      }
-    }
-  }
-}
-
-
-/*
-void theater_chase_forward(CRGB color, int ms_delay, int n, bool erase_last) {
-  int q = 0;
-  for (int j = 0; j < n; j++, q++) {  
-    for (int i = 0; i < NUM_LEDS; i++) {
-      if ((i+q) % THEATER_CHASE_INCR == 0) {
-        set_pixel_color(i, color);  
-      }
-    }
-    
-    showStrip();
-    delay(ms_delay);
-        
-    fill_solid(leds, NUM_LEDS, BLACK);
-  }
-}
-*/
-
-/*
-void theater_chase_backward(CRGB color, int ms_delay, int n, bool erase_last) {
-  int q = n + THEATER_CHASE_INCR - 1;
-  for (int j = 0; j < n; j++, q++) {  
-    for (int i = 0; i < NUM_LEDS; i++) {
-      if ((i+q) % THEATER_CHASE_INCR == 0) {
-        set_pixel_color(i, color);
-      }
-    }
-    showStrip();
-    delay(ms_delay);
-    
-    if (j == n-1 || !erase_last) break;
-    
-    fill_solid(leds, NUM_LEDS, BLACK);
-  }
-}
-*/
-
-
-// ***************************************************
-//                FADE IN AND OUT
-// ***************************************************
-
-void auto_fade_in_out_color() {
-  fade_in_out_color(get_random_simple_color(), 0);
+effect_t* auto_theater_chase_forward(effect_slot_t* s) {
+  return init_theater_chase(&s->theater_chase, get_random_simple_color(), 1, THEATER_CHASE_DELAY,
+                            MS_ANIMATION_TIME_SHORT);
 }
 
-void fade_in_out_color(const CRGB color, int ms_delay) {
-  byte r, g, b;
-  r = color.r;
-  g = color.g;
-  b = color.b;
-  fade_in_out_components(r, g, b, ms_delay);
-}
-
-void fade_in_out_components(byte red, byte green, byte blue, int ms_delay) {
-  float r, g, b, scale;
-     
-  for(int k = 0; k < MAX_INTENSITY; k=k+1) {
-    scale = (float)k/MAX_INTENSITY;
-    r = scale*red;
-    g = scale*green;
-    b = scale*blue;
-    setAll(r,g,b);
-    showStrip();
-    delay(ms_delay);
-  }
-     
-  for(int k = MAX_INTENSITY; k >= 0; k=k-2) {
-    scale = (float)k/MAX_INTENSITY;
-    r = scale*red;
-    g = scale*green;
-    b = scale*blue;
-    setAll(r,g,b);
-    showStrip();
-    delay(ms_delay);
-  }
+effect_t* auto_theater_chase_backward(effect_slot_t* s) {
+  return init_theater_chase(&s->theater_chase, get_random_simple_color(), -1, THEATER_CHASE_DELAY,
+                            MS_ANIMATION_TIME_SHORT);
 }
 
 // ***************************************************
 //                    CYLON BOUNCE
 // ***************************************************
 
-void auto_cylon_bounce() {
-  CRGB color;
-  set_timer();
-  while(1) {
-    color = get_random_simple_color();
-    CylonBounce(color.r, color.g, color.b, CYLON_EYE_SIZE, CYLON_SPEED_DELAY, CYLON_RETURN_DELAY);
-    break_on_timer_elapsed(MS_ANIMATION_TIME_LONG);
-  }
-  auto_fade_out();
+effect_t* auto_cylon_bounce(effect_slot_t* s) {
+  return init_bounce(&s->bounce, simple_colors, NUM_SIMPLE_COLORS, CYLON_EYE_SIZE, CYLON_SPEED_DELAY,
+                     CYLON_RETURN_DELAY, MS_ANIMATION_TIME_LONG);
 }
 
-void auto_cylon_slow_bounce() {
-  CRGB color;
-  set_timer();
-  while(1) {
-    color = get_random_simple_color();
-    CylonBounce(color.r, color.g, color.b, CYLON_EYE_SIZE, CYLON_SPEED_DELAY*4, CYLON_RETURN_DELAY);
-    break_on_timer_elapsed(MS_ANIMATION_TIME_EXTRA);
-  }
-  auto_fade_out();
-}
-
-void CylonBounce(byte red, byte green, byte blue, int EyeSize, int SpeedDelay, int ReturnDelay){
-
-  for(int i = 0; i < NUM_LEDS-EyeSize-2; i++) {
-    setAll(0,0,0);
-    setPixel(i, red/10, green/10, blue/10);
-    for(int j = 1; j <= EyeSize; j++) {
-      setPixel(i+j, red, green, blue);
-    }
-    setPixel(i+EyeSize+1, red/10, green/10, blue/10);
-    showStrip();
-    delay(SpeedDelay);
-  }
-
-  delay(ReturnDelay);
-
-  for(int i = NUM_LEDS-EyeSize-2; i > 0; i--) {
-    setAll(0,0,0);
-    setPixel(i, red/10, green/10, blue/10);
-    for(int j = 1; j <= EyeSize; j++) {
-      setPixel(i+j, red, green, blue);
-    }
-    setPixel(i+EyeSize+1, red/10, green/10, blue/10);
-    showStrip();
-    delay(SpeedDelay);
-  }
- 
-  delay(ReturnDelay);
+effect_t* auto_cylon_slow_bounce(effect_slot_t* s) {
+  return init_bounce(&s->bounce, simple_colors, NUM_SIMPLE_COLORS, CYLON_EYE_SIZE, CYLON_SPEED_DELAY*4,
+                     CYLON_RETURN_DELAY, MS_ANIMATION_TIME_EXTRA);
 }
 
 // ***************************************************
 //                        KITT
 // ***************************************************
 
-void auto_KITT_in_and_out() {
-  set_timer();
-  while(1) {
-    CRGB color = get_random_simple_color();
-    OutsideToCenter(color.r, color.g, color.b, KITT_EYE_SIZE, KITT_SPEED_DELAY, KITT_RETURN_DELAY);    
-    CenterToOutside(color.r, color.g, color.b, KITT_EYE_SIZE, KITT_SPEED_DELAY, KITT_RETURN_DELAY);
-    break_on_timer_elapsed(MS_ANIMATION_TIME_LONG);
-  }
-  auto_fade_out();
+effect_t* auto_KITT_in_and_out(effect_slot_t* s) {
+  return init_kitt(&s->kitt, simple_colors, NUM_SIMPLE_COLORS, true, KITT_EYE_SIZE, KITT_SPEED_DELAY,
+                   KITT_RETURN_DELAY, MS_ANIMATION_TIME_LONG);
 }
 
-void auto_KITT_out_and_in() {
-  set_timer();
-  while(1) {
-    CRGB color = get_random_simple_color();
-    CenterToOutside(color.r, color.g, color.b, KITT_EYE_SIZE, KITT_SPEED_DELAY, KITT_RETURN_DELAY);
-    OutsideToCenter(color.r, color.g, color.b, KITT_EYE_SIZE, KITT_SPEED_DELAY, KITT_RETURN_DELAY);    
-    break_on_timer_elapsed(MS_ANIMATION_TIME_LONG);
-  }
-  auto_fade_out();
-}
-
-void auto_KITT_in_and_out_slow() {
-  set_timer();
-  while(1) {
-    CRGB color = get_random_simple_color();
-    OutsideToCenter(color.r, color.g, color.b, KITT_EYE_SIZE, KITT_SPEED_DELAY*4, KITT_RETURN_DELAY);    
-    CenterToOutside(color.r, color.g, color.b, KITT_EYE_SIZE, KITT_SPEED_DELAY*4, KITT_RETURN_DELAY);
-    break_on_timer_elapsed(MS_ANIMATION_TIME_EXTRA);
-  }
-  auto_fade_out();
+effect_t* auto_KITT_out_and_in(effect_slot_t* s) {
+  return init_kitt(&s->kitt, simple_colors, NUM_SIMPLE_COLORS, false, KITT_EYE_SIZE, KITT_SPEED_DELAY,
+                   KITT_RETURN_DELAY, MS_ANIMATION_TIME_LONG);
 }
 
-void auto_KITT_out_and_in_slow() {
-  set_timer();
-  while(1) {
-    CRGB color = get_random_simple_color();
-    CenterToOutside(color.r, color.g, color.b, KITT_EYE_SIZE, KITT_SPEED_DELAY*4, KITT_RETURN_DELAY);
-    OutsideToCenter(color.r, color.g, color.b, KITT_EYE_SIZE, KITT_SPEED_DELAY*4, KITT_RETURN_DELAY);    
-    break_on_timer_elapsed(MS_ANIMATION_TIME_EXTRA);
-  }
-  auto_fade_out();
+effect_t* auto_KITT_in_and_out_slow(effect_slot_t* s) {
+  return init_kitt(&s->kitt, simple_colors, NUM_SIMPLE_COLORS, true, KITT_EYE_SIZE, KITT_SPEED_DELAY*4,
+                   KITT_RETURN_DELAY, MS_ANIMATION_TIME_EXTRA);
 }
 
-
-void CenterToOutside(byte red, byte green, byte blue, int EyeSize, int SpeedDelay, int ReturnDelay) {
-  for(int i =((NUM_LEDS-EyeSize)/2); i>=0; i--) {
-    setAll(0,0,0);
-   
-    setPixel(i, red/10, green/10, blue/10);
-    for(int j = 1; j <= EyeSize; j++) {
-      setPixel(i+j, red, green, blue);
-    }
-    setPixel(i+EyeSize+1, red/10, green/10, blue/10);
-   
-    setPixel(NUM_LEDS-i, red/10, green/10, blue/10);
-    for(int j = 1; j <= EyeSize; j++) {
-      setPixel(NUM_LEDS-i-j, red, green, blue);
-    }
-    setPixel(NUM_LEDS-i-EyeSize-1, red/10, green/10, blue/10);
-   
-    showStrip();
-    delay(SpeedDelay);
-  }
-  delay(ReturnDelay);
-}
-
-// ***************************************************
-
-void OutsideToCenter(byte red, byte green, byte blue, int EyeSize, int SpeedDelay, int ReturnDelay) {
-  for(int i = 0; i<=((NUM_LEDS-EyeSize)/2); i++) {
-    setAll(0,0,0);
-   
-    setPixel(i, red/10, green/10, blue/10);
-    for(int j = 1; j <= EyeSize; j++) {
-      setPixel(i+j, red, green, blue);
-    }
-    setPixel(i+EyeSize+1, red/10, green/10, blue/10);
-   
-    setPixel(NUM_LEDS-i, red/10, green/10, blue/10);
-    for(int j = 1; j <= EyeSize; j++) {
-      setPixel(NUM_LEDS-i-j, red, green, blue);
-    }
-    setPixel(NUM_LEDS-i-EyeSize-1, red/10, green/10, blue/10);
-   
-    showStrip();
-    delay(SpeedDelay);
-  }
-  delay(ReturnDelay);
-}
-
-
-// ***************************************************
-
-void auto_twinkle() {
-  CRGB color = get_random_simple_color();
-  int lit_leds[TWINKLE_LEDS];
-  int to_turn_on  = 0;
-  int to_turn_off = 1;
-  
-  setAll(0, 0, 0);
-  for (int i = 0; i < TWINKLE_LEDS; i++) lit_leds[i] = 0;
-  
-  set_timer();
-  while(1) {
-    lit_leds[to_turn_on] = get_random_pixel_index();
-    set_pixel_color(lit_leds[to_turn_on], color);
-    showStrip();
-    
-    set_pixel_color(lit_leds[to_turn_off], BLACK);
-    to_turn_on  = (to_turn_on+1)  % TWINKLE_LEDS;
-    to_turn_off = (to_turn_off+1) % TWINKLE_LEDS;
-
-    delay(TWINKLE_DELAY);    
-    break_on_timer_elapsed(MS_ANIMATION_TIME_EXTRA);
-  }
-  auto_fade_out();
+effect_t* auto_KITT_out_and_in_slow(effect_slot_t* s) {
+  return init_kitt(&s->kitt, simple_colors, NUM_SIMPLE_COLORS, false, KITT_EYE_SIZE, KITT_SPEED_DELAY*4,
+                   KITT_RETURN_DELAY, MS_ANIMATION_TIME_EXTRA);
 }
 
 // ***************************************************
 
-void TwinkleRandom(int Count, int SpeedDelay, boolean OnlyOne) {
-  setAll(0,0,0);
- 
-  for (int i=0; i<Count; i++) {
-     setPixel(random(NUM_LEDS),random(0,255),random(0,255),random(0,255));
-     showStrip();
-     delay(SpeedDelay);
-     if(OnlyOne) {
-       setAll(0,0,0);
-     }
-   }
- 
-  delay(SpeedDelay);
+effect_t* auto_twinkle(effect_slot_t* s) {
+  return init_twinkle(&s->twinkle, get_random_simple_color(), TWINKLE_LEDS, TWINKLE_DELAY,
+                      MS_ANIMATION_TIME_EXTRA);
 }
 
 // ***************************************************
 
-void SparkleLoop() {
-  for (int i = 0; i < 1000; i++) Sparkle(0xff, 0xff, 0xff, 0);
+effect_t* auto_running_lights(effect_slot_t* s) {
+  return init_running_lights(&s->running_lights, get_random_simple_color(), RUNNING_LIGHTS_DELAY,
+                             MS_ANIMATION_TIME_EXTRA);
 }
 
-void Sparkle(byte red, byte green, byte blue, int SpeedDelay) {
-  int Pixel = random(NUM_LEDS);
-  setPixel(Pixel,red,green,blue);
-  showStrip();
-  delay(SpeedDelay);
-  setPixel(Pixel,0,0,0);
+effect_t* auto_changing_colors(effect_slot_t* s) {
+  return init_changing_colors(&s->changing_colors, get_random_simple_color(), RUNNING_LIGHTS_DELAY,
+                              MS_ANIMATION_TIME_EXTRA);
 }
 
 // ***************************************************
 
-void auto_running_lights() {
-  int position = 0;
-  CRGB color = get_random_simple_color();
-
-  set_timer();
-  while(1) {
-    position++; // = 0; //Position + Rate;
-    for(int i = 0; i < NUM_LEDS; i++) {
-      setPixel(i,((sin(i+position+1) * 127 + 128)/255)*color.r,
-                 ((sin(i+position)   * 127 + 128)/255)*color.g,
-                 ((sin(i+position-1) * 127 + 128)/255)*color.b);
-    }
-    showStrip();
-    delay(RUNNING_LIGHTS_DELAY);
-    break_on_timer_elapsed(MS_ANIMATION_TIME_EXTRA);
-  }
-  auto_fade_out();
+effect_t* auto_rainbow_cycle(effect_slot_t* s) {
+  return init_rainbow(&s->rainbow, 0, RAINBOW_CYCLE_DELAY, MS_ANIMATION_TIME_EXTRA);
 }
 
-
-void auto_changing_colors() {
-  CRGB color = get_random_simple_color();
-  float phase[3] = {0.0};
-  set_timer();
-  while(1) {
-    for(int i = 0; i < NUM_LEDS; i++) {
-      setPixel(i,((sin(i+phase[0]) * 127 + 128)/255)*color.r,
-                 ((sin(i+phase[1])   * 127 + 128)/255)*color.g,
-                 ((sin(i+phase[2]) * 127 + 128)/255)*color.b);
-    }
-    showStrip();
-    delay(RUNNING_LIGHTS_DELAY);
-    phase[0] += 0.1;
-    phase[1] += 0.2;
-    phase[2] += 0.3;
-    break_on_timer_elapsed(MS_ANIMATION_TIME_EXTRA);
-  }
-  auto_fade_out();
+effect_t* auto_theater_chase_rainbow(effect_slot_t* s) {
+  return init_chase_rainbow(&s->chase_rainbow, 0, THEATER_CHASE_DELAY);
 }
 
 // ***************************************************
 
-void colorWipe(byte red, byte green, byte blue, int SpeedDelay) {
-  for(uint16_t i=0; i<NUM_LEDS; i++) {
-      setPixel(i, red, green, blue);
-      showStrip();
-      delay(SpeedDelay);
-  }
-}
+#define FIRE_COOLING   55
+#define FIRE_SPARKING  120
+#define FIRE_DELAY     15
 
-// ***************************************************
-
-void auto_rainbow_cycle()
-{
-  set_timer();
-  while(1) {
-    rainbowCycle(RAINBOW_CYCLE_DELAY);
-    break_on_timer_elapsed(MS_ANIMATION_TIME_EXTRA);
-  }
-  auto_fade_out();
+effect_t* auto_fire(effect_slot_t* s) {
+  return init_fire(&s->fire, FIRE_COOLING, FIRE_SPARKING, false, FIRE_DELAY, MS_ANIMATION_TIME_SHORT);
 }
 
-void rainbowCycle(int SpeedDelay) {
-  byte *c;
-  uint16_t i, j;
-
-  for(j=0; j<256*5; j++) { // 5 cycles of all colors on wheel
-    for(i=0; i< NUM_LEDS; i++) {
-      c=Wheel(((i * 256 / NUM_LEDS) + j) & 255);
-      c[0] = c[0] >> SCALE_DOWN_SHIFT;
-      c[1] = c[1] >> SCALE_DOWN_SHIFT;
-      c[2] = c[2] >> SCALE_DOWN_SHIFT;
-      setPixel(i, *c, *(c+1), *(c+2));
-    }
-    showStrip();
-    delay(SpeedDelay);
-  }
+effect_t* auto_fire_reversed(effect_slot_t* s) {
+  return init_fire(&s->fire, FIRE_COOLING, FIRE_SPARKING, true, FIRE_DELAY, MS_ANIMATION_TIME_SHORT);
 }
 
 // ***************************************************
 
-byte * Wheel(byte WheelPos) {
-  static byte c[3];
- 
-  if(WheelPos < 85) {
-   c[0]=WheelPos * 3;
-   c[1]=255 - WheelPos * 3;
-   c[2]=0;
-  } else if(WheelPos < 170) {
-   WheelPos -= 85;
-   c[0]=255 - WheelPos * 3;
-   c[1]=0;
-   c[2]=WheelPos * 3;
-  } else {
-   WheelPos -= 170;
-   c[0]=0;
-   c[1]=WheelPos * 3;
-   c[2]=255 - WheelPos * 3;
-  }
-
-  return c;
-}
-
-// ***************************************************
+#define METEOR_SIZE    5
+#define METEOR_DECAY   64
+#define METEOR_DELAY   30
 
-void auto_theater_chase_rainbow() {
-  theaterChaseRainbow(THEATER_CHASE_DELAY);
+effect_t* auto_meteor_rain(effect_slot_t* s) {
+  return init_meteor(&s->meteor, CRGB(FULL_INTENSITY, FULL_INTENSITY, FULL_INTENSITY), METEOR_SIZE, METEOR_DECAY,
+                     true, false, METEOR_DELAY, MS_ANIMATION_TIME_SHORT);
 }
 
-void theaterChaseRainbow(int SpeedDelay) {
-  byte *c;
- 
-  for (int j=0; j < 256; j++) {     // cycle all 256 colors in the wheel
-    for (int q=0; q < 4; q++) {
-        for (int i=0; i < NUM_LEDS; i=i+4) {
-          c = Wheel( (i+j) % 255);
-          c[0] = c[0] >> SCALE_DOWN_SHIFT;
-          c[1] = c[1] >> SCALE_DOWN_SHIFT;
-          c[2] = c[2] >> SCALE_DOWN_SHIFT;
-          setPixel(i+q, *c, *(c+1), *(c+2));    //turn every third pixel on
-        }
-        showStrip();
-       
-        delay(SpeedDelay);
-       
-        for (int i=0; i < NUM_LEDS; i=i+4) {
-          setPixel(i+q, 0,0,0);        //turn every third pixel off
-        }
-    }
-  }
-}
-
-
-// ***************************************************
-
-void auto_fire() {
-  set_timer();
-  while(1) {
-    Fire(55,120,15, false);
-    break_on_timer_elapsed(MS_ANIMATION_TIME_SHORT);
-  }
-  auto_fade_out();
-}
-
-void auto_fire_reversed() {
-  set_timer();
-  while(1) {
-    Fire(55,120,15, true);
-    break_on_timer_elapsed(MS_ANIMATION_TIME_SHORT);
-  }
-  auto_fade_out();
-}
-
-
-// ***************************************************
-
-void Fire(int Cooling, int Sparking, int SpeedDelay, bool reversed) {
-  static byte heat[NUM_LEDS_BUFF_SIZE];
-  int cooldown;
- 
-  // Step 1.  Cool down every cell a little
-  for( int i = 0; i < NUM_LEDS; i++) {
-    cooldown = random(0, ((Cooling * 10) / NUM_LEDS) + 2);
-   
-    if(cooldown>heat[i]) {
-      heat[i]=0;
-    } else {
-      heat[i]=heat[i]-cooldown;
-    }
-  }
- 
-  // Step 2.  Heat from each cell drifts 'up' and diffuses a little
-  for( int k= NUM_LEDS - 1; k >= 2; k--) {
-    heat[k] = (heat[k - 1] + heat[k - 2] + heat[k - 2]) / 3;
-  }
-   
-  // Step 3.  Randomly ignite new 'sparks' near the bottom
-  if( random(255) < Sparking ) {
-    int y = random(7);
-    heat[y] = heat[y] + random(160,255);
-    //heat[y] = random(160,255);
-  }
-
-  // Step 4.  Convert heat to LED colors
-  for( int j = 0; j < NUM_LEDS; j++) {
-    setPixelHeatColor(j, heat[j] );
-  }
-
-  if (reversed) {
-    show_strip_reversed();
-  }
-  else {
-    showStrip();      
-  }
-  delay(SpeedDelay);
-}
-
-// ***************************************************
-
-void setPixelHeatColor (int Pixel, byte temperature) {
-  // Scale 'heat' down from 0-255 to 0-191
-  byte t192 = round((temperature/255.0)*191);
- 
-  // calculate ramp up from
-  byte heatramp = t192 & 0x3F; // 0..63
-  // heatramp <<= 2; // scale up to 0..252
- 
-  // figure out which third of the spectrum we're in:
-  if( t192 > 0x80) {                     // hottest
-    setPixel(Pixel, 0x40, 0x40, heatramp);
-  } else if( t192 > 0x40 ) {             // middle
-    setPixel(Pixel, 040, heatramp, 0);
-  } else {                               // coolest
-    setPixel(Pixel, heatramp, 0, 0);
-  }
-}
-
-// ***************************************************
-
-void auto_meteor_rain() {
-  set_timer();
-  while(1) {
-    meteorRain(MAX_INTENSITY, MAX_INTENSITY, MAX_INTENSITY, 5, 64, true, 30, false);
-    break_on_timer_elapsed(MS_ANIMATION_TIME_SHORT);
-  }
-}
-
-void auto_meteor_rain_reversed() {
-  set_timer();
-  while(1) {
-    meteorRain(MAX_INTENSITY, MAX_INTENSITY, MAX_INTENSITY, 5, 64, true, 30, true);
-    break_on_timer_elapsed(MS_ANIMATION_TIME_SHORT);
-  }  
-}
-
-void meteorRain(byte red, byte green, byte blue, byte meteorSize, 
-                byte meteorTrailDecay, boolean meteorRandomDecay, 
-                int SpeedDelay, bool reversed) {  
-  setAll(0,0,0);
- 
-  for(int i = 0; i < NUM_LEDS+NUM_LEDS; i++) {
-   
-   
-    // fade brightness all LEDs one step
-    for(int j=0; j<NUM_LEDS; j++) {
-      if( (!meteorRandomDecay) || (random(10)>5) ) {
-        fadeToBlack(j, meteorTrailDecay );        
-      }
-    }
-   
-    // draw meteor
-    for(int j = 0; j < meteorSize; j++) {
-      if( ( i-j <NUM_LEDS) && (i-j>=0) ) {
-        setPixel(i-j, red, green, blue);
-      }
-    }
-   
-    if (reversed) {
-      show_strip_reversed();
-    }
-    else {
-      showStrip();      
-    }
-    delay(SpeedDelay);
-  }
-}
-
-// ***************************************************
-
-void fadeToBlack(int ledNo, byte fadeValue) {
- #ifdef ADAFRUIT_NEOPIXEL_H
-    // NeoPixel
-    uint32_t oldColor;
-    uint8_t r, g, b;
-    int value;
-   
-    oldColor = strip.getPixelColor(ledNo);
-    r = (oldColor & 0x00ff0000UL) >> 16;
-    g = (oldColor & 0x0000ff00UL) >> 8;
-    b = (oldColor & 0x000000ffUL);
-
-    r=(r<=10)? 0 : (int) r-(r*fadeValue/256);
-    g=(g<=10)? 0 : (int) g-(g*fadeValue/256);
-    b=(b<=10)? 0 : (int) b-(b*fadeValue/256);
-   
-    strip.setPixelColor(ledNo, r,g,b);
- #endif
- #ifndef ADAFRUIT_NEOPIXEL_H
-   // FastLED
-   leds[ledNo].fadeToBlackBy( fadeValue );
- #endif  
-}
-
-// ***************************************************
-
-/*
-void auto_halloween_eyes() {
-  HalloweenEyes(0xff, 0x00, 0x00, 1, 4, true, random(5,50), random(50,150), random(1000, 10000));  
-  HalloweenEyes(0xff, 0x00, 0x00, 1, 4, true, random(5,50), random(50,150), random(1000, 10000));  
-}
- 
-void HalloweenEyes(byte red, byte green, byte blue,
-                   int EyeWidth, int EyeSpace,
-                   boolean Fade, int Steps, int FadeDelay,
-                   int EndPause){
- 
-  int i;
-  int StartPoint  = random( 0, NUM_LEDS - (2*EyeWidth) - EyeSpace );
-  int Start2ndEye = StartPoint + EyeWidth + EyeSpace;
- 
-  for(i = 0; i < EyeWidth; i++) {
-    setPixel(StartPoint + i, red, green, blue);
-    setPixel(Start2ndEye + i, red, green, blue);
-  }
- 
-  showStrip();
- 
-  if(Fade==true) {
-    float r, g, b;
- 
-    for(int j = Steps; j >= 0; j--) {
-      r = j*(red/Steps);
-      g = j*(green/Steps);
-      b = j*(blue/Steps);
-     
-      for(i = 0; i < EyeWidth; i++) {
-        setPixel(StartPoint + i, r, g, b);
-        setPixel(Start2ndEye + i, r, g, b);
-      }
-     
-      showStrip();
-      delay(FadeDelay);
-    }
-  }
- 
-  setAll(0,0,0); // Set all black
- 
-  delay(EndPause);
-}
-*/
-
-// ***************************************************
-// ***************************************************
-
-// Functions required for https://www.tweaking4all.com/
-
-void showStrip() {
- #ifdef ADAFRUIT_NEOPIXEL_H
-   // NeoPixel
-   strip.show();
- #endif
- #ifndef ADAFRUIT_NEOPIXEL_H
-   // FastLED
-   FastLED.show();
- #endif
-}
-
-void show_strip_reversed() {
-  CRGB temp;
-  for (int i = 0, j = NUM_LEDS-1; i < NUM_LEDS/2 + 1; i++, j--) {
-    temp = leds[i];
-    leds[i] = leds[j];
-    leds[j] = temp;
-  }
-  FastLED.show();
-}
-
-void setPixel(int pixel_index, byte red, byte green, byte blue) {
-  if (pixel_index >= NUM_LEDS || pixel_index < 0) return;
- #ifdef ADAFRUIT_NEOPIXEL_H
-   // NeoPixel
-   strip.setPixelColor(pixel_index, strip.Color(red, green, blue));
- #endif
- #ifndef ADAFRUIT_NEOPIXEL_H
-   // FastLED
-   leds[pixel_index].r = red;
-   leds[pixel_index].g = green;
-   leds[pixel_index].b = blue;
- #endif
-}
-
-void set_pixel_color(int pixel_index, CRGB color) {
-  if (pixel_index >= NUM_LEDS || pixel_index < 0) return;
-  leds[pixel_index] = color;
-}
-
-void setAll(byte red, byte green, byte blue) {
-  for(int i = 0; i < NUM_LEDS; i++ ) {
-    setPixel(i, red, green, blue);
-  }
-  showStrip();
+effect_t* auto_meteor_rain_reversed(effect_slot_t* s) {
+  return init_meteor(&s->meteor, CRGB(FULL_INTENSITY, FULL_INTENSITY, FULL_INTENSITY), METEOR_SIZE, METEOR_DECAY,
+                     true, true, METEOR_DELAY, MS_ANIMATION_TIME_SHORT);
 }
 
 /*
@@ -0,0 +1,119 @@
+/**
+ * clip.cpp
+ *
+ * C module playing a clip: an animation rendered offline (see
+ * extras/host/clip_maker), stored in flash as a stream of compressed
+ * frames and decoded frame by frame into the strip
+ *
+ * Author: Vincent Lacasse (lacasse4@yahoo.com)
+ * Date: 2026-10-18
+ * Target system: Arduino Uno
+ *
+ */
+
+/*
+ * A frame costs its runs: a pixel unchanged or black costs nothing but its
+ * run's op byte, a pixel copied three flash reads.  No random numbers, no
+ * arithmetic: an effect too slow to render live on the Uno plays as
+ * cheaply as any other once it is a clip.
+ *
+ * The clip is read with FL_PGM_READ_BYTE_NEAR(): from flash on the Uno,
+ * from memory on the other targets.
+ */
+
+#include "clip.h"
+
+static uint16_t read_word(const uint8_t* data)
+{
+  return FL_PGM_READ_BYTE_NEAR(data) | (FL_PGM_READ_BYTE_NEAR(data + 1) << 8);
+}
+
+/**
+ * @brief decode the frame at 'data' over the previous frame in 'leds'
+ * @param clip_count pixels of the clip's frames, count pixels of the strip (the extra pixels are dropped)
+ * @returns the next frame
+ */
+const uint8_t* decode_clip_frame(const uint8_t* data, CRGB* leds, int clip_count, int count)
+{
+  int i = 0;
+
+  while (i < clip_count) {
+    uint8_t op = FL_PGM_READ_BYTE_NEAR(data++);
+    int n = (op & ~CLIP_OP_MASK) + 1;
+    CRGB color;
+
+    switch (op & CLIP_OP_MASK) {
+      case CLIP_SKIP:
+        i += n;
+        break;
+      case CLIP_FILL:
+      case CLIP_BLACK:
+        color = CRGB::Black;
+        if ((op & CLIP_OP_MASK) == CLIP_FILL) {
+          color.r = FL_PGM_READ_BYTE_NEAR(data);
+          color.g = FL_PGM_READ_BYTE_NEAR(data + 1);
+          color.b = FL_PGM_READ_BYTE_NEAR(data + 2);
+          data += 3;
+        }
+        for (; n > 0; n--, i++) {
+          if (i < count) leds[i] = color;
+        }
+        break;
+      default:
+        for (; n > 0; n--, i++, data += 3) {
+          if (i < count) {
+            leds[i].r = FL_PGM_READ_BYTE_NEAR(data);
+            leds[i].g = FL_PGM_READ_BYTE_NEAR(data + 1);
+            leds[i].b = FL_PGM_READ_BYTE_NEAR(data + 2);
+          }
+        }
+        break;
+    }
+  }
+  return data;
+}
+
+/**
+ * @brief go back to the first frame (coded over black)
+ */
+static void rewind_clip(clip_t* fx, CRGB* leds, int count)
+{
+  fx->data = fx->stream + CLIP_HEADER_SIZE;
+  fx->frame = 0;
+  fill_solid(leds, count, CRGB::Black);
+}
+
+static int render_clip(effect_t* effect, CRGB* leds, int count, uint32_t now)
+{
+  clip_t* fx = (clip_t*) effect;
+  int steps = take_steps(effect, now);
+
+  for (int k = 0; k < steps; k++) {
+    if (fx->frame == fx->frames) {
+      if (!fx->loop || fx->frames == 0) return EFFECT_DONE;
+      fx->frame = 0;
+    }
+    // the first frame is coded over black (the buffer may hold another effect's frame)
+    if (fx->frame == 0) rewind_clip(fx, leds, count);
+    fx->data = decode_clip_frame(fx->data, leds, fx->count, count);
+    fx->frame++;
+  }
+  return EFFECT_RUNNING;
+}
+
+/**
+ * @brief play the clip 'stream' (in flash) at its own frame interval
+ * @param loop true: start over after the last frame; false: end after it
+ * @details a strip longer than the clip keeps its extra pixels black
+ */
+effect_t* init_clip(clip_t* fx, const uint8_t* stream, int loop, uint32_t duration)
+{
+  init_effect(&fx->effect, render_clip, read_word(stream + 4), duration);
+  fx->stream = stream;
+  fx->data = stream + CLIP_HEADER_SIZE;
+  fx->count = read_word(stream);
+  fx->frames = read_word(stream + 2);
+  fx->frame = 0;
+  fx->loop = loop;
+  return &fx->effect;
+}
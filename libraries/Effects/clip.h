@@ -0,0 +1,51 @@
+/**
+ * clip.h
+ *
+ * C module playing a clip: an animation rendered offline (see
+ * extras/host/clip_maker), stored in flash as a stream of compressed
+ * frames and decoded frame by frame into the strip
+ *
+ * Author: Vincent Lacasse (lacasse4@yahoo.com)
+ * Date: 2026-10-18
+ * Target system: Arduino Uno
+ *
+ */
+
+#ifndef _CLIP_H
+#define _CLIP_H
+
+#include "effect.h"
+
+/*
+ * A clip starts with a header of three little endian words: the pixels of
+ * a frame, the frames, the time between frames (ms).  Each frame follows,
+ * coded against the frame before it (black before the first one) as runs
+ * covering its pixels.  A run is an op byte, its kind in the two high
+ * bits and its length - 1 in the others, followed by its colors (r, g, b):
+ *   CLIP_SKIP    n pixels unchanged
+ *   CLIP_FILL    n pixels of one color (3 bytes)
+ *   CLIP_COPY    n pixels, a color each (3n bytes)
+ *   CLIP_BLACK   n black pixels
+ */
+#define CLIP_HEADER_SIZE    6
+#define CLIP_SKIP           0x00
+#define CLIP_FILL           0x40
+#define CLIP_COPY           0x80
+#define CLIP_BLACK          0xC0
+#define CLIP_OP_MASK        0xC0
+#define CLIP_MAX_RUN        64
+
+typedef struct clip {
+    effect_t effect;
+    const uint8_t* stream;   // the clip, in flash (FL_PROGMEM)
+    const uint8_t* data;     // the next frame
+    uint16_t count;          // pixels of a frame
+    uint16_t frames;
+    uint16_t frame;          // the next frame
+    uint8_t loop;            // start over after the last frame
+} clip_t;
+
+effect_t* init_clip(clip_t* fx, const uint8_t* stream, int loop, uint32_t duration);
+const uint8_t* decode_clip_frame(const uint8_t* data, CRGB* leds, int clip_count, int count);
+
+#endif
@@ -0,0 +1,155 @@
+/**
+ * dither.cpp
+ *
+ * C module dithering LED strip frames in time: the frame is scaled down
+ * in 8.8 fixed point and the fractions left are carried from one refresh
+ * to the next, so a dim strip shows the levels between its steps
+ *
+ * Author: Vincent Lacasse (lacasse4@yahoo.com)
+ * Date: 2026-10-18
+ * Target system: Arduino Uno
+ *
+ */
+
+/*
+ * At a brightness of 16/256 a full range channel has 16 steps on the
+ * strip, and a fade has 16 stairs.  Scaled in 8.8, the same channel keeps
+ * 8 more bits: 15.94 is sent as 15 or 16 in turn, 16 times out of 17 a 16.
+ * The error is a first order sigma-delta per channel; its starting values
+ * are spread (golden ratio) so that channels of the same value do not
+ * toggle together.
+ *
+ * The color correction scales each channel's gain: FastLED would correct
+ * after the dither, and scale8(1, 176) is 0: the lowest level of green
+ * (TypicalLEDStrip) would never light.
+ *
+ * The Uno has an 8x8 multiplier: a channel is scaled with two of them
+ * (the gain's high and low bytes) rather than a 32 bits multiply.
+ */
+
+#include <Arduino.h>
+#include "dither.h"
+
+#define SPREAD       159     // 256 / golden ratio
+
+/**
+ * @brief set the gain of each channel for a frame at 'level'
+ * @details brightness * (level + 1) * (correction + 1) / 256, 0 at level 0
+ */
+static void set_gain(dither_t* d, uint8_t level)
+{
+  d->level = level;
+  for (int c = 0; c < 3; c++) {
+    uint32_t gain = (uint32_t) d->brightness * (level + 1U) * (d->correction.raw[c] + 1U);
+    d->gain[c] = level == 0 ? 0 : gain >> 8;
+  }
+}
+
+/**
+ * @brief initialize a dither layer between 'frame' and 'leds' ('count' pixels)
+ * @param error count * 3 bytes, the fractions carried
+ * @param brightness strip scale (/256)
+ * @param refresh_us time between refreshes of the same frame (us), 0 for none
+ * @param show sends 'leds' (FastLED.show(level), called with level 255)
+ */
+void init_dither(dither_t* d, const CRGB* frame, CRGB* leds, uint8_t* error, int count, uint8_t brightness,
+                 uint16_t refresh_us, void (*show)(void* context, uint8_t level), void* context)
+{
+  d->frame = frame;
+  d->leds = leds;
+  d->error = error;
+  d->count = count;
+  d->show = show;
+  d->context = context;
+  d->refresh_us = refresh_us;
+  d->next_refresh = 0;
+  d->shown = 0;
+  d->refreshes = 0;
+  d->brightness = brightness;
+  d->correction = CRGB(255, 255, 255);      // UncorrectedColor
+  set_gain(d, 255);
+
+  uint8_t spread = 0;
+  for (int i = 0; i < 3 * count; i++) {
+    error[i] = spread;
+    spread += SPREAD;
+  }
+}
+
+/**
+ * @brief set the strip scale (/256), from the next frame
+ */
+void set_dither_brightness(dither_t* d, uint8_t brightness)
+{
+  d->brightness = brightness;
+  set_gain(d, d->level);
+}
+
+/**
+ * @brief set the color correction (TypicalLEDStrip, ...), from the next frame
+ * @details FastLED's correction must then be UncorrectedColor
+ */
+void set_dither_correction(dither_t* d, CRGB correction)
+{
+  d->correction = correction;
+  set_gain(d, d->level);
+}
+
+/**
+ * @brief send 'frame' scaled by 'gain', dithered
+ */
+static void send(dither_t* d)
+{
+  const uint8_t* in = (const uint8_t*) d->frame;
+  uint8_t* out = (uint8_t*) d->leds;
+  uint8_t* error = d->error;
+  uint8_t high[3];
+  uint8_t low[3];
+
+  for (int c = 0; c < 3; c++) {
+    high[c] = d->gain[c] >> 8;
+    low[c] = d->gain[c] & 0xFF;
+  }
+
+  for (int i = 0; i < d->count; i++) {
+    for (int c = 0; c < 3; c++) {
+      // 8.8 value of the channel, plus the fraction carried (unsigned: int is 16 bits on the Uno)
+      uint16_t value = (uint16_t) *in * high[c] + (((uint16_t) *in * low[c]) >> 8) + *error;
+      *out++ = value >> 8;
+      *error++ = value & 0xFF;
+      in++;
+    }
+  }
+
+  d->show(d->context, 255);
+  d->refreshes++;
+}
+
+/**
+ * @brief show a new frame at 'level' ('context' is the dither_t)
+ * @details the scheduler's show callback (see scheduler.h)
+ */
+void dither_show(void* context, uint8_t level)
+{
+  dither_t* d = (dither_t*) context;
+
+  set_gain(d, level);
+  send(d);
+  d->shown = 1;
+  d->next_refresh = micros() + d->refresh_us;
+}
+
+/**
+ * @brief send the last frame again, dithered, if a refresh is due at 'now' (us)
+ * @returns 1 if a refresh was sent, 0 otherwise
+ * @details loop() calls it between the scheduler's frames
+ */
+int refresh_dither(dither_t* d, uint32_t now)
+{
+  if (!d->shown || d->refresh_us == 0) return 0;
+  if ((int32_t) (now - d->next_refresh) < 0) return 0;
+
+  send(d);
+  d->next_refresh = now + d->refresh_us;
+  return 1;
+}
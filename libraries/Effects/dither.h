@@ -0,0 +1,54 @@
+/**
+ * dither.h
+ *
+ * C module dithering LED strip frames in time: the frame is scaled down
+ * in 8.8 fixed point and the fractions left are carried from one refresh
+ * to the next, so a dim strip shows the levels between its steps
+ *
+ * Author: Vincent Lacasse (lacasse4@yahoo.com)
+ * Date: 2026-10-18
+ * Target system: Arduino Uno
+ *
+ */
+
+#ifndef _DITHER_H
+#define _DITHER_H
+
+#include <stdint.h>
+#include <FastLED.h>
+
+/*
+ * The effects draw 'frame' at full range (the scheduler's output).  Each
+ * refresh scales it by brightness and by the frame's level into 8.8
+ * values, adds the fraction carried by every channel, sends the integer
+ * parts and keeps the new fractions: over a few refreshes a channel
+ * averages its 8.8 value.  The color correction is part of the scale
+ * (set_dither_correction()): FastLED's own correction and dithering must
+ * be off (setCorrection(UncorrectedColor), setDither(DISABLE_DITHER)),
+ * or they would quantize the dithered levels again.
+ */
+typedef struct dither {
+    const CRGB* frame;       // full range frame
+    CRGB* leds;              // the buffer given to FastLED: dithered frames
+    uint8_t* error;          // fraction carried by each channel (count * 3)
+    int count;
+    uint8_t brightness;      // strip scale (/256), the power budget
+    CRGB correction;         // color correction, a scale (/256) per channel
+    uint8_t level;           // of the last frame
+    uint16_t gain[3];        // 8.8 scale of each channel of the frame
+    void (*show)(void* context, uint8_t level);
+    void* context;
+    uint16_t refresh_us;     // time between refreshes, 0: new frames only
+    uint32_t next_refresh;   // us
+    int shown;               // a frame was given
+    uint32_t refreshes;      // frames sent (new or refreshed)
+} dither_t;
+
+void init_dither(dither_t* d, const CRGB* frame, CRGB* leds, uint8_t* error, int count, uint8_t brightness,
+                 uint16_t refresh_us, void (*show)(void* context, uint8_t level), void* context);
+void set_dither_brightness(dither_t* d, uint8_t brightness);
+void set_dither_correction(dither_t* d, CRGB correction);
+void dither_show(void* context, uint8_t level);
+int refresh_dither(dither_t* d, uint32_t now);
+
+#endif
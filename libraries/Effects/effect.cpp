@@ -0,0 +1,80 @@
+/**
+ * effect.cpp
+ *
+ * C module representing a LED strip effect as a state machine: the effect
+ * draws a frame when asked instead of looping with delay()
+ *
+ * Author: Vincent Lacasse (lacasse4@yahoo.com)
+ * Date: 2026-10-18
+ * Target system: Arduino Uno
+ *
+ */
+
+#include "effect.h"
+
+// the first render() sets the start time
+#define NOT_STARTED  0xFFFFFFFFUL
+
+/**
+ * @brief initialize an effect's header (the effect's init function calls it)
+ * @param interval time between steps (ms), the former delay()
+ * @param duration play time (ms), 0 for none (see is_effect_expired())
+ */
+void init_effect(effect_t* effect, render_t render, uint16_t interval, uint32_t duration)
+{
+  effect->render = render;
+  effect->start = NOT_STARTED;
+  effect->next = 0;
+  effect->interval = interval;
+  effect->duration = duration;
+  effect->taken = 0;
+}
+
+/**
+ * @brief return the number of steps due at 'now', and schedule the next one
+ * @details steps keep their pace whatever the frame rate.  An effect that
+ * @details fell behind by more than EFFECT_MAX_STEPS steps skips the rest.
+ */
+int take_steps(effect_t* effect, uint32_t now)
+{
+  int steps = 0;
+
+  while ((int32_t) (now - effect->next) >= 0) {
+    effect->next += effect->interval > 0 ? effect->interval : 1;
+    if (++steps == EFFECT_MAX_STEPS) {
+      if ((int32_t) (now - effect->next) >= 0) effect->next = now + effect->interval;
+      break;
+    }
+  }
+  effect->taken += steps;
+  return steps;
+}
+
+/**
+ * @brief delay the next step by 'pause' ms (the former delay() at a turn)
+ */
+void pause_effect(effect_t* effect, uint16_t pause)
+{
+  effect->next += pause;
+}
+
+/**
+ * @brief return true once the effect played for its duration
+ */
+int is_effect_expired(effect_t* effect, uint32_t now)
+{
+  return effect->duration > 0 && effect->start != NOT_STARTED && now - effect->start >= effect->duration;
+}
+
+/**
+ * @brief draw the effect's frame at 'now' (its first call starts the effect)
+ * @returns EFFECT_RUNNING or EFFECT_DONE
+ */
+int render_effect(effect_t* effect, CRGB* leds, int count, uint32_t now)
+{
+  if (effect->start == NOT_STARTED) {
+    effect->start = now;
+    effect->next = now;
+  }
+  return effect->render(effect, leds, count, now);
+}
@@ -0,0 +1,52 @@
+/**
+ * effect.h
+ *
+ * C module representing a LED strip effect as a state machine: the effect
+ * draws a frame when asked instead of looping with delay()
+ *
+ * Author: Vincent Lacasse (lacasse4@yahoo.com)
+ * Date: 2026-10-18
+ * Target system: Arduino Uno
+ *
+ */
+
+#ifndef _EFFECT_H
+#define _EFFECT_H
+
+#include <stdint.h>
+#include <FastLED.h>
+
+#define EFFECT_RUNNING     1
+#define EFFECT_DONE        0
+#define EFFECT_MAX_STEPS   4      // steps caught up in one frame, the rest are skipped
+
+typedef struct effect effect_t;
+
+/**
+ * @brief draw the frame at 'now' (ms) into 'leds'
+ * @returns EFFECT_RUNNING, or EFFECT_DONE once the effect has ended
+ * @details 'leds' is the effect's own buffer: it keeps the previous frame
+ */
+typedef int (*render_t)(effect_t* effect, CRGB* leds, int count, uint32_t now);
+
+/*
+ * Every effect's state starts with this header.  An effect moves by steps
+ * (what used to be a delay() between two showStrip()): take_steps() tells
+ * render() how many are due.
+ */
+struct effect {
+    render_t render;
+    uint32_t start;          // time of the first frame (ms)
+    uint32_t next;           // time of the next step (ms)
+    uint16_t interval;       // time between steps (ms)
+    uint32_t duration;       // play time (ms) before is_effect_expired(), 0 for none
+    uint32_t taken;          // steps taken
+};
+
+void init_effect(effect_t* effect, render_t render, uint16_t interval, uint32_t duration);
+int take_steps(effect_t* effect, uint32_t now);
+void pause_effect(effect_t* effect, uint16_t pause);
+int is_effect_expired(effect_t* effect, uint32_t now);
+int render_effect(effect_t* effect, CRGB* leds, int count, uint32_t now);
+
+#endif
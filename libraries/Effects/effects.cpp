@@ -0,0 +1,564 @@
+/**
+ * effects.cpp
+ *
+ * LED strip effects as state machines (see effect.h): the effects of
+ * WS2812_Velo, one step per former delay()
+ *
+ * Author: Vincent Lacasse (lacasse4@yahoo.com)
+ * Date: 2026-10-18
+ * Target system: Arduino Uno
+ *
+ */
+
+/*
+ * Each effect keeps what its former loop kept in local variables (loop
+ * indices, direction, color) and does one iteration of that loop per
+ * step.  render() takes the steps that are due and returns: the frame is
+ * the effect's buffer, which it keeps from one frame to the next (trails
+ * and twinkles fade in place).  Mirrored effects draw mirrored instead of
+ * reversing the strip after drawing it.
+ */
+
+#include <Arduino.h>
+#include "effects.h"
+#include "strip.h"
+
+/**
+ * @brief set a pixel, ignoring pixels out of the strip
+ */
+static void set_pixel(CRGB* leds, int count, int index, CRGB color)
+{
+  if (index < 0 || index >= count) return;
+  leds[index] = color;
+}
+
+/**
+ * @brief a random color of the palette
+ */
+CRGB pick_color(palette_t* palette)
+{
+  if (palette->size == 0) return CRGB::Black;
+  return palette->colors[random(palette->size)];
+}
+
+/**
+ * @brief color wheel: red to blue to green and back to red
+ */
+CRGB wheel(uint8_t position)
+{
+  if (position < 85) {
+    return CRGB(position * 3, 255 - position * 3, 0);
+  }
+  if (position < 170) {
+    position -= 85;
+    return CRGB(255 - position * 3, 0, position * 3);
+  }
+  position -= 170;
+  return CRGB(0, position * 3, 255 - position * 3);
+}
+
+static CRGB scale_down(CRGB color, uint8_t shift)
+{
+  return CRGB(color.r >> shift, color.g >> shift, color.b >> shift);
+}
+
+static CRGB tenth(CRGB color)
+{
+  return color.scale8(25);                 // 26/256 with FASTLED_SCALE8_FIXED
+}
+
+/**
+ * @brief an eye: dim pixel, 'eye' full pixels, dim pixel, from 'index' up (or down if mirrored)
+ */
+static void draw_eye(CRGB* leds, int count, int index, uint8_t eye, CRGB color, int mirrored)
+{
+  int side = mirrored ? -1 : 1;
+
+  set_pixel(leds, count, index, tenth(color));
+  for (int j = 1; j <= eye; j++) {
+    set_pixel(leds, count, index + side * j, color);
+  }
+  set_pixel(leds, count, index + side * (eye + 1), tenth(color));
+}
+
+// ***************************************************
+//                       FLASH
+// ***************************************************
+
+static int render_flash(effect_t* effect, CRGB* leds, int count, uint32_t now)
+{
+  flash_t* fx = (flash_t*) effect;
+
+  if (take_steps(effect, now) == 0) return EFFECT_RUNNING;
+
+  // the step just taken: on, off, ... then on for good
+  uint32_t step = effect->taken - 1;
+  int on = step >= 2UL * fx->flashes || step % 2 == 0;
+  fill_solid(leds, count, on ? fx->color : CRGB(CRGB::Black));
+  return EFFECT_RUNNING;
+}
+
+/**
+ * @brief flash the strip 'flashes' times, then stay lit
+ */
+effect_t* init_flash(flash_t* fx, CRGB color, uint8_t flashes, uint16_t interval, uint32_t duration)
+{
+  init_effect(&fx->effect, render_flash, interval, duration);
+  fx->color = color;
+  fx->flashes = flashes;
+  return &fx->effect;
+}
+
+// ***************************************************
+//                    THEATER CHASE
+// ***************************************************
+
+static int render_theater_chase(effect_t* effect, CRGB* leds, int count, uint32_t now)
+{
+  theater_chase_t* fx = (theater_chase_t*) effect;
+  int steps = take_steps(effect, now);
+
+  if (steps == 0) return EFFECT_RUNNING;
+
+  // the frame of the last step due
+  fx->phase = (fx->phase + (steps - 1) * (fx->direction + 3)) % 3;
+  fill_solid(leds, count, CRGB::Black);
+  for (int i = fx->phase; i < count; i += 3) {
+    leds[i] = fx->color;
+  }
+  fx->phase = (fx->phase + fx->direction + 3) % 3;
+  return EFFECT_RUNNING;
+}
+
+/**
+ * @brief every third pixel lit, moving one pixel per step
+ * @param direction 1 (forward) or -1 (backward)
+ */
+effect_t* init_theater_chase(theater_chase_t* fx, CRGB color, int direction, uint16_t interval,
+                             uint32_t duration)
+{
+  init_effect(&fx->effect, render_theater_chase, interval, duration);
+  fx->color = color;
+  fx->direction = direction < 0 ? -1 : 1;
+  fx->phase = direction < 0 ? 2 : 0;
+  return &fx->effect;
+}
+
+// ***************************************************
+//                    CYLON BOUNCE
+// ***************************************************
+
+static int render_bounce(effect_t* effect, CRGB* leds, int count, uint32_t now)
+{
+  bounce_t* fx = (bounce_t*) effect;
+  int steps = take_steps(effect, now);
+  int last = count - fx->eye - 2;
+
+  for (int k = 0; k < steps; k++) {
+    fill_solid(leds, count, CRGB::Black);
+    draw_eye(leds, count, fx->position, fx->eye, fx->color, 0);
+
+    fx->position += fx->direction;
+    if (fx->direction > 0 && fx->position >= last) {
+      fx->position = last;
+      fx->direction = -1;
+      pause_effect(effect, fx->turn);
+      break;
+    }
+    if (fx->direction < 0 && fx->position <= 0) {
+      fx->position = 0;
+      fx->direction = 1;
+      fx->color = pick_color(&fx->palette);
+      pause_effect(effect, fx->turn);
+      break;
+    }
+  }
+  return EFFECT_RUNNING;
+}
+
+/**
+ * @brief an eye bouncing from one end to the other, a new color at every round trip
+ * @param turn pause (ms) at each end
+ */
+effect_t* init_bounce(bounce_t* fx, const CRGB* colors, uint8_t size, uint8_t eye, uint16_t interval,
+                      uint16_t turn, uint32_t duration)
+{
+  init_effect(&fx->effect, render_bounce, interval, duration);
+  fx->palette.colors = colors;
+  fx->palette.size = size;
+  fx->color = pick_color(&fx->palette);
+  fx->eye = eye;
+  fx->turn = turn;
+  fx->position = 0;
+  fx->direction = 1;
+  return &fx->effect;
+}
+
+// ***************************************************
+//                        KITT
+// ***************************************************
+
+static int render_kitt(effect_t* effect, CRGB* leds, int count, uint32_t now)
+{
+  kitt_t* fx = (kitt_t*) effect;
+  int steps = take_steps(effect, now);
+  int center = (count - fx->eye) / 2;
+
+  if (fx->position < 0) fx->position = center;
+  for (int k = 0; k < steps; k++) {
+    fill_solid(leds, count, CRGB::Black);
+    draw_eye(leds, count, fx->position, fx->eye, fx->color, 0);
+    draw_eye(leds, count, count - fx->position, fx->eye, fx->color, 1);
+
+    int end = fx->direction > 0 ? center : 0;
+    if (fx->position != end) {
+      fx->position += fx->direction;
+      continue;
+    }
+
+    // end of a pass: the next one starts where this one ended
+    if (fx->direction != fx->first) fx->color = pick_color(&fx->palette);
+    fx->direction = -fx->direction;
+    pause_effect(effect, fx->turn);
+    break;
+  }
+  return EFFECT_RUNNING;
+}
+
+/**
+ * @brief two eyes moving between the ends and the center, a new color every in and out
+ * @param inward_first true: outside to center then back, false: center to outside then back
+ */
+effect_t* init_kitt(kitt_t* fx, const CRGB* colors, uint8_t size, int inward_first, uint8_t eye,
+                    uint16_t interval, uint16_t turn, uint32_t duration)
+{
+  init_effect(&fx->effect, render_kitt, interval, duration);
+  fx->palette.colors = colors;
+  fx->palette.size = size;
+  fx->color = pick_color(&fx->palette);
+  fx->eye = eye;
+  fx->turn = turn;
+  fx->first = inward_first ? 1 : -1;
+  fx->direction = fx->first;
+  fx->position = inward_first ? 0 : -1;      // -1: the center, set at the first frame
+  return &fx->effect;
+}
+
+// ***************************************************
+//                      TWINKLE
+// ***************************************************
+
+static int render_twinkle(effect_t* effect, CRGB* leds, int count, uint32_t now)
+{
+  twinkle_t* fx = (twinkle_t*) effect;
+
+  if (effect->taken == 0) fill_solid(leds, count, CRGB::Black);
+
+  int steps = take_steps(effect, now);
+  for (int k = 0; k < steps; k++) {
+    // the oldest pixel goes out, a new one comes in
+    set_pixel(leds, count, fx->lit[fx->next], CRGB::Black);
+    fx->lit[fx->next] = random16(count);
+    set_pixel(leds, count, fx->lit[fx->next], fx->color);
+    fx->next = (fx->next + 1) % fx->lit_count;
+  }
+  return EFFECT_RUNNING;
+}
+
+/**
+ * @brief 'lit_count' random pixels lit, one replaced per step
+ */
+effect_t* init_twinkle(twinkle_t* fx, CRGB color, uint8_t lit_count, uint16_t interval, uint32_t duration)
+{
+  init_effect(&fx->effect, render_twinkle, interval, duration);
+  fx->color = color;
+  fx->lit_count = lit_count < 1 ? 1 : (lit_count > TWINKLE_MAX_LIT ? TWINKLE_MAX_LIT : lit_count);
+  fx->next = 0;
+  for (int i = 0; i < TWINKLE_MAX_LIT; i++) fx->lit[i] = -1;
+  return &fx->effect;
+}
+
+// ***************************************************
+//                   RUNNING LIGHTS
+// ***************************************************
+
+static int render_running_lights(effect_t* effect, CRGB* leds, int count, uint32_t now)
+{
+  running_lights_t* fx = (running_lights_t*) effect;
+  int steps = take_steps(effect, now);
+
+  if (steps == 0) return EFFECT_RUNNING;
+
+  // one radian per pixel and per step, red a radian ahead of green, blue one behind
+  fx->position += steps * STRIP_RADIAN;
+  uint16_t phase[3] = { (uint16_t) (fx->position + STRIP_RADIAN), fx->position,
+                        (uint16_t) (fx->position - STRIP_RADIAN) };
+  fill_sine(leds, count, fx->color, phase, STRIP_RADIAN);
+  return EFFECT_RUNNING;
+}
+
+/**
+ * @brief sine waves of the color's components running along the strip
+ */
+effect_t* init_running_lights(running_lights_t* fx, CRGB color, uint16_t interval, uint32_t duration)
+{
+  init_effect(&fx->effect, render_running_lights, interval, duration);
+  fx->color = color;
+  fx->position = 0;
+  return &fx->effect;
+}
+
+// ***************************************************
+//                  CHANGING COLORS
+// ***************************************************
+
+static int render_changing_colors(effect_t* effect, CRGB* leds, int count, uint32_t now)
+{
+  changing_colors_t* fx = (changing_colors_t*) effect;
+  int steps = take_steps(effect, now);
+
+  if (steps == 0) return EFFECT_RUNNING;
+
+  // one radian per pixel, the components drift by 0.1, 0.2 and 0.3 radian per step
+  fill_sine(leds, count, fx->color, fx->phase, STRIP_RADIAN);
+  for (int i = 0; i < 3; i++) {
+    fx->phase[i] += steps * (i + 1) * (STRIP_RADIAN / 10);
+  }
+  return EFFECT_RUNNING;
+}
+
+/**
+ * @brief sine waves of the color's components, drifting at 3 different speeds
+ */
+effect_t* init_changing_colors(changing_colors_t* fx, CRGB color, uint16_t interval, uint32_t duration)
+{
+  init_effect(&fx->effect, render_changing_colors, interval, duration);
+  fx->color = color;
+  fx->phase[0] = fx->phase[1] = fx->phase[2] = 0;
+  return &fx->effect;
+}
+
+// ***************************************************
+//                      RAINBOW
+// ***************************************************
+
+static int render_rainbow(effect_t* effect, CRGB* leds, int count, uint32_t now)
+{
+  rainbow_t* fx = (rainbow_t*) effect;
+  int steps = take_steps(effect, now);
+
+  if (steps == 0) return EFFECT_RUNNING;
+
+  fill_wheel(leds, count, fx->position, fx->shift);
+  fx->position += steps;
+  return EFFECT_RUNNING;
+}
+
+/**
+ * @brief the color wheel spread over the strip, turning one position per step
+ * @param shift intensity scale down (bits)
+ */
+effect_t* init_rainbow(rainbow_t* fx, uint8_t shift, uint16_t interval, uint32_t duration)
+{
+  init_effect(&fx->effect, render_rainbow, interval, duration);
+  fx->shift = shift;
+  fx->position = 0;
+  return &fx->effect;
+}
+
+// ***************************************************
+//                THEATER CHASE RAINBOW
+// ***************************************************
+
+static int render_chase_rainbow(effect_t* effect, CRGB* leds, int count, uint32_t now)
+{
+  chase_rainbow_t* fx = (chase_rainbow_t*) effect;
+  int steps = take_steps(effect, now);
+
+  for (int k = 0; k < steps; k++) {
+    if (fx->position == 256) return EFFECT_DONE;
+
+    fill_solid(leds, count, CRGB::Black);
+    for (int i = 0; i + fx->phase < count; i += 4) {
+      leds[i + fx->phase] = scale_down(wheel((i + fx->position) % 255), fx->shift);
+    }
+    if (++fx->phase == 4) {
+      fx->phase = 0;
+      fx->position++;
+    }
+  }
+  return EFFECT_RUNNING;
+}
+
+/**
+ * @brief every fourth pixel lit with the color wheel, moving; ends after a wheel turn
+ */
+effect_t* init_chase_rainbow(chase_rainbow_t* fx, uint8_t shift, uint16_t interval)
+{
+  init_effect(&fx->effect, render_chase_rainbow, interval, 0);
+  fx->shift = shift;
+  fx->position = 0;
+  fx->phase = 0;
+  return &fx->effect;
+}
+
+// ***************************************************
+//                        FIRE
+// ***************************************************
+
+static int render_fire(effect_t* effect, CRGB* leds, int count, uint32_t now)
+{
+  fire_t* fx = (fire_t*) effect;
+  int steps = take_steps(effect, now);
+  int n = count < EFFECT_MAX_LEDS ? count : EFFECT_MAX_LEDS;
+
+  if (steps == 0) return EFFECT_RUNNING;
+
+  for (int k = 0; k < steps; k++) {
+    // cool down every cell a little
+    uint8_t range = ((fx->cooling * 10) / n) + 2;
+    for (int i = 0; i < n; i++) {
+      fx->heat[i] = qsub8(fx->heat[i], random8(range));
+    }
+
+    // heat from each cell drifts 'up' and diffuses a little
+    for (int i = n - 1; i >= 2; i--) {
+      uint16_t sum = fx->heat[i - 1] + fx->heat[i - 2] + fx->heat[i - 2];
+      fx->heat[i] = (sum * 85 + 128) >> 8;           // sum / 3, without a division
+    }
+
+    // randomly ignite new 'sparks' near the bottom
+    if (random8() < fx->sparking) {
+      uint8_t y = random8(7);
+      fx->heat[y] = fx->heat[y] + random8(160, 255);
+    }
+  }
+
+  if (fx->reversed) fill_heat(leds + count - n, fx->heat, n, 1);
+  else fill_heat(leds, fx->heat, n, 0);
+  return EFFECT_RUNNING;
+}
+
+/**
+ * @brief fire rising from the start of the strip (from its end if reversed)
+ * @param cooling how fast the flames cool down, sparking chance of a new spark (/255)
+ * @details at most EFFECT_MAX_LEDS pixels burn
+ */
+effect_t* init_fire(fire_t* fx, uint8_t cooling, uint8_t sparking, int reversed, uint16_t interval,
+                    uint32_t duration)
+{
+  init_effect(&fx->effect, render_fire, interval, duration);
+  fx->cooling = cooling;
+  fx->sparking = sparking;
+  fx->reversed = reversed;
+  for (int i = 0; i < EFFECT_MAX_LEDS; i++) fx->heat[i] = 0;
+  return &fx->effect;
+}
+
+// ***************************************************
+//                    METEOR RAIN
+// ***************************************************
+
+static int render_meteor(effect_t* effect, CRGB* leds, int count, uint32_t now)
+{
+  meteor_t* fx = (meteor_t*) effect;
+  int steps = take_steps(effect, now);
+
+  for (int k = 0; k < steps; k++) {
+    if (fx->position == 0) fill_solid(leds, count, CRGB::Black);
+
+    // fade the trail (4 pixels out of 10 at random), then draw the meteor
+    if (fx->random_decay) fade_strip_random(leds, count, fx->decay, 102);
+    else fadeToBlackBy(leds, count, fx->decay);
+    for (int j = 0; j < fx->size; j++) {
+      int index = fx->position - j;
+      if (index >= 0 && index < count) leds[fx->reversed ? count - 1 - index : index] = fx->color;
+    }
+
+    // it falls past the end until its trail is gone, then starts over
+    if (++fx->position == 2 * count) fx->position = 0;
+  }
+  return EFFECT_RUNNING;
+}
+
+/**
+ * @brief a meteor of 'size' pixels falling along the strip with a fading trail
+ * @param decay trail fading per step (/256), random_decay true to fade pixels at random
+ */
+effect_t* init_meteor(meteor_t* fx, CRGB color, uint8_t size, uint8_t decay, int random_decay, int reversed,
+                      uint16_t interval, uint32_t duration)
+{
+  init_effect(&fx->effect, render_meteor, interval, duration);
+  fx->color = color;
+  fx->size = size;
+  fx->decay = decay;
+  fx->random_decay = random_decay;
+  fx->reversed = reversed;
+  fx->position = 0;
+  return &fx->effect;
+}
+
+// ***************************************************
+//                TWO COLORS MODULATION
+// ***************************************************
+
+#define NO_COMPONENT          -1
+#define SIN16_MOINS_PI_SUR_2  (65536 >> 2)
+
+static uint16_t random_period()
+{
+  return MODULATION_MIN_PERIOD + random(MODULATION_MAX_PERIOD - MODULATION_MIN_PERIOD);
+}
+
+static int render_modulation(effect_t* effect, CRGB* leds, int count, uint32_t now)
+{
+  modulation_t* fx = (modulation_t*) effect;
+  int steps = take_steps(effect, now);
+
+  if (steps == 0) return EFFECT_RUNNING;
+
+  for (int k = 0; k < steps; k++) {
+    // the first component whose period elapsed goes to rest, the one at rest comes back
+    int to_disable = NO_COMPONENT;
+    for (int i = 0; i < 3; i++) {
+      if (i != fx->disabled) fx->elapsed[i] += effect->interval;
+      if (fx->elapsed[i] > fx->period[i]) {
+        to_disable = i;
+        break;
+      }
+    }
+    if (to_disable != NO_COMPONENT) {
+      fx->period[fx->disabled] = random_period();
+      fx->elapsed[fx->disabled] = 0;
+      fx->period[to_disable] = 0;
+      fx->elapsed[to_disable] = 0;
+      fx->disabled = to_disable;
+    }
+  }
+
+  // (level / 2) * (1 + sin(2 pi elapsed / period + pi / 2))
+  for (int i = 0; i < 3; i++) {
+    if (i == fx->disabled) continue;
+    uint16_t angle = ((uint32_t) fx->elapsed[i] << 16) / fx->period[i] + SIN16_MOINS_PI_SUR_2;
+    fx->color.raw[i] = ((uint32_t) (sin16(angle) + 32768) * (fx->level >> 1)) >> 15;
+  }
+  fill_solid(leds, count, fx->color);
+  return EFFECT_RUNNING;
+}
+
+/**
+ * @brief two of the three color components modulated by sines of random periods, in turn
+ * @param level highest component intensity
+ */
+effect_t* init_modulation(modulation_t* fx, uint8_t level, uint16_t interval, uint32_t duration)
+{
+  init_effect(&fx->effect, render_modulation, interval, duration);
+  fx->color = CRGB::Black;
+  fx->level = level;
+  fx->disabled = 2;
+  for (int i = 0; i < 3; i++) {
+    fx->period[i] = i == fx->disabled ? 0 : random_period();
+    fx->elapsed[i] = 0;
+  }
+  return &fx->effect;
+}
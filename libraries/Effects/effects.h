@@ -0,0 +1,146 @@
+/**
+ * effects.h
+ *
+ * LED strip effects as state machines (see effect.h): the effects of
+ * WS2812_Velo, one step per former delay()
+ *
+ * Author: Vincent Lacasse (lacasse4@yahoo.com)
+ * Date: 2026-10-18
+ * Target system: Arduino Uno
+ *
+ */
+
+#ifndef _EFFECTS_H
+#define _EFFECTS_H
+
+#include "effect.h"
+
+#define EFFECT_MAX_LEDS      64     // longest strip of the fire effect (its heat map)
+#define TWINKLE_MAX_LIT      8      // most pixels lit at once by twinkle
+#define MODULATION_MIN_PERIOD 1000  // shortest period of a modulated component (ms)
+#define MODULATION_MAX_PERIOD 4000  // longest period of a modulated component (ms)
+
+/*
+ * Effects that change color at every cycle pick it at random in a palette.
+ */
+typedef struct palette {
+    const CRGB* colors;
+    uint8_t size;
+} palette_t;
+
+typedef struct flash {
+    effect_t effect;
+    CRGB color;
+    uint8_t flashes;         // on/off flashes before staying on
+} flash_t;
+
+typedef struct theater_chase {
+    effect_t effect;
+    CRGB color;
+    int8_t direction;        // 1: forward, -1: backward
+    uint8_t phase;           // lit pixels are phase, phase + 3, ...
+} theater_chase_t;
+
+typedef struct bounce {
+    effect_t effect;
+    palette_t palette;
+    CRGB color;
+    uint8_t eye;             // full intensity pixels of the eye
+    uint16_t turn;           // pause at each end (ms)
+    int16_t position;
+    int8_t direction;
+} bounce_t;
+
+typedef struct kitt {
+    effect_t effect;
+    palette_t palette;
+    CRGB color;
+    uint8_t eye;
+    uint16_t turn;
+    int16_t position;
+    int8_t direction;        // 1: outside to center, -1: center to outside
+    int8_t first;            // direction of a cycle's first pass
+} kitt_t;
+
+typedef struct twinkle {
+    effect_t effect;
+    CRGB color;
+    uint8_t lit_count;       // pixels lit at once
+    uint8_t next;            // slot of the next pixel to light
+    int16_t lit[TWINKLE_MAX_LIT];
+} twinkle_t;
+
+typedef struct running_lights {
+    effect_t effect;
+    CRGB color;
+    uint16_t position;       // angle of the green wave (see strip.h)
+} running_lights_t;
+
+typedef struct changing_colors {
+    effect_t effect;
+    CRGB color;
+    uint16_t phase[3];       // angles of the components' waves (see strip.h)
+} changing_colors_t;
+
+typedef struct rainbow {
+    effect_t effect;
+    uint8_t shift;           // intensity scale down (bits)
+    uint8_t position;
+} rainbow_t;
+
+typedef struct chase_rainbow {
+    effect_t effect;
+    uint8_t shift;
+    uint16_t position;       // wheel position, the effect ends after 256
+    uint8_t phase;
+} chase_rainbow_t;
+
+typedef struct fire {
+    effect_t effect;
+    uint8_t cooling;
+    uint8_t sparking;
+    uint8_t reversed;
+    uint8_t heat[EFFECT_MAX_LEDS];
+} fire_t;
+
+typedef struct meteor {
+    effect_t effect;
+    CRGB color;
+    uint8_t size;
+    uint8_t decay;
+    uint8_t random_decay;
+    uint8_t reversed;
+    int16_t position;
+} meteor_t;
+
+typedef struct modulation {
+    effect_t effect;
+    CRGB color;
+    uint8_t level;           // highest component intensity
+    uint8_t disabled;        // component at rest
+    uint16_t period[3];      // ms
+    uint16_t elapsed[3];     // ms
+} modulation_t;
+
+CRGB pick_color(palette_t* palette);
+CRGB wheel(uint8_t position);
+
+effect_t* init_flash(flash_t* fx, CRGB color, uint8_t flashes, uint16_t interval, uint32_t duration);
+effect_t* init_theater_chase(theater_chase_t* fx, CRGB color, int direction, uint16_t interval,
+                             uint32_t duration);
+effect_t* init_bounce(bounce_t* fx, const CRGB* colors, uint8_t size, uint8_t eye, uint16_t interval,
+                      uint16_t turn, uint32_t duration);
+effect_t* init_kitt(kitt_t* fx, const CRGB* colors, uint8_t size, int inward_first, uint8_t eye,
+                    uint16_t interval, uint16_t turn, uint32_t duration);
+effect_t* init_twinkle(twinkle_t* fx, CRGB color, uint8_t lit_count, uint16_t interval, uint32_t duration);
+effect_t* init_running_lights(running_lights_t* fx, CRGB color, uint16_t interval, uint32_t duration);
+effect_t* init_changing_colors(changing_colors_t* fx, CRGB color, uint16_t interval, uint32_t duration);
+effect_t* init_rainbow(rainbow_t* fx, uint8_t shift, uint16_t interval, uint32_t duration);
+effect_t* init_chase_rainbow(chase_rainbow_t* fx, uint8_t shift, uint16_t interval);
+effect_t* init_fire(fire_t* fx, uint8_t cooling, uint8_t sparking, int reversed, uint16_t interval,
+                    uint32_t duration);
+effect_t* init_meteor(meteor_t* fx, CRGB color, uint8_t size, uint8_t decay, int random_decay, int reversed,
+                      uint16_t interval, uint32_t duration);
+effect_t* init_modulation(modulation_t* fx, uint8_t level, uint16_t interval, uint32_t duration);
+
+#endif
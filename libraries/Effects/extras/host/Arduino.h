@@ -0,0 +1,79 @@
+/**
+ * Arduino.h
+ *
+ * Minimal Arduino core shim used to build the Effects library on a
+ * Linux host. Only what the effects, the scheduler and the host tools use
+ * is provided.
+ *
+ * Author: Vincent Lacasse (lacasse4@yahoo.com)
+ * Date: 2026-10-18
+ * Target system: Linux (host)
+ *
+ */
+
+#ifndef _HOST_ARDUINO_H
+#define _HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+/**
+ * @brief clock source
+ * @details micros() and millis() read the monotonic clock, or the function
+ * @details registered with set_clock_source() (a simulated clock, see sim_strip.h).
+ */
+typedef unsigned long (*clock_source_t)();
+
+inline clock_source_t* clock_source()
+{
+  static clock_source_t source = NULL;
+  return &source;
+}
+
+inline void set_clock_source(clock_source_t source)
+{
+  *clock_source() = source;
+}
+
+/**
+ * @brief microseconds elapsed since an arbitrary origin
+ */
+inline unsigned long micros()
+{
+  clock_source_t source = *clock_source();
+  if (source) return source();
+
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (unsigned long)(ts.tv_sec * 1000000UL + ts.tv_nsec / 1000);
+}
+
+/**
+ * @brief milliseconds elapsed since an arbitrary origin
+ */
+inline unsigned long millis()
+{
+  return micros() / 1000;
+}
+
+/**
+ * @brief random number in [0, howbig), as the Arduino core's (0 if howbig is 0)
+ */
+inline long random(long howbig)
+{
+  return howbig > 0 ? ::random() % howbig : 0;
+}
+
+inline long random(long howsmall, long howbig)
+{
+  return howsmall >= howbig ? howsmall : howsmall + random(howbig - howsmall);
+}
+
+#endif
@@ -0,0 +1,33 @@
+/**
+ * FastLED.h
+ *
+ * FastLED shim used to build the Effects library on a Linux host: FastLED
+ * knows no host platform, so this header stands for its FastLED.h and
+ * brings in the platform independent parts only (CRGB, lib8tion in plain
+ * C, the color utilities).  FastLED's own sources are compiled with this
+ * header forced in first (see the Makefile) and fastled_host.cpp holds
+ * what a sketch would define.
+ *
+ * Author: Vincent Lacasse (lacasse4@yahoo.com)
+ * Date: 2026-10-18
+ * Target system: Linux (host)
+ *
+ */
+
+#ifndef __INC_FASTSPI_LED2_H
+#define __INC_FASTSPI_LED2_H
+#define __INC_LED_SYSDEFS_H         // no platform: lib8tion uses its C versions
+
+#include <stdint.h>
+#include <string.h>
+#include <Arduino.h>
+
+#define FASTLED_NAMESPACE_BEGIN
+#define FASTLED_NAMESPACE_END
+#define FASTLED_USING_NAMESPACE
+
+#include "../../../FastLED/src/fastled_config.h"
+#include "../../../FastLED/src/pixeltypes.h"
+#include "../../../FastLED/src/colorutils.h"
+
+#endif
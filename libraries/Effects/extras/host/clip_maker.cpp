@@ -0,0 +1,382 @@
+/**
+ * clip_maker.cpp
+ *
+ * Renders an effect offline into a clip (clip.h): its frames, one per step,
+ * coded against the frame before as runs of unchanged, single color and
+ * copied pixels.  The clip is decoded back with the library's player and
+ * compared with the frames rendered, then written as a C header holding
+ * the clip in flash (-o).  The tool prints the clip's size and the host
+ * cycles of a frame rendered live and of a frame decoded.
+ *
+ * Author: Vincent Lacasse (lacasse4@yahoo.com)
+ * Date: 2026-10-18
+ * Target system: Linux (host)
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <unistd.h>
+#include <x86intrin.h>
+#include <FastLED.h>
+#include <effects.h>
+#include <clip.h>
+
+// WS2812_Velo's parameters (full range: the dither layer scales the strip down)
+#define NUM_LEDS                40
+#define FULL_INTENSITY          255
+#define THEATER_CHASE_DELAY     50
+#define KITT_EYE_SIZE           6
+#define KITT_SPEED_DELAY        10
+#define KITT_RETURN_DELAY       50
+#define RUNNING_LIGHTS_DELAY    100
+#define RAINBOW_CYCLE_DELAY     10
+#define FIRE_COOLING            55
+#define FIRE_SPARKING           120
+#define FIRE_DELAY              15
+#define METEOR_SIZE             5
+#define METEOR_DECAY            64
+#define METEOR_DELAY            30
+
+#define MAX_LEDS                1000
+#define MAX_FRAMES              10000
+#define SEED                    1
+#define BYTES_PER_LINE          16
+#define NAME_SIZE               64
+
+typedef union effect_slot {
+    kitt_t kitt;
+    running_lights_t running_lights;
+    rainbow_t rainbow;
+    chase_rainbow_t chase_rainbow;
+    fire_t fire;
+    meteor_t meteor;
+} effect_slot_t;
+
+typedef effect_t* (*start_t)(effect_slot_t* s);
+
+typedef struct source {
+    const char* name;
+    start_t start;
+} source_t;
+
+static const CRGB red = CRGB::Red;
+
+static effect_t* kitt(effect_slot_t* s)
+{
+  return init_kitt(&s->kitt, &red, 1, 1, KITT_EYE_SIZE, KITT_SPEED_DELAY, KITT_RETURN_DELAY, 0);
+}
+
+static effect_t* running_lights(effect_slot_t* s)
+{
+  return init_running_lights(&s->running_lights, CRGB::Grey, RUNNING_LIGHTS_DELAY, 0);
+}
+
+static effect_t* rainbow_cycle(effect_slot_t* s)
+{
+  return init_rainbow(&s->rainbow, 0, RAINBOW_CYCLE_DELAY, 0);
+}
+
+static effect_t* theater_chase_rainbow(effect_slot_t* s)
+{
+  return init_chase_rainbow(&s->chase_rainbow, 0, THEATER_CHASE_DELAY);
+}
+
+static effect_t* fire(effect_slot_t* s)
+{
+  return init_fire(&s->fire, FIRE_COOLING, FIRE_SPARKING, 0, FIRE_DELAY, 0);
+}
+
+static effect_t* meteor_rain(effect_slot_t* s)
+{
+  return init_meteor(&s->meteor, CRGB(FULL_INTENSITY, FULL_INTENSITY, FULL_INTENSITY), METEOR_SIZE, METEOR_DECAY,
+                     1, 0, METEOR_DELAY, 0);
+}
+
+static const source_t sources[] = {
+  { "kitt",                  kitt },
+  { "running_lights",        running_lights },
+  { "rainbow_cycle",         rainbow_cycle },
+  { "theater_chase_rainbow", theater_chase_rainbow },
+  { "fire",                  fire },
+  { "meteor_rain",           meteor_rain },
+};
+#define SOURCES ((int) (sizeof(sources) / sizeof(sources[0])))
+
+static int num_leds = NUM_LEDS;
+static int duration = 2000;
+static const char* header_path = NULL;
+
+static CRGB* rendered = NULL;            // all frames rendered, num_leds pixels each
+static CRGB decoded[MAX_LEDS];
+static uint8_t* clip = NULL;
+static effect_slot_t slot;
+
+/**
+ * @brief pixels from 'i' on (at most CLIP_MAX_RUN) unchanged since the previous frame
+ */
+static int run_unchanged(const CRGB* previous, const CRGB* frame, int i, int count)
+{
+  int n = 0;
+  while (i + n < count && n < CLIP_MAX_RUN && frame[i + n] == previous[i + n]) n++;
+  return n;
+}
+
+/**
+ * @brief pixels from 'i' on (at most CLIP_MAX_RUN) of the color of pixel 'i'
+ */
+static int run_color(const CRGB* frame, int i, int count)
+{
+  int n = 1;
+  while (i + n < count && n < CLIP_MAX_RUN && frame[i + n] == frame[i]) n++;
+  return n;
+}
+
+/**
+ * @brief code 'frame' against 'previous' into 'out'
+ * @returns the bytes written (at most count * 3 + count / CLIP_MAX_RUN + 1)
+ * @details greedy: unchanged pixels are skipped, a color repeated (or a
+ * @details black pixel) is a run, the rest is copied.  A copy stops where
+ * @details a skip or a run costs less than copying on.
+ */
+static int encode_frame(const CRGB* previous, const CRGB* frame, int count, uint8_t* out)
+{
+  int size = 0;
+  int i = 0;
+
+  while (i < count) {
+    int n = run_unchanged(previous, frame, i, count);
+    if (n > 0) {
+      out[size++] = CLIP_SKIP | (n - 1);
+      i += n;
+      continue;
+    }
+
+    n = run_color(frame, i, count);
+    if (!frame[i]) {
+      out[size++] = CLIP_BLACK | (n - 1);
+      i += n;
+      continue;
+    }
+    if (n >= 2) {
+      out[size++] = CLIP_FILL | (n - 1);
+      out[size++] = frame[i].r;
+      out[size++] = frame[i].g;
+      out[size++] = frame[i].b;
+      i += n;
+      continue;
+    }
+
+    int op = size++;
+    n = 0;
+    do {
+      out[size++] = frame[i].r;
+      out[size++] = frame[i].g;
+      out[size++] = frame[i].b;
+      i++;
+      n++;
+    } while (i < count && n < CLIP_MAX_RUN && frame[i] != previous[i] && frame[i] && run_color(frame, i, count) < 2);
+    out[op] = CLIP_COPY | (n - 1);
+  }
+  return size;
+}
+
+static void write_word(uint8_t* out, uint16_t word)
+{
+  out[0] = word & 0xFF;
+  out[1] = word >> 8;
+}
+
+/**
+ * @brief render the effect, one frame per step, for 'duration' ms (or until it ends)
+ * @returns the frames rendered
+ */
+static int render(const source_t* source, uint16_t* interval)
+{
+  srandom(SEED);
+  random16_set_seed(SEED);
+
+  effect_t* effect = source->start(&slot);
+  int count = 0;
+  CRGB* leds = decoded;
+
+  *interval = effect->interval;
+  memset(leds, 0, num_leds * sizeof(CRGB));
+  for (uint32_t now = 0; now < (uint32_t) duration && count < MAX_FRAMES; now += *interval) {
+    if (render_effect(effect, leds, num_leds, now) == EFFECT_DONE) break;
+    memcpy(&rendered[(size_t) count * num_leds], leds, num_leds * sizeof(CRGB));
+    count++;
+  }
+  return count;
+}
+
+/**
+ * @brief code the frames into 'clip'
+ * @returns the clip's size (bytes), header included
+ */
+static int encode(int count, uint16_t interval, int* largest)
+{
+  CRGB* black = (CRGB*) calloc(num_leds, sizeof(CRGB));
+  int size = CLIP_HEADER_SIZE;
+
+  write_word(clip, num_leds);
+  write_word(clip + 2, count);
+  write_word(clip + 4, interval);
+  *largest = 0;
+  for (int f = 0; f < count; f++) {
+    const CRGB* previous = f == 0 ? black : &rendered[(size_t) (f - 1) * num_leds];
+    int n = encode_frame(previous, &rendered[(size_t) f * num_leds], num_leds, clip + size);
+    if (n > *largest) *largest = n;
+    size += n;
+  }
+  free(black);
+  return size;
+}
+
+/**
+ * @brief decode the clip with the player's decoder and compare it with the frames rendered
+ * @returns the first frame differing, or 'count' if none
+ */
+static int verify(int count)
+{
+  const uint8_t* data = clip + CLIP_HEADER_SIZE;
+
+  memset(decoded, 0, num_leds * sizeof(CRGB));
+  for (int f = 0; f < count; f++) {
+    data = decode_clip_frame(data, decoded, num_leds, num_leds);
+    if (memcmp(decoded, &rendered[(size_t) f * num_leds], num_leds * sizeof(CRGB)) != 0) return f;
+  }
+  return count;
+}
+
+/**
+ * @brief host cycles per frame: the effect rendered live, and the clip decoded
+ */
+static void time_frames(const source_t* source, int count, double* live, double* decode)
+{
+  effect_t* effect = source->start(&slot);
+  uint16_t interval = effect->interval;
+
+  memset(decoded, 0, num_leds * sizeof(CRGB));
+  unsigned long long start = __rdtsc();
+  for (int f = 0; f < count; f++) {
+    render_effect(effect, decoded, num_leds, f * interval);
+  }
+  *live = (double) (__rdtsc() - start) / count;
+
+  const uint8_t* data = clip + CLIP_HEADER_SIZE;
+  start = __rdtsc();
+  for (int f = 0; f < count; f++) {
+    data = decode_clip_frame(data, decoded, num_leds, num_leds);
+  }
+  *decode = (double) (__rdtsc() - start) / count;
+}
+
+/**
+ * @brief write the clip as a C header: a FL_PROGMEM array named <name>_clip
+ * @returns 1 if OK, 0 on failure
+ */
+static int write_header(const char* path, const char* name, int size, int count, uint16_t interval)
+{
+  FILE* file = fopen(path, "w");
+  if (file == NULL) return 0;
+
+  fprintf(file, "/**\n * %s_clip.h\n *\n", name);
+  fprintf(file, " * Clip of the %s effect: %d pixels, %d frames every %u ms, %d bytes\n", name, num_leds, count,
+          interval, size);
+  fprintf(file, " * Made by libraries/Effects/extras/host/clip_maker, do not edit\n *\n */\n\n");
+  char guard[NAME_SIZE];
+  int n = 0;
+  for (; name[n] != '\0' && n < NAME_SIZE - 1; n++) guard[n] = toupper(name[n]);
+  guard[n] = '\0';
+  fprintf(file, "#ifndef _%s_CLIP_H\n#define _%s_CLIP_H\n\n#include <FastLED.h>\n\n", guard, guard);
+  fprintf(file, "const uint8_t %s_clip[] FL_PROGMEM = {", name);
+  for (int i = 0; i < size; i++) {
+    if (i % BYTES_PER_LINE == 0) fprintf(file, "\n ");
+    fprintf(file, " 0x%02x,", clip[i]);
+  }
+  fprintf(file, "\n};\n\n#endif\n");
+  return fclose(file) == 0;
+}
+
+/**
+ * @brief make the clip of an effect and print its statistics
+ * @returns 1 if OK, 0 on failure
+ */
+static int make_clip(const source_t* source)
+{
+  uint16_t interval;
+  int largest;
+  int count = render(source, &interval);
+  int size = encode(count, interval, &largest);
+  int good = verify(count);
+  double live;
+  double decode;
+
+  time_frames(source, count, &live, &decode);
+
+  long raw = (long) count * num_leds * 3;
+  printf("%-22s %6d %5u %8ld %8d %6.1f%% %8.1f %7d %10.0f %10.0f  %s\n", source->name, count, interval, raw, size,
+         100.0 * size / raw, (double) (size - CLIP_HEADER_SIZE) / count, largest, live, decode,
+         good == count ? "ok" : "DIFFERS");
+  if (good != count) {
+    fprintf(stderr, "%s: frame %d decodes differently\n", source->name, good);
+    return 0;
+  }
+
+  if (header_path != NULL && !write_header(header_path, source->name, size, count, interval)) {
+    fprintf(stderr, "cannot write %s\n", header_path);
+    return 0;
+  }
+  return 1;
+}
+
+static void usage(const char* name)
+{
+  fprintf(stderr, "usage: %s [-e effect [-o header]] [-l leds] [-t duration_ms]\n", name);
+  fprintf(stderr, "effects:");
+  for (int i = 0; i < SOURCES; i++) fprintf(stderr, " %s", sources[i].name);
+  fprintf(stderr, "\n");
+  exit(1);
+}
+
+int main(int argc, char* argv[])
+{
+  const char* only = NULL;
+  int opt;
+
+  while ((opt = getopt(argc, argv, "e:o:l:t:")) != -1) {
+    switch (opt) {
+      case 'e': only = optarg; break;
+      case 'o': header_path = optarg; break;
+      case 'l': num_leds = atoi(optarg); break;
+      case 't': duration = atoi(optarg); break;
+      default: usage(argv[0]);
+    }
+  }
+  if (num_leds < 1 || num_leds > MAX_LEDS || duration < 1 || (header_path != NULL && only == NULL)) usage(argv[0]);
+
+  rendered = (CRGB*) malloc((size_t) MAX_FRAMES * num_leds * sizeof(CRGB));
+  clip = (uint8_t*) malloc(CLIP_HEADER_SIZE + (size_t) MAX_FRAMES * (num_leds * 3 + num_leds / CLIP_MAX_RUN + 1));
+  if (rendered == NULL || clip == NULL) {
+    fprintf(stderr, "out of memory\n");
+    return 1;
+  }
+
+  printf("Clips of %d leds, %d ms at most (raw: 3 bytes per pixel per frame)\n", num_leds, duration);
+  printf("(live, decode: host cycles per frame, the effect rendered or the clip decoded)\n\n");
+  printf("%-22s %6s %5s %8s %8s %7s %8s %7s %10s %10s  %s\n", "effect", "frames", "ms", "raw", "clip", "ratio",
+         "B/frame", "largest", "live", "decode", "verify");
+
+  int failed = 0;
+  int ran = 0;
+  for (int i = 0; i < SOURCES; i++) {
+    if (only != NULL && strcmp(only, sources[i].name) != 0) continue;
+    if (!make_clip(&sources[i])) failed++;
+    ran++;
+  }
+  if (ran == 0) usage(argv[0]);
+  return failed > 0 ? 1 : 0;
+}
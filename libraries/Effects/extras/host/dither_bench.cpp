@@ -0,0 +1,216 @@
+/**
+ * dither_bench.cpp
+ *
+ * Host measure of a slow fade on WS2812_Velo's strip (MAX_INTENSITY 16,
+ * TypicalLEDStrip color correction): a full white strip fades out, a
+ * frame every 10 ms, sent
+ *   former    scaled down by 2^4, then FastLED.show(level) corrects the colors
+ *   fastled   through the dither layer refreshed every -r us, then FastLED
+ *             corrects the dithered colors
+ *   dither    through the dither layer correcting the colors, new frames only
+ *   refresh   the same, refreshed every -r us (the sketch's)
+ *   max       the same, refreshed back to back (wire time)
+ * FastLED's correction is modeled as its show() applies it: each channel
+ * scaled by scale8() with (correction + 1) * level / 256.
+ *
+ * The eye averages the strip over a short window (-w ms).  For every
+ * window, the mean of each channel is compared with the level it should
+ * show; between windows, the largest change of a channel is its stair
+ * step.  Both are in strip levels (0..16).  Below one level, the light
+ * sent is compared with the light due: the lowest levels are those the
+ * dither is for.
+ *
+ * Author: Vincent Lacasse (lacasse4@yahoo.com)
+ * Date: 2026-10-18
+ * Target system: Linux (host)
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <unistd.h>
+#include <FastLED.h>
+#include <dither.h>
+#include "sim_strip.h"
+
+#define NUM_LEDS        40          // WS2812_Velo's
+#define SCALE_DOWN_SHIFT 4
+#define MAX_INTENSITY   (256 >> SCALE_DOWN_SHIFT)
+#define FRAME_US        10000
+#define STEP_US         10          // simulated time step
+
+#define PATH_FORMER     0           // no dither, FastLED corrects
+#define PATH_FASTLED    1           // dither, FastLED corrects
+#define PATH_DITHER     2           // dither correcting
+
+typedef struct window {
+    double sum[3 * NUM_LEDS];     // channels sent during the window
+    double mean[3 * NUM_LEDS];    // of the last window
+    double ideal[3];              // sum of the ideal channels at each send
+    int sends;
+    int windows;
+    double error;                 // largest |mean - ideal|
+    double step;                  // largest change of a mean between windows
+    double low_sent;              // light sent in windows due less than a level
+    double low_due;               // light due in those windows
+} window_t;
+
+static int fade_ms = 2000;
+static int window_ms = 20;
+static int refresh_us = 2 * (NUM_LEDS * WS2812_LED_US + WS2812_RESET_US);
+
+static const CRGB correction = TypicalLEDStrip;
+static CRGB leds[NUM_LEDS];
+static CRGB frame[NUM_LEDS];
+static uint8_t dither_error[3 * NUM_LEDS];
+static window_t window;
+static uint8_t level;
+static int fastled_corrects;
+static unsigned long sends;
+
+/**
+ * @brief the channel 'c' a white pixel should show at 'level' (strip levels)
+ */
+static double ideal(uint8_t level, int c)
+{
+  if (level == 0) return 0.0;
+  return 255.0 * MAX_INTENSITY / 256.0 * (level + 1) / 256.0 * (correction.raw[c] + 1) / 256.0;
+}
+
+/**
+ * @brief close the window: compare its means with the ideal and the previous window
+ */
+static void close_window(window_t* w)
+{
+  if (w->sends == 0) return;
+
+  for (int i = 0; i < NUM_LEDS; i++) {
+    for (int c = 0; c < 3; c++) {
+      int k = 3 * i + c;
+      double target = w->ideal[c] / w->sends;
+      double mean = w->sum[k] / w->sends;
+      w->error = fmax(w->error, fabs(mean - target));
+      if (w->windows > 0) w->step = fmax(w->step, fabs(mean - w->mean[k]));
+      if (target > 0.0 && target < 1.0) {
+        w->low_sent += mean;
+        w->low_due += target;
+      }
+      w->mean[k] = mean;
+      w->sum[k] = 0;
+    }
+  }
+  for (int c = 0; c < 3; c++) w->ideal[c] = 0;
+  w->sends = 0;
+  w->windows++;
+}
+
+/**
+ * @brief the strip's show: adds the frame sent to the window
+ * @details with fastled_corrects, the colors are corrected as FastLED.show(level) does
+ */
+static void capture(void* context, uint8_t show_level)
+{
+  window_t* w = (window_t*) context;
+  const uint8_t* channels = (const uint8_t*) leds;
+  uint8_t scale[3];
+
+  for (int c = 0; c < 3; c++) {
+    uint8_t factor = fastled_corrects ? correction.raw[c] : 255;
+    scale[c] = (uint32_t) (factor + 1) * 256 * show_level / 0x10000;
+    w->ideal[c] += ideal(level, c);
+  }
+  for (int k = 0; k < 3 * NUM_LEDS; k++) {
+    w->sum[k] += scale8(channels[k], scale[k % 3]);
+  }
+  w->sends++;
+  sends++;
+}
+
+/**
+ * @brief fade a white strip out over fade_ms
+ * @param path PATH_FORMER, PATH_FASTLED or PATH_DITHER
+ * @param refresh dither refresh interval (us), 0 for new frames only
+ */
+static void run(const char* name, int path, int refresh)
+{
+  dither_t dither;
+  unsigned long fade_us = fade_ms * 1000UL;
+  unsigned long next_frame = 0;
+  unsigned long next_window = window_ms * 1000UL;
+  int dithered = path != PATH_FORMER;
+
+  memset(&window, 0, sizeof(window));
+  sends = 0;
+  fastled_corrects = path != PATH_DITHER;
+  start_sim_clock();
+
+  fill_solid(frame, NUM_LEDS, CRGB::White);
+  if (dithered) {
+    init_dither(&dither, frame, leds, dither_error, NUM_LEDS, MAX_INTENSITY, refresh, capture, &window);
+    if (path == PATH_DITHER) set_dither_correction(&dither, correction);
+  }
+  else {
+    fill_solid(leds, NUM_LEDS, CRGB::White);
+    nscale8(leds, NUM_LEDS, 255 >> SCALE_DOWN_SHIFT);
+  }
+
+  while (get_sim_clock() < fade_us) {
+    unsigned long now = get_sim_clock();
+    if (now >= next_window) {
+      close_window(&window);
+      next_window += window_ms * 1000UL;
+    }
+    if (now >= next_frame) {
+      level = 255 - 255 * now / fade_us;
+      if (dithered) dither_show(&dither, level);
+      else capture(&window, level);
+      next_frame += FRAME_US;
+    }
+    else if (dithered) {
+      refresh_dither(&dither, now);
+    }
+    advance_sim_clock(STEP_US);
+  }
+  close_window(&window);
+
+  unsigned long wire = sends * wire_time_us(NUM_LEDS);
+  printf("%-8s %9d %10.1f %6.1f%% %9.3f %9.3f %6.0f%%\n", name, refresh, sends * 1e6 / fade_us,
+         100.0 * wire / fade_us, window.error, window.step,
+         window.low_due > 0.0 ? 100.0 * window.low_sent / window.low_due : 0.0);
+}
+
+static void usage(const char* name)
+{
+  fprintf(stderr, "usage: %s [-f fade_ms] [-w window_ms] [-r refresh_us]\n", name);
+  exit(1);
+}
+
+int main(int argc, char* argv[])
+{
+  int opt;
+
+  while ((opt = getopt(argc, argv, "f:w:r:")) != -1) {
+    switch (opt) {
+      case 'f': fade_ms = atoi(optarg); break;
+      case 'w': window_ms = atoi(optarg); break;
+      case 'r': refresh_us = atoi(optarg); break;
+      default: usage(argv[0]);
+    }
+  }
+  if (fade_ms < 1 || window_ms < 1 || refresh_us < 1 || refresh_us > UINT16_MAX) usage(argv[0]);
+
+  printf("Fade of a white strip: %d leds at %d/256, TypicalLEDStrip, %d ms, a frame every %d ms, %d ms windows\n",
+         NUM_LEDS, MAX_INTENSITY, fade_ms, FRAME_US / 1000, window_ms);
+  printf("(error: largest distance from the ideal level, step: largest change between windows, in strip levels;\n"
+         " low: light sent / light due below one level)\n\n");
+  printf("%-8s %9s %10s %7s %9s %9s %7s\n", "path", "refresh", "sends/s", "wire", "error", "step", "low");
+
+  run("former", PATH_FORMER, 0);
+  run("fastled", PATH_FASTLED, refresh_us);
+  run("dither", PATH_DITHER, 0);
+  run("refresh", PATH_DITHER, refresh_us);
+  run("max", PATH_DITHER, wire_time_us(NUM_LEDS));
+  return 0;
+}
@@ -0,0 +1,20 @@
+/**
+ * fastled_host.cpp
+ *
+ * What FastLED expects from the sketch, for the host build (see FastLED.h)
+ *
+ * Author: Vincent Lacasse (lacasse4@yahoo.com)
+ * Date: 2026-10-18
+ * Target system: Linux (host)
+ *
+ */
+
+#include <FastLED.h>
+
+/**
+ * @brief pixel index of (x, y) for the 2D functions of colorutils (unused: strips are 1D)
+ */
+uint16_t XY(uint8_t x, uint8_t y)
+{
+  return x;
+}
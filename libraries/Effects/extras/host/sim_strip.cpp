@@ -0,0 +1,258 @@
+/**
+ * sim_strip.cpp
+ *
+ * Simulated WS2812 strip for the host: captures every frame shown, times
+ * them with a wire model on a simulated clock, writes them as PPM images
+ * and compares them with golden frames
+ *
+ * Author: Vincent Lacasse (lacasse4@yahoo.com)
+ * Date: 2026-10-18
+ * Target system: Linux (host)
+ *
+ */
+
+/*
+ * sim_show() stands for FastLED.show(level): it keeps the frame as sent,
+ * every channel scaled by the level (FastLED's color correction and
+ * dithering are left out), then moves the simulated clock by the time the
+ * frame takes on the wire.  On the Uno, show() blocks for that time (with
+ * the interrupts off): the scheduler sees it in its frame times.
+ * Rendering itself takes no simulated time.
+ *
+ * A golden file is text, one line per frame: its number, its time (ms)
+ * and the FNV-1a hash of its bytes.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sim_strip.h"
+
+#define FNV_OFFSET   2166136261u
+#define FNV_PRIME    16777619u
+#define PPM_WIDTH    4           // image pixels per LED
+#define LINE_SIZE    256
+
+struct sim_strip {
+    CRGB* leds;              // the buffer shown
+    int count;
+    CRGB* frames;            // captured frames, count pixels each
+    unsigned long* times;    // time of each frame (us)
+    int frame_count;
+    int capacity;            // frames
+    unsigned long wire_us;   // wire time of all frames
+};
+
+static unsigned long sim_clock_us = 0;
+
+static unsigned long read_sim_clock()
+{
+  return sim_clock_us;
+}
+
+/**
+ * @brief time to send a frame of 'count' LEDs, latch included (us)
+ */
+unsigned long wire_time_us(int count)
+{
+  return (unsigned long) count * WS2812_LED_US + WS2812_RESET_US;
+}
+
+/**
+ * @brief start the simulated clock at 0: micros() and millis() read it from now on
+ */
+void start_sim_clock()
+{
+  sim_clock_us = 0;
+  set_clock_source(read_sim_clock);
+}
+
+void advance_sim_clock(unsigned long us)
+{
+  sim_clock_us += us;
+}
+
+unsigned long get_sim_clock()
+{
+  return sim_clock_us;
+}
+
+/**
+ * @brief create a strip capturing the frames of 'leds' ('count' pixels)
+ * @param capacity frames reserved (the capture grows as needed)
+ * @returns the strip, NULL if out of memory
+ */
+sim_strip_t* create_sim_strip(CRGB* leds, int count, int capacity)
+{
+  sim_strip_t* strip = (sim_strip_t*) calloc(1, sizeof(sim_strip_t));
+  if (strip == NULL) return NULL;
+
+  strip->leds = leds;
+  strip->count = count;
+  strip->capacity = capacity > 0 ? capacity : 1;
+  strip->frames = (CRGB*) malloc((size_t) strip->capacity * count * sizeof(CRGB));
+  strip->times = (unsigned long*) malloc(strip->capacity * sizeof(unsigned long));
+  if (strip->frames == NULL || strip->times == NULL) {
+    delete_sim_strip(strip);
+    return NULL;
+  }
+  return strip;
+}
+
+void delete_sim_strip(sim_strip_t* strip)
+{
+  if (strip == NULL) return;
+  free(strip->frames);
+  free(strip->times);
+  free(strip);
+}
+
+/**
+ * @brief FastLED.show(level) on the simulated strip ('context' is the sim_strip_t)
+ * @details the scheduler's show callback (see scheduler.h)
+ */
+void sim_show(void* context, uint8_t level)
+{
+  sim_strip_t* strip = (sim_strip_t*) context;
+
+  if (strip->frame_count == strip->capacity) {
+    int capacity = 2 * strip->capacity;
+    CRGB* frames = (CRGB*) realloc(strip->frames, (size_t) capacity * strip->count * sizeof(CRGB));
+    unsigned long* times = (unsigned long*) realloc(strip->times, capacity * sizeof(unsigned long));
+    if (frames != NULL) strip->frames = frames;
+    if (times != NULL) strip->times = times;
+    if (frames == NULL || times == NULL) {
+      fprintf(stderr, "sim_strip: out of memory, frame %d not captured\n", strip->frame_count);
+      advance_sim_clock(wire_time_us(strip->count));
+      return;
+    }
+    strip->capacity = capacity;
+  }
+
+  CRGB* frame = &strip->frames[(size_t) strip->frame_count * strip->count];
+  for (int i = 0; i < strip->count; i++) {
+    frame[i] = strip->leds[i];
+    frame[i].nscale8(level);
+  }
+  strip->times[strip->frame_count++] = sim_clock_us;
+
+  strip->wire_us += wire_time_us(strip->count);
+  advance_sim_clock(wire_time_us(strip->count));
+}
+
+int get_sim_frame_count(sim_strip_t* strip)
+{
+  return strip->frame_count;
+}
+
+const CRGB* get_sim_frame(sim_strip_t* strip, int frame)
+{
+  return &strip->frames[(size_t) frame * strip->count];
+}
+
+unsigned long get_sim_frame_time(sim_strip_t* strip, int frame)
+{
+  return strip->times[frame];
+}
+
+unsigned long get_sim_wire_us(sim_strip_t* strip)
+{
+  return strip->wire_us;
+}
+
+/**
+ * @brief FNV-1a hash of a frame's bytes
+ */
+uint32_t get_sim_frame_hash(sim_strip_t* strip, int frame)
+{
+  const CRGB* pixels = get_sim_frame(strip, frame);
+  uint32_t hash = FNV_OFFSET;
+
+  for (int i = 0; i < strip->count; i++) {
+    for (int c = 0; c < 3; c++) {
+      hash = (hash ^ pixels[i].raw[c]) * FNV_PRIME;
+    }
+  }
+  return hash;
+}
+
+/**
+ * @brief write all frames as one PPM image, a row of LEDs per frame (time goes down)
+ * @param gain channel multiplier (the strip runs dim)
+ * @returns 1 if OK, 0 on failure
+ */
+int write_sim_ppm(sim_strip_t* strip, const char* path, int gain)
+{
+  FILE* file = fopen(path, "wb");
+  if (file == NULL) return 0;
+
+  fprintf(file, "P6\n%d %d\n255\n", strip->count * PPM_WIDTH, strip->frame_count);
+  for (int f = 0; f < strip->frame_count; f++) {
+    const CRGB* pixels = get_sim_frame(strip, f);
+    for (int i = 0; i < strip->count; i++) {
+      uint8_t rgb[3];
+      for (int c = 0; c < 3; c++) {
+        int value = pixels[i].raw[c] * gain;
+        rgb[c] = value > 255 ? 255 : value;
+      }
+      for (int x = 0; x < PPM_WIDTH; x++) fwrite(rgb, 1, 3, file);
+    }
+  }
+  return fclose(file) == 0;
+}
+
+/**
+ * @brief write the frames' golden file
+ * @returns 1 if OK, 0 on failure
+ */
+int write_golden(sim_strip_t* strip, const char* path, const char* name)
+{
+  FILE* file = fopen(path, "w");
+  if (file == NULL) return 0;
+
+  fprintf(file, "# %s %d leds %d frames\n", name, strip->count, strip->frame_count);
+  for (int f = 0; f < strip->frame_count; f++) {
+    fprintf(file, "%d %lu %08x\n", f, strip->times[f] / 1000, get_sim_frame_hash(strip, f));
+  }
+  return fclose(file) == 0;
+}
+
+/**
+ * @brief compare the frames with a golden file
+ * @param first_difference first frame differing (time or pixels), or frame count differing
+ * @returns GOLDEN_MATCH, GOLDEN_MISMATCH or GOLDEN_MISSING (no file, or another strip length)
+ */
+int compare_golden(sim_strip_t* strip, const char* path, int* first_difference)
+{
+  FILE* file = fopen(path, "r");
+  if (file == NULL) return GOLDEN_MISSING;
+
+  char line[LINE_SIZE];
+  char name[LINE_SIZE];
+  int count = 0;
+  int frames = 0;
+  if (fgets(line, sizeof(line), file) == NULL ||
+      sscanf(line, "# %255s %d leds %d frames", name, &count, &frames) != 3 || count != strip->count) {
+    fclose(file);
+    return GOLDEN_MISSING;
+  }
+
+  int f = 0;
+  int result = GOLDEN_MATCH;
+  while (fgets(line, sizeof(line), file) != NULL) {
+    int frame;
+    unsigned long ms;
+    uint32_t hash;
+    if (sscanf(line, "%d %lu %x", &frame, &ms, &hash) != 3) continue;
+    if (f >= strip->frame_count || strip->times[f] / 1000 != ms || get_sim_frame_hash(strip, f) != hash) {
+      result = GOLDEN_MISMATCH;
+      break;
+    }
+    f++;
+  }
+  if (result == GOLDEN_MATCH && f != strip->frame_count) result = GOLDEN_MISMATCH;
+  *first_difference = f;
+
+  fclose(file);
+  return result;
+}
@@ -0,0 +1,48 @@
+/**
+ * sim_strip.h
+ *
+ * Simulated WS2812 strip for the host: captures every frame shown, times
+ * them with a wire model on a simulated clock, writes them as PPM images
+ * and compares them with golden frames
+ *
+ * Author: Vincent Lacasse (lacasse4@yahoo.com)
+ * Date: 2026-10-18
+ * Target system: Linux (host)
+ *
+ */
+
+#ifndef _SIM_STRIP_H
+#define _SIM_STRIP_H
+
+#include <stdint.h>
+#include <FastLED.h>
+
+#define WS2812_LED_US       30      // 24 bits at 800 kHz
+#define WS2812_RESET_US     50      // latch: the line held low after a frame
+
+#define GOLDEN_MATCH        1
+#define GOLDEN_MISMATCH     0
+#define GOLDEN_MISSING      -1
+
+typedef struct sim_strip sim_strip_t;
+
+sim_strip_t* create_sim_strip(CRGB* leds, int count, int capacity);
+void delete_sim_strip(sim_strip_t* strip);
+void sim_show(void* context, uint8_t level);
+
+int get_sim_frame_count(sim_strip_t* strip);
+const CRGB* get_sim_frame(sim_strip_t* strip, int frame);
+unsigned long get_sim_frame_time(sim_strip_t* strip, int frame);
+uint32_t get_sim_frame_hash(sim_strip_t* strip, int frame);
+unsigned long get_sim_wire_us(sim_strip_t* strip);
+
+unsigned long wire_time_us(int count);
+void start_sim_clock();
+void advance_sim_clock(unsigned long us);
+unsigned long get_sim_clock();
+
+int write_sim_ppm(sim_strip_t* strip, const char* path, int gain);
+int write_golden(sim_strip_t* strip, const char* path, const char* name);
+int compare_golden(sim_strip_t* strip, const char* path, int* first_difference);
+
+#endif
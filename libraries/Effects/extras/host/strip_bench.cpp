@@ -0,0 +1,244 @@
+/**
+ * strip_bench.cpp
+ *
+ * Host microbenchmark of the strip kernels (strip.h and FastLED's bulk
+ * functions) against the float and division code of the former
+ * WS2812_Velo effects.  Every kernel draws a whole strip, frame after
+ * frame, for strips of 40 (WS2812_Velo), 150 and 300 pixels:
+ *   fade      fade_out() step: float scale      / nscale8_video()
+ *   sine      running lights: float sin()       / fill_sine()
+ *   wheel     rainbow: i * 256 / count          / fill_wheel()
+ *   heat      fire colors: round(t / 255 * 191) / fill_heat()
+ *   decay     meteor trail: random(10) > 5      / fade_strip_random()
+ *   blend     crossfade of two strips           / blend()
+ * It reports the host cycles per pixel per frame of each and the largest
+ * difference between their frames (one channel, 0..255).
+ *
+ * Author: Vincent Lacasse (lacasse4@yahoo.com)
+ * Date: 2026-10-18
+ * Target system: Linux (host)
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <unistd.h>
+#include <x86intrin.h>
+#include <FastLED.h>
+#include <effects.h>
+#include <strip.h>
+
+#define MAX_LEDS        300
+#define MAX_INTENSITY   16          // WS2812_Velo's, SCALE_DOWN_SHIFT 4
+#define SHIFT           4
+
+static const int strips[] = { 40, 150, 300 };
+#define STRIPS ((int) (sizeof(strips) / sizeof(strips[0])))
+
+static int frames = 2000;
+
+// the frames compared, and the frame before (effects drawing over their last frame)
+static CRGB former[MAX_LEDS];
+static CRGB kernel[MAX_LEDS];
+static CRGB source[MAX_LEDS];
+static CRGB other[MAX_LEDS];
+static uint8_t heat[MAX_LEDS];
+
+typedef void (*draw_t)(CRGB* leds, int count, int frame);
+
+typedef struct bench {
+    const char* name;
+    draw_t former;           // NULL: no former version
+    draw_t kernel;
+    int random;              // the frames differ by their random numbers: not compared
+} bench_t;
+
+// ***************************************************
+//          former WS2812_Velo code (float, divisions)
+// ***************************************************
+
+static void former_fade(CRGB* leds, int count, int frame)
+{
+  int i = MAX_INTENSITY - 2 * (frame % (MAX_INTENSITY / 2 + 1));
+  float scale = (float) i / MAX_INTENSITY;
+  for (int j = 0; j < count; j++) {
+    leds[j].r = scale * source[j].r;
+    leds[j].g = scale * source[j].g;
+    leds[j].b = scale * source[j].b;
+  }
+}
+
+static void former_sine(CRGB* leds, int count, int frame)
+{
+  CRGB color(MAX_INTENSITY, MAX_INTENSITY, MAX_INTENSITY);
+  for (int i = 0; i < count; i++) {
+    leds[i] = CRGB(((sin(i + frame + 1) * 127 + 128) / 255) * color.r,
+                   ((sin(i + frame)     * 127 + 128) / 255) * color.g,
+                   ((sin(i + frame - 1) * 127 + 128) / 255) * color.b);
+  }
+}
+
+static void former_wheel(CRGB* leds, int count, int frame)
+{
+  for (int i = 0; i < count; i++) {
+    CRGB c = wheel(((i * 256 / count) + frame) & 255);
+    leds[i] = CRGB(c.r >> SHIFT, c.g >> SHIFT, c.b >> SHIFT);
+  }
+}
+
+// the former palette times 4: fill_heat() draws at full range (see dither.h)
+static void former_heat(CRGB* leds, int count, int frame)
+{
+  for (int i = 0; i < count; i++) {
+    uint8_t t192 = round((heat[(i + frame) % count] / 255.0) * 191);
+    uint8_t ramp = (t192 & 0x3F) * 4;
+    if (t192 > 0x80) leds[i] = CRGB(0xFF, 0xFF, ramp);
+    else if (t192 > 0x40) leds[i] = CRGB(0x80, ramp, 0);
+    else leds[i] = CRGB(ramp, 0, 0);
+  }
+}
+
+static void former_decay(CRGB* leds, int count, int frame)
+{
+  memcpy(leds, source, count * sizeof(CRGB));
+  for (int j = 0; j < count; j++) {
+    if (random(10) > 5) leds[j].fadeToBlackBy(64);
+  }
+}
+
+// ***************************************************
+//                  integer kernels
+// ***************************************************
+
+static void kernel_fade(CRGB* leds, int count, int frame)
+{
+  int i = MAX_INTENSITY - 2 * (frame % (MAX_INTENSITY / 2 + 1));
+  memcpy(leds, source, count * sizeof(CRGB));
+  nscale8_video(leds, count, i * 256 / MAX_INTENSITY > 255 ? 255 : i * 256 / MAX_INTENSITY);
+}
+
+static void kernel_sine(CRGB* leds, int count, int frame)
+{
+  CRGB color(MAX_INTENSITY, MAX_INTENSITY, MAX_INTENSITY);
+  uint16_t position = frame * STRIP_RADIAN;
+  uint16_t phase[3] = { (uint16_t) (position + STRIP_RADIAN), position, (uint16_t) (position - STRIP_RADIAN) };
+  fill_sine(leds, count, color, phase, STRIP_RADIAN);
+}
+
+static void kernel_wheel(CRGB* leds, int count, int frame)
+{
+  fill_wheel(leds, count, frame, SHIFT);
+}
+
+static void kernel_heat(CRGB* leds, int count, int frame)
+{
+  // the same rotation of the heat map as former_heat()
+  int offset = frame % count;
+  fill_heat(leds, heat + offset, count - offset, 0);
+  fill_heat(leds + count - offset, heat, offset, 0);
+}
+
+static void kernel_decay(CRGB* leds, int count, int frame)
+{
+  memcpy(leds, source, count * sizeof(CRGB));
+  fade_strip_random(leds, count, 64, 102);
+}
+
+static void kernel_blend(CRGB* leds, int count, int frame)
+{
+  blend(source, other, leds, count, frame & 255);
+}
+
+static const bench_t benches[] = {
+  { "fade",  former_fade,  kernel_fade,  0 },
+  { "sine",  former_sine,  kernel_sine,  0 },
+  { "wheel", former_wheel, kernel_wheel, 0 },
+  { "heat",  former_heat,  kernel_heat,  0 },
+  { "decay", former_decay, kernel_decay, 1 },
+  { "blend", NULL,         kernel_blend, 0 },
+};
+#define BENCHES ((int) (sizeof(benches) / sizeof(benches[0])))
+
+/**
+ * @brief run 'draw' for all frames
+ * @returns host cycles per pixel per frame
+ */
+static double run(draw_t draw, CRGB* leds, int count)
+{
+  draw(leds, count, 0);                    // warm up
+  unsigned long long start = __rdtsc();
+  for (int f = 0; f < frames; f++) {
+    draw(leds, count, f);
+  }
+  return (double) (__rdtsc() - start) / ((double) frames * count);
+}
+
+/**
+ * @brief largest channel difference between the former and kernel frames, over a few frames
+ */
+static int compare(const bench_t* bench, int count)
+{
+  int worst = 0;
+
+  for (int f = 0; f < 64; f++) {
+    bench->former(former, count, f);
+    bench->kernel(kernel, count, f);
+    for (int i = 0; i < count; i++) {
+      for (int c = 0; c < 3; c++) {
+        int d = abs(former[i].raw[c] - kernel[i].raw[c]);
+        if (d > worst) worst = d;
+      }
+    }
+  }
+  return worst;
+}
+
+static void usage(const char* name)
+{
+  fprintf(stderr, "usage: %s [-f frames]\n", name);
+  exit(1);
+}
+
+int main(int argc, char* argv[])
+{
+  int opt;
+
+  while ((opt = getopt(argc, argv, "f:")) != -1) {
+    switch (opt) {
+      case 'f': frames = atoi(optarg); break;
+      default: usage(argv[0]);
+    }
+  }
+  if (frames < 1) usage(argv[0]);
+
+  srandom(1);
+  for (int i = 0; i < MAX_LEDS; i++) {
+    source[i] = CRGB(random(MAX_INTENSITY + 1), random(MAX_INTENSITY + 1), random(MAX_INTENSITY + 1));
+    other[i] = CRGB(random(256), random(256), random(256));
+    heat[i] = random(256);
+  }
+
+  printf("Strip kernels: host cycles per pixel per frame, %d frames\n", frames);
+  printf("(diff: largest channel difference between the former and integer frames)\n\n");
+  printf("%-6s %6s %10s %10s %8s %6s\n", "kernel", "leds", "former", "integer", "speedup", "diff");
+
+  for (int b = 0; b < BENCHES; b++) {
+    const bench_t* bench = &benches[b];
+    for (int s = 0; s < STRIPS; s++) {
+      double cycles = run(bench->kernel, kernel, strips[s]);
+      if (bench->former == NULL) {
+        printf("%-6s %6d %10s %10.1f %8s %6s\n", bench->name, strips[s], "-", cycles, "-", "-");
+        continue;
+      }
+      double former_cycles = run(bench->former, former, strips[s]);
+      char diff[16];
+      if (bench->random) snprintf(diff, sizeof(diff), "rnd");
+      else snprintf(diff, sizeof(diff), "%d", compare(bench, strips[s]));
+      printf("%-6s %6d %10.1f %10.1f %7.1fx %6s\n", bench->name, strips[s], former_cycles, cycles,
+             former_cycles / cycles, diff);
+    }
+  }
+  return 0;
+}
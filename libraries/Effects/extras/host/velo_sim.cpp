@@ -0,0 +1,384 @@
+/**
+ * velo_sim.cpp
+ *
+ * WS2812_Velo on a simulated strip (sim_strip.h): every effect of the
+ * sketch, with the sketch's parameters, runs through the scheduler on a
+ * simulated clock.  Its frames are compared with the golden frames of
+ * ./golden (or written there with -u), written as PPM images (-o), and
+ * timed with the WS2812 wire model.
+ *
+ * Every scenario plays an effect, or crossfades from one to another, and
+ * fades out at the end.  The effects draw at full range; the dither layer
+ * (dither.h) scales their frames down to the strip's MAX_INTENSITY, color
+ * corrected (TypicalLEDStrip) as in the sketch.  By
+ * default it sends the scheduler's frames only (the golden frames): -r
+ * refreshes them in between, as the sketch does.  Random numbers are seeded at its start: a
+ * scenario's frames do not depend on the others.
+ *
+ * Author: Vincent Lacasse (lacasse4@yahoo.com)
+ * Date: 2026-10-18
+ * Target system: Linux (host)
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <effects.h>
+#include <scheduler.h>
+#include <dither.h>
+#include "sim_strip.h"
+
+// WS2812_Velo's parameters
+#define NUM_LEDS                40
+#define SCALE_DOWN_SHIFT        4
+#define MAX_INTENSITY           (SCALE_DOWN_SHIFT == 0 ? 255 : 256 >> SCALE_DOWN_SHIFT)
+#define FRAME_INTERVAL          10
+#define MS_CROSSFADE            1000
+#define MS_FADE_OUT_DELAY       25
+#define MS_FADE_OUT             ((MAX_INTENSITY / 2) * MS_FADE_OUT_DELAY)
+#define MS_START_SEQUENCE_DELAY 250
+#define FULL_INTENSITY          255
+#define MS_ANIMATION_TIME       40000
+#define THEATER_CHASE_DELAY     50
+#define KITT_EYE_SIZE           6
+#define KITT_SPEED_DELAY        10
+#define KITT_RETURN_DELAY       50
+#define CYLON_EYE_SIZE          3
+#define CYLON_SPEED_DELAY       10
+#define CYLON_RETURN_DELAY      50
+#define TWINKLE_DELAY           50
+#define TWINKLE_LEDS            5
+#define RUNNING_LIGHTS_DELAY    100
+#define RAINBOW_CYCLE_DELAY     10
+#define TIME_INCREMENT          10
+#define FIRE_COOLING            55
+#define FIRE_SPARKING           120
+#define FIRE_DELAY              15
+#define METEOR_SIZE             5
+#define METEOR_DECAY            64
+#define METEOR_DELAY            30
+
+#define MAX_LEDS                1000
+#define IDLE_US                 100      // simulated time of a loop() without a frame
+#define SEED                    1
+#define PATH_SIZE               512
+
+#define NUM_SIMPLE_COLORS 8
+static CRGB simple_colors[NUM_SIMPLE_COLORS] = {
+  CRGB::Red,
+  0x808000, // Yellow
+  CRGB::Blue,
+  CRGB::Green,
+  CRGB::DarkOrange,
+  CRGB::Violet,
+  CRGB::Purple,
+  CRGB::Grey
+};
+#define WHITE   simple_colors[7]
+
+typedef union effect_slot {
+    flash_t flash;
+    theater_chase_t theater_chase;
+    bounce_t bounce;
+    kitt_t kitt;
+    twinkle_t twinkle;
+    running_lights_t running_lights;
+    changing_colors_t changing_colors;
+    rainbow_t rainbow;
+    chase_rainbow_t chase_rainbow;
+    fire_t fire;
+    meteor_t meteor;
+    modulation_t modulation;
+} effect_slot_t;
+
+typedef effect_t* (*start_t)(effect_slot_t* s);
+
+typedef struct scenario {
+    const char* name;
+    start_t start;
+    start_t next;            // crossfaded in at the middle, NULL for none
+} scenario_t;
+
+static CRGB random_simple_color()
+{
+  return simple_colors[random(NUM_SIMPLE_COLORS)];
+}
+
+static effect_t* start_sequence(effect_slot_t* s)
+{
+  return init_flash(&s->flash, WHITE, 3, MS_START_SEQUENCE_DELAY, 0);
+}
+
+static effect_t* theater_chase_forward(effect_slot_t* s)
+{
+  return init_theater_chase(&s->theater_chase, random_simple_color(), 1, THEATER_CHASE_DELAY, MS_ANIMATION_TIME);
+}
+
+static effect_t* theater_chase_backward(effect_slot_t* s)
+{
+  return init_theater_chase(&s->theater_chase, random_simple_color(), -1, THEATER_CHASE_DELAY, MS_ANIMATION_TIME);
+}
+
+static effect_t* cylon_bounce(effect_slot_t* s)
+{
+  return init_bounce(&s->bounce, simple_colors, NUM_SIMPLE_COLORS, CYLON_EYE_SIZE, CYLON_SPEED_DELAY,
+                     CYLON_RETURN_DELAY, MS_ANIMATION_TIME);
+}
+
+static effect_t* kitt_in_and_out(effect_slot_t* s)
+{
+  return init_kitt(&s->kitt, simple_colors, NUM_SIMPLE_COLORS, 1, KITT_EYE_SIZE, KITT_SPEED_DELAY,
+                   KITT_RETURN_DELAY, MS_ANIMATION_TIME);
+}
+
+static effect_t* kitt_out_and_in(effect_slot_t* s)
+{
+  return init_kitt(&s->kitt, simple_colors, NUM_SIMPLE_COLORS, 0, KITT_EYE_SIZE, KITT_SPEED_DELAY,
+                   KITT_RETURN_DELAY, MS_ANIMATION_TIME);
+}
+
+static effect_t* twinkle(effect_slot_t* s)
+{
+  return init_twinkle(&s->twinkle, random_simple_color(), TWINKLE_LEDS, TWINKLE_DELAY, MS_ANIMATION_TIME);
+}
+
+static effect_t* running_lights(effect_slot_t* s)
+{
+  return init_running_lights(&s->running_lights, random_simple_color(), RUNNING_LIGHTS_DELAY, MS_ANIMATION_TIME);
+}
+
+static effect_t* changing_colors(effect_slot_t* s)
+{
+  return init_changing_colors(&s->changing_colors, random_simple_color(), RUNNING_LIGHTS_DELAY,
+                              MS_ANIMATION_TIME);
+}
+
+static effect_t* rainbow_cycle(effect_slot_t* s)
+{
+  return init_rainbow(&s->rainbow, 0, RAINBOW_CYCLE_DELAY, MS_ANIMATION_TIME);
+}
+
+static effect_t* theater_chase_rainbow(effect_slot_t* s)
+{
+  return init_chase_rainbow(&s->chase_rainbow, 0, THEATER_CHASE_DELAY);
+}
+
+static effect_t* fire(effect_slot_t* s)
+{
+  return init_fire(&s->fire, FIRE_COOLING, FIRE_SPARKING, 0, FIRE_DELAY, MS_ANIMATION_TIME);
+}
+
+static effect_t* fire_reversed(effect_slot_t* s)
+{
+  return init_fire(&s->fire, FIRE_COOLING, FIRE_SPARKING, 1, FIRE_DELAY, MS_ANIMATION_TIME);
+}
+
+static effect_t* meteor_rain(effect_slot_t* s)
+{
+  return init_meteor(&s->meteor, CRGB(FULL_INTENSITY, FULL_INTENSITY, FULL_INTENSITY), METEOR_SIZE, METEOR_DECAY,
+                     1, 0, METEOR_DELAY, MS_ANIMATION_TIME);
+}
+
+static effect_t* meteor_rain_reversed(effect_slot_t* s)
+{
+  return init_meteor(&s->meteor, CRGB(FULL_INTENSITY, FULL_INTENSITY, FULL_INTENSITY), METEOR_SIZE, METEOR_DECAY,
+                     1, 1, METEOR_DELAY, MS_ANIMATION_TIME);
+}
+
+static effect_t* two_colors_modulation(effect_slot_t* s)
+{
+  return init_modulation(&s->modulation, FULL_INTENSITY, TIME_INCREMENT, MS_ANIMATION_TIME);
+}
+
+static const scenario_t scenarios[] = {
+  { "start_sequence",         start_sequence,         NULL },
+  { "theater_chase_forward",  theater_chase_forward,  NULL },
+  { "theater_chase_backward", theater_chase_backward, NULL },
+  { "cylon_bounce",           cylon_bounce,           NULL },
+  { "kitt_in_and_out",        kitt_in_and_out,        NULL },
+  { "kitt_out_and_in",        kitt_out_and_in,        NULL },
+  { "twinkle",                twinkle,                NULL },
+  { "running_lights",         running_lights,         NULL },
+  { "changing_colors",        changing_colors,        NULL },
+  { "rainbow_cycle",          rainbow_cycle,          NULL },
+  { "theater_chase_rainbow",  theater_chase_rainbow,  NULL },
+  { "fire",                   fire,                   NULL },
+  { "fire_reversed",          fire_reversed,          NULL },
+  { "meteor_rain",            meteor_rain,            NULL },
+  { "meteor_rain_reversed",   meteor_rain_reversed,   NULL },
+  { "two_colors_modulation",  two_colors_modulation,  NULL },
+  { "crossfade",              cylon_bounce,           fire },
+};
+#define SCENARIOS ((int) (sizeof(scenarios) / sizeof(scenarios[0])))
+
+static const int budget_strips[] = { 40, 150, 300, 330, 600 };
+#define BUDGET_STRIPS ((int) (sizeof(budget_strips) / sizeof(budget_strips[0])))
+
+static int seconds = 2;
+static int num_leds = NUM_LEDS;
+static int frame_interval = FRAME_INTERVAL;
+static int refresh_us = 0;
+static int gain = 255 / MAX_INTENSITY;
+static int update = 0;
+static const char* golden_dir = "golden";
+static const char* ppm_dir = NULL;
+static const char* only = NULL;
+
+static CRGB leds[MAX_LEDS];
+static CRGB frame[MAX_LEDS];
+static CRGB layers[2][MAX_LEDS];
+static uint8_t dither_error[3 * MAX_LEDS];
+static effect_slot_t slots[2];
+
+/**
+ * @brief run a scenario on a simulated strip
+ * @returns 1 if its frames match the golden ones (or were written), 0 otherwise
+ */
+static int run_scenario(const scenario_t* scenario)
+{
+  unsigned long end = seconds * 1000UL;
+  unsigned long switch_at = end / 2 - MS_CROSSFADE / 2;
+  unsigned long fade_at = end - MS_FADE_OUT;
+  int switched = 0;
+  int faded = 0;
+  scheduler_t scheduler;
+  dither_t dither;
+
+  srandom(SEED);
+  random16_set_seed(SEED);
+  memset(leds, 0, sizeof(leds));
+  memset(frame, 0, sizeof(frame));
+  start_sim_clock();
+
+  sim_strip_t* strip = create_sim_strip(leds, num_leds, end / frame_interval + 1);
+  if (strip == NULL) {
+    fprintf(stderr, "out of memory\n");
+    exit(1);
+  }
+  init_dither(&dither, frame, leds, dither_error, num_leds, MAX_INTENSITY, refresh_us, sim_show, strip);
+  set_dither_correction(&dither, TypicalLEDStrip);
+  init_scheduler(&scheduler, frame, num_leds, frame_interval, dither_show, &dither);
+  set_layers(&scheduler, layers[0], layers[1]);
+  play_effect(&scheduler, scenario->start(&slots[0]));
+
+  // WS2812_Velo's loop()
+  while (millis() < end) {
+    unsigned long now = millis();
+    int sent = run_scheduler(&scheduler, now);
+    sent |= refresh_dither(&dither, micros());
+    if (!sent) advance_sim_clock(IDLE_US);
+
+    if (scenario->next != NULL && !switched && now >= switch_at) {
+      crossfade_effect(&scheduler, scenario->next(&slots[1]), MS_CROSSFADE, now);
+      switched = 1;
+    }
+    if (!faded && now >= fade_at) {
+      fade_out(&scheduler, MS_FADE_OUT, now);
+      faded = 1;
+    }
+  }
+
+  char path[PATH_SIZE];
+  const char* status;
+  int first = 0;
+  int ok = 1;
+
+  snprintf(path, sizeof(path), "%s/%s.txt", golden_dir, scenario->name);
+  if (refresh_us != 0) {
+    status = "not compared (refreshes)";
+  }
+  else if (update) {
+    ok = write_golden(strip, path, scenario->name);
+    status = ok ? "written" : "write failed";
+  }
+  else {
+    switch (compare_golden(strip, path, &first)) {
+      case GOLDEN_MATCH: status = "match"; break;
+      case GOLDEN_MISSING: status = "no golden"; break;
+      default: status = "MISMATCH"; ok = 0; break;
+    }
+  }
+
+  if (ppm_dir != NULL) {
+    snprintf(path, sizeof(path), "%s/%s.ppm", ppm_dir, scenario->name);
+    if (!write_sim_ppm(strip, path, gain)) fprintf(stderr, "cannot write %s\n", path);
+  }
+
+  int frames = get_sim_frame_count(strip);
+  printf("%-24s %6d %7u %8u %9lu %9u  %s", scenario->name, frames, scheduler.dropped, scheduler.overruns,
+         frames > 0 ? get_sim_wire_us(strip) / frames : 0, scheduler.max_frame_us, status);
+  if (!ok && !update) printf(" at frame %d", first);
+  printf("\n");
+
+  delete_sim_strip(strip);
+  return ok;
+}
+
+/**
+ * @brief the wire time of a frame against the frame interval, for a few strip lengths
+ */
+static void print_budget()
+{
+  printf("\nWS2812 wire budget: %d us per LED + %d us latch, frame every %d ms\n", WS2812_LED_US, WS2812_RESET_US,
+         frame_interval);
+  printf("%6s %9s %8s %8s\n", "leds", "wire us", "max fps", "budget");
+  for (int i = 0; i < BUDGET_STRIPS; i++) {
+    unsigned long wire = wire_time_us(budget_strips[i]);
+    printf("%6d %9lu %8.1f %7.1f%%%s\n", budget_strips[i], wire, 1e6 / wire, 100.0 * wire / (frame_interval * 1000.0),
+           wire > frame_interval * 1000UL ? "  over" : "");
+  }
+}
+
+static void usage(const char* name)
+{
+  fprintf(stderr, "usage: %s [-s seconds] [-l leds] [-i frame_interval_ms] [-r refresh_us] [-e scenario] [-u] "
+                  "[-d golden_dir] [-o ppm_dir] [-g gain]\n", name);
+  exit(1);
+}
+
+int main(int argc, char* argv[])
+{
+  int opt;
+
+  while ((opt = getopt(argc, argv, "s:l:i:r:e:ud:o:g:")) != -1) {
+    switch (opt) {
+      case 's': seconds = atoi(optarg); break;
+      case 'l': num_leds = atoi(optarg); break;
+      case 'i': frame_interval = atoi(optarg); break;
+      case 'r': refresh_us = atoi(optarg); break;
+      case 'e': only = optarg; break;
+      case 'u': update = 1; break;
+      case 'd': golden_dir = optarg; break;
+      case 'o': ppm_dir = optarg; break;
+      case 'g': gain = atoi(optarg); break;
+      default: usage(argv[0]);
+    }
+  }
+  if (seconds < 1 || num_leds < 1 || num_leds > MAX_LEDS || frame_interval < 1 || refresh_us < 0 ||
+      refresh_us > UINT16_MAX || gain < 1) usage(argv[0]);
+
+  printf("WS2812_Velo simulation: %d leds, frame every %d ms, %d s per scenario", num_leds, frame_interval, seconds);
+  if (refresh_us != 0) printf(", dithered refresh every %d us", refresh_us);
+  printf("\n");
+  printf("(frame us: render + show on the simulated clock, render takes no time)\n\n");
+  printf("%-24s %6s %7s %8s %9s %9s  %s\n", "scenario", "frames", "dropped", "overruns", "wire us", "frame us",
+         "golden");
+
+  int failed = 0;
+  int ran = 0;
+  for (int i = 0; i < SCENARIOS; i++) {
+    if (only != NULL && strcmp(only, scenarios[i].name) != 0) continue;
+    if (!run_scenario(&scenarios[i])) failed++;
+    ran++;
+  }
+  if (ran == 0) {
+    fprintf(stderr, "no scenario %s\n", only);
+    return 1;
+  }
+
+  print_budget();
+  if (failed > 0) printf("\n%d scenario(s) differ from the golden frames\n", failed);
+  return failed > 0 ? 1 : 0;
+}
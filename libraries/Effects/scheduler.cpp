@@ -0,0 +1,243 @@
+/**
+ * scheduler.cpp
+ *
+ * C module running LED strip effects (see effect.h) at a fixed frame rate,
+ * without blocking: an effect, a second effect blended over it, and a
+ * master level for fades
+ *
+ * Author: Vincent Lacasse (lacasse4@yahoo.com)
+ * Date: 2026-10-18
+ * Target system: Arduino Uno
+ *
+ */
+
+/*
+ * loop() calls run_scheduler() as often as it can.  Between two frames it
+ * returns at once, so the time left is loop()'s (serial, sensors...).
+ * Frames are due every frame_interval ms from the first one: a frame late
+ * by more than an interval counts the frame times it missed as dropped,
+ * and a frame whose render + show took longer than the interval is an
+ * overrun.  Effects keep their pace anyway (see take_steps()).
+ */
+
+#include <Arduino.h>
+#include <string.h>
+#include "scheduler.h"
+
+/**
+ * @brief initialize a scheduler, with no effect
+ * @param leds the buffer given to FastLED, 'count' pixels
+ * @param frame_interval time between frames (ms)
+ * @param show sends 'leds' at 'level' (0..255), with 'context'
+ */
+void init_scheduler(scheduler_t* s, CRGB* leds, int count, uint16_t frame_interval,
+                    void (*show)(void* context, uint8_t level), void* context)
+{
+  s->leds = leds;
+  s->layer[BASE] = s->layer[LAYER] = NULL;
+  s->count = count;
+  s->effect[BASE] = s->effect[LAYER] = NULL;
+  s->mix = 0;
+  s->level = 255;
+  s->show = show;
+  s->context = context;
+  s->crossfade_ms = 0;
+  s->fade_ms = 0;
+  s->frame_interval = frame_interval > 0 ? frame_interval : 1;
+  s->started = 0;
+  reset_frame_stats(s);
+}
+
+/**
+ * @brief give the effects a buffer each ('count' pixels), to blend them
+ */
+void set_layers(scheduler_t* s, CRGB* base, CRGB* layer)
+{
+  s->layer[BASE] = base;
+  s->layer[LAYER] = layer;
+  if (base != NULL) memcpy(base, s->leds, s->count * sizeof(CRGB));
+}
+
+static int has_layers(scheduler_t* s)
+{
+  return s->layer[BASE] != NULL && s->layer[LAYER] != NULL;
+}
+
+/**
+ * @brief play 'effect' alone at full level, from the next frame
+ */
+void play_effect(scheduler_t* s, effect_t* effect)
+{
+  s->effect[BASE] = effect;
+  s->effect[LAYER] = NULL;
+  s->mix = 0;
+  s->level = 255;
+  s->crossfade_ms = 0;
+  s->fade_ms = 0;
+}
+
+/**
+ * @brief play 'effect' over the current one, blended by 'mix' (0..255), NULL to remove it
+ * @returns 1 if OK, 0 without layers
+ */
+int mix_effect(scheduler_t* s, effect_t* effect, uint8_t mix)
+{
+  if (!has_layers(s)) return 0;
+  s->effect[LAYER] = effect;
+  s->mix = mix;
+  s->crossfade_ms = 0;
+  return 1;
+}
+
+/**
+ * @brief replace the current effect by 'effect', blending from one to the other in 'ms'
+ * @details without layers, or without a current effect, 'effect' simply plays
+ */
+void crossfade_effect(scheduler_t* s, effect_t* effect, uint16_t ms, uint32_t now)
+{
+  if (!has_layers(s) || s->effect[BASE] == NULL || ms == 0) {
+    play_effect(s, effect);
+    return;
+  }
+  s->effect[LAYER] = effect;
+  s->mix = 0;
+  s->crossfade_start = now;
+  s->crossfade_ms = ms;
+}
+
+/**
+ * @brief bring the master level down to 0 in 'ms', the effects still playing; then stop them
+ */
+void fade_out(scheduler_t* s, uint16_t ms, uint32_t now)
+{
+  s->fade_start = now;
+  s->fade_ms = ms > 0 ? ms : 1;
+}
+
+/**
+ * @brief ramp 'from' to 'to' over 'ms', at 'elapsed'
+ */
+static uint8_t ramp(uint8_t from, uint8_t to, uint32_t elapsed, uint16_t ms)
+{
+  if (elapsed >= ms) return to;
+  return from + ((int32_t) to - from) * (int32_t) elapsed / ms;
+}
+
+/**
+ * @brief update the crossfade and fade out at 'now'
+ */
+static void update_fades(scheduler_t* s, uint32_t now)
+{
+  if (s->crossfade_ms > 0) {
+    uint32_t elapsed = now - s->crossfade_start;
+    s->mix = ramp(0, 255, elapsed, s->crossfade_ms);
+    if (elapsed >= s->crossfade_ms) {
+      // the layer becomes the base, in its own buffer
+      CRGB* buffer = s->layer[BASE];
+      s->layer[BASE] = s->layer[LAYER];
+      s->layer[LAYER] = buffer;
+      s->effect[BASE] = s->effect[LAYER];
+      s->effect[LAYER] = NULL;
+      s->mix = 0;
+      s->crossfade_ms = 0;
+    }
+  }
+
+  if (s->fade_ms > 0) {
+    uint32_t elapsed = now - s->fade_start;
+    s->level = ramp(255, 0, elapsed, s->fade_ms);
+    if (elapsed >= s->fade_ms) {
+      s->effect[BASE] = s->effect[LAYER] = NULL;
+      s->crossfade_ms = 0;
+      s->fade_ms = 0;
+    }
+  }
+}
+
+/**
+ * @brief render the effects into 'leds' and show them, if a frame is due at 'now'
+ * @returns 1 if a frame was shown, 0 otherwise
+ * @details an effect that ends is removed: its last frame stays on the strip.
+ */
+int run_scheduler(scheduler_t* s, uint32_t now)
+{
+  if (s->effect[BASE] == NULL && s->effect[LAYER] == NULL && s->fade_ms == 0) {
+    s->started = 0;                        // idle: the next effect starts on time
+    return 0;
+  }
+
+  if (!s->started) {
+    s->next_frame = now;
+    s->started = 1;
+  }
+  if ((int32_t) (now - s->next_frame) < 0) return 0;
+
+  uint32_t missed = (now - s->next_frame) / s->frame_interval;
+  s->dropped += missed;
+  s->next_frame += (missed + 1) * s->frame_interval;
+
+  uint32_t t0 = micros();
+  update_fades(s, now);
+
+  CRGB* base = has_layers(s) ? s->layer[BASE] : s->leds;
+  if (s->effect[BASE] != NULL) {
+    if (render_effect(s->effect[BASE], base, s->count, now) == EFFECT_DONE) s->effect[BASE] = NULL;
+  }
+  if (has_layers(s)) {
+    if (s->effect[LAYER] != NULL) {
+      if (render_effect(s->effect[LAYER], s->layer[LAYER], s->count, now) == EFFECT_DONE) {
+        s->effect[LAYER] = NULL;
+      }
+      blend(base, s->layer[LAYER], s->leds, s->count, s->mix);
+    }
+    else {
+      memcpy(s->leds, base, s->count * sizeof(CRGB));
+    }
+  }
+
+  s->show(s->context, s->level);
+
+  s->frame_us = micros() - t0;
+  s->busy_us += s->frame_us;
+  if (s->frame_us > s->max_frame_us) s->max_frame_us = s->frame_us;
+  if (s->frame_us > s->frame_interval * 1000UL) s->overruns++;
+  s->frames++;
+  return 1;
+}
+
+/**
+ * @brief return the effect playing (the one fading in during a crossfade), NULL if none
+ */
+effect_t* get_effect(scheduler_t* s)
+{
+  return s->effect[LAYER] != NULL ? s->effect[LAYER] : s->effect[BASE];
+}
+
+/**
+ * @brief return true when no effect plays and no fade is in progress
+ */
+int is_scheduler_idle(scheduler_t* s)
+{
+  return s->effect[BASE] == NULL && s->effect[LAYER] == NULL && s->fade_ms == 0;
+}
+
+/**
+ * @brief return true during a crossfade or a fade out
+ */
+int is_fading(scheduler_t* s)
+{
+  return s->crossfade_ms > 0 || s->fade_ms > 0;
+}
+
+/**
+ * @brief zero the frame counters and times
+ */
+void reset_frame_stats(scheduler_t* s)
+{
+  s->frames = 0;
+  s->dropped = 0;
+  s->overruns = 0;
+  s->frame_us = 0;
+  s->max_frame_us = 0;
+  s->busy_us = 0;
+}
@@ -0,0 +1,70 @@
+/**
+ * scheduler.h
+ *
+ * C module running LED strip effects (see effect.h) at a fixed frame rate,
+ * without blocking: an effect, a second effect blended over it, and a
+ * master level for fades
+ *
+ * Author: Vincent Lacasse (lacasse4@yahoo.com)
+ * Date: 2026-10-18
+ * Target system: Arduino Uno
+ *
+ */
+
+#ifndef _SCHEDULER_H
+#define _SCHEDULER_H
+
+#include "effect.h"
+
+#define BASE        0
+#define LAYER       1
+
+/*
+ * The scheduler draws into 'leds', the buffer given to FastLED.  Blending
+ * needs the effects to draw apart: set_layers() gives them a buffer each,
+ * and 'leds' gets their blend.  Without layers, the effect draws straight
+ * into 'leds' and mix_effect() / crossfade_effect() replace it.
+ * The show() callback sends 'leds' at the master level (FastLED.show(level)).
+ */
+typedef struct scheduler {
+    CRGB* leds;              // output
+    CRGB* layer[2];          // effects' buffers, NULL for none
+    int count;
+    effect_t* effect[2];     // base and layer effects, NULL for none
+    uint8_t mix;             // layer over base, 0..255
+    uint8_t level;           // master level
+    void (*show)(void* context, uint8_t level);
+    void* context;
+
+    // fades: mix and level ramp linearly to their target
+    uint32_t crossfade_start;
+    uint16_t crossfade_ms;   // 0: no crossfade
+    uint32_t fade_start;
+    uint16_t fade_ms;        // 0: no fade out
+
+    // frame budget
+    uint16_t frame_interval; // ms
+    uint32_t next_frame;     // time of the next frame (ms)
+    int started;
+    uint32_t frames;         // frames shown
+    uint32_t dropped;        // frame times missed
+    uint32_t overruns;       // frames longer than the interval
+    uint32_t frame_us;       // last frame's render + show time
+    uint32_t max_frame_us;
+    uint32_t busy_us;        // render + show time of all frames
+} scheduler_t;
+
+void init_scheduler(scheduler_t* s, CRGB* leds, int count, uint16_t frame_interval,
+                    void (*show)(void* context, uint8_t level), void* context);
+void set_layers(scheduler_t* s, CRGB* base, CRGB* layer);
+void play_effect(scheduler_t* s, effect_t* effect);
+int mix_effect(scheduler_t* s, effect_t* effect, uint8_t mix);
+void crossfade_effect(scheduler_t* s, effect_t* effect, uint16_t ms, uint32_t now);
+void fade_out(scheduler_t* s, uint16_t ms, uint32_t now);
+int run_scheduler(scheduler_t* s, uint32_t now);
+effect_t* get_effect(scheduler_t* s);
+int is_scheduler_idle(scheduler_t* s);
+int is_fading(scheduler_t* s);
+void reset_frame_stats(scheduler_t* s);
+
+#endif
@@ -0,0 +1,104 @@
+/**
+ * strip.cpp
+ *
+ * Integer kernels drawing whole LED strips (CRGB arrays) with lib8tion,
+ * for the effects FastLED's own bulk functions (nscale8_video,
+ * fadeToBlackBy, blend) do not cover
+ *
+ * Author: Vincent Lacasse (lacasse4@yahoo.com)
+ * Date: 2026-10-18
+ * Target system: Arduino Uno
+ *
+ */
+
+/*
+ * The Uno has no FPU and no divide instruction: a float sin() costs
+ * thousands of cycles, an int division a few hundred.  These kernels only
+ * add, shift and use the 8x8 multiplier (scale8()), with the divisions
+ * hoisted out of the pixel loops.
+ */
+
+#include "strip.h"
+#include "effects.h"
+
+/**
+ * @brief fill the strip with sine waves of the color's components
+ * @param phase angle of each component (red, green, blue) at the first pixel
+ * @param step angle from one pixel to the next
+ * @details a component goes from 0 to its value in 'color', as
+ * @details ((sin(angle) * 127 + 128) / 255) * component did.
+ */
+void fill_sine(CRGB* leds, int count, CRGB color, const uint16_t phase[3], uint16_t step)
+{
+  uint16_t r = phase[0];
+  uint16_t g = phase[1];
+  uint16_t b = phase[2];
+
+  for (int i = 0; i < count; i++) {
+    leds[i].r = scale8(color.r, sin8(r >> 8));
+    leds[i].g = scale8(color.g, sin8(g >> 8));
+    leds[i].b = scale8(color.b, sin8(b >> 8));
+    r += step;
+    g += step;
+    b += step;
+  }
+}
+
+/**
+ * @brief fill the strip with one turn of the color wheel, from 'start'
+ * @param shift intensity scale down (bits)
+ * @details the wheel position advances in 8.8 fixed point: one division per strip
+ */
+void fill_wheel(CRGB* leds, int count, uint8_t start, uint8_t shift)
+{
+  uint16_t position = start << 8;
+  uint16_t step = count > 0 ? 65536UL / count : 0;
+
+  for (int i = 0; i < count; i++) {
+    CRGB color = wheel(position >> 8);
+    leds[i].r = color.r >> shift;
+    leds[i].g = color.g >> shift;
+    leds[i].b = color.b >> shift;
+    position += step;
+  }
+}
+
+/**
+ * @brief fill the strip with the colors of the fire effect's heat map
+ * @param reversed true: the first cell is the last pixel
+ * @details full range colors: the former palette (0x40 at most) times 4
+ */
+void fill_heat(CRGB* leds, const uint8_t* heat, int count, int reversed)
+{
+  for (int i = 0; i < count; i++) {
+    // scale 'heat' down from 0-255 to 0-191 (x / 255 is (x + 1 + x / 256) / 256 for 16 bits x)
+    uint16_t x = heat[i] * 191 + 127;
+    uint8_t t192 = (x + 1 + (x >> 8)) >> 8;
+    // the ramp is within a third
+    uint8_t ramp = (t192 & 0x3F) << 2;
+    CRGB* led = &leds[reversed ? count - 1 - i : i];
+
+    if (t192 > 0x80) *led = CRGB(0xFF, 0xFF, ramp);      // hottest
+    else if (t192 > 0x40) *led = CRGB(0x80, ramp, 0);    // middle
+    else *led = CRGB(ramp, 0, 0);                        // coolest
+  }
+}
+
+/**
+ * @brief fade pixels to black by 'fade' (/256), each with a 'chance' (/256)
+ */
+void fade_strip_random(CRGB* leds, int count, uint8_t fade, uint8_t chance)
+{
+  for (int i = 0; i < count; i++) {
+    if (random8() < chance) leds[i].fadeToBlackBy(fade);
+  }
+}
+
+/**
+ * @brief scale the strip down by 2^shift
+ * @details with FASTLED_SCALE8_FIXED (the default), nscale8() by 255 >> shift is exactly a right shift
+ */
+void scale_down_strip(CRGB* leds, int count, uint8_t shift)
+{
+  nscale8(leds, count, 255 >> shift);
+}
@@ -0,0 +1,32 @@
+/**
+ * strip.h
+ *
+ * Integer kernels drawing whole LED strips (CRGB arrays) with lib8tion,
+ * for the effects FastLED's own bulk functions (nscale8_video,
+ * fadeToBlackBy, blend) do not cover
+ *
+ * Author: Vincent Lacasse (lacasse4@yahoo.com)
+ * Date: 2026-10-18
+ * Target system: Arduino Uno
+ *
+ */
+
+#ifndef _STRIP_H
+#define _STRIP_H
+
+#include <stdint.h>
+#include <FastLED.h>
+
+/*
+ * Angles are 16 bits, a full turn is 65536 (sin16() / sin8() units):
+ * they wrap around for free.
+ */
+#define STRIP_RADIAN   10430        // 65536 / (2 * pi)
+
+void fill_sine(CRGB* leds, int count, CRGB color, const uint16_t phase[3], uint16_t step);
+void fill_wheel(CRGB* leds, int count, uint8_t start, uint8_t shift);
+void fill_heat(CRGB* leds, const uint8_t* heat, int count, int reversed);
+void fade_strip_random(CRGB* leds, int count, uint8_t fade, uint8_t chance);
+void scale_down_strip(CRGB* leds, int count, uint8_t shift);
+
+#endif
@@ -0,0 +1,264 @@
+/**
+ * acquisition.cpp
+ *
+ * C module acquiring blocks of ADC samples for a signal, through
+ * interchangeable backends (Due ADC with DMA, host mock)
+ *
+ * Author: Vincent Lacasse (lacasse4@yahoo.com)
+ * Date: 2026-10-18
+ * Target system: Arduino Due
+ *
+ */
+
+/*
+ * The acquisition owns a ring of 'depth' blocks of 'block_size' samples.
+ * Blocks tail to head-1 are complete and wait for the loop, block head is
+ * being filled by the backend and block head+1 is the next one.
+ *
+ * As with the sample queue (sample_queue.cpp), the backend (producer) only
+ * writes 'head' and the loop (consumer) only writes 'tail', with release
+ * stores and acquire loads: no critical zone is needed.
+ *
+ * When the loop holds every other block, complete_block() cannot publish
+ * the block that was just filled without giving away a block the loop has
+ * not read.  The block is dropped instead: it becomes the next block (the
+ * slot pointers of head and head+1 are swapped, the loop never reads them).
+ *
+ * With several channels (set_acquisition_channels()), a block holds
+ * interleaved samples: one sample of each channel, in the order given,
+ * then the next one.  The sampling frequency is the frequency of each
+ * channel.
+ */
+
+#include <stdlib.h>
+#include "acquisition.h"
+
+struct acquisition {
+    const acquisition_backend_t* backend;
+    void* context;               // backend's own data
+    int channel[ACQUISITION_MAX_CHANNELS];  // Arduino analog pins, in sample order
+    int channel_count;           // number of interleaved channels
+    double sampling_frequency;   // in Hertz
+    int block_size;              // samples in a block
+    int depth;                   // blocks in the ring
+    uint16_t* buffer;            // depth * block_size samples
+    uint16_t** slot;             // block of each ring position
+    int head;                    // block being filled (backend only)
+    int tail;                    // oldest complete block (loop only)
+    uint32_t dropped;            // blocks dropped because the loop fell behind (backend only)
+    int running;
+};
+
+/**
+ * @brief empty the ring: every block back in its place, nothing dropped
+ */
+static void reset_ring(acquisition_t* acquisition)
+{
+  for (int i = 0; i < acquisition->depth; i++) {
+    acquisition->slot[i] = acquisition->buffer + i * acquisition->block_size;
+  }
+  __atomic_store_n(&acquisition->head, 0, __ATOMIC_RELEASE);
+  __atomic_store_n(&acquisition->tail, 0, __ATOMIC_RELEASE);
+  __atomic_store_n(&acquisition->dropped, 0, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief create an acquisition of blocks of 'block_size' samples
+ * @param backend the backend filling the blocks (due_adc_backend or a mock)
+ * @param context backend's own data (NULL for due_adc_backend)
+ * @param channel Arduino analog pin (A0 to A11)
+ * @param depth number of blocks, at least ACQUISITION_MIN_DEPTH
+ * @returns the acquisition, or NULL if out of memory or if a size is invalid
+ * @details with a streaming signal, make block_size the hop (times the
+ * @details decimation factor): the loop may fall depth-2 hops behind
+ * @details without losing a block.
+ */
+acquisition_t* create_acquisition(const acquisition_backend_t* backend, void* context, int channel,
+                                  double sampling_frequency, int block_size, int depth)
+{
+  if (block_size <= 0 || depth < ACQUISITION_MIN_DEPTH) return NULL;
+
+  acquisition_t* acquisition = (acquisition_t*) malloc(sizeof(acquisition_t));
+  if (acquisition == NULL) return NULL;
+
+  acquisition->backend = backend;
+  acquisition->context = context;
+  acquisition->channel[0] = channel;
+  acquisition->channel_count = 1;
+  acquisition->sampling_frequency = sampling_frequency;
+  acquisition->block_size = block_size;
+  acquisition->depth = depth;
+  acquisition->running = 0;
+  acquisition->buffer = (uint16_t*) malloc(depth * block_size * sizeof(uint16_t));
+  acquisition->slot = (uint16_t**) malloc(depth * sizeof(uint16_t*));
+
+  if (acquisition->buffer == NULL || acquisition->slot == NULL) {
+    delete_acquisition(acquisition);
+    return NULL;
+  }
+  reset_ring(acquisition);
+  return acquisition;
+}
+
+/**
+ * @brief stop the acquisition and release its resources
+ */
+void delete_acquisition(acquisition_t* acquisition)
+{
+  stop_acquisition(acquisition);
+  free(acquisition->slot);
+  free(acquisition->buffer);
+  free(acquisition);
+}
+
+/**
+ * @brief empty the ring and start the backend
+ * @returns 1 if OK, 0 if the backend failed to start
+ */
+int start_acquisition(acquisition_t* acquisition)
+{
+  stop_acquisition(acquisition);
+  reset_ring(acquisition);
+
+  acquisition->running = acquisition->backend->start(acquisition);
+  return acquisition->running;
+}
+
+/**
+ * @brief stop the backend, complete blocks can still be read
+ */
+void stop_acquisition(acquisition_t* acquisition)
+{
+  if (!acquisition->running) return;
+
+  acquisition->backend->stop(acquisition);
+  acquisition->running = 0;
+}
+
+int is_acquisition_running(acquisition_t* acquisition) { return acquisition->running; }
+
+/**
+ * @brief acquire several channels, interleaved in each block (before start)
+ * @param channels Arduino analog pins, in the order of the samples in a block
+ * @param count at most ACQUISITION_MAX_CHANNELS
+ * @returns 1 if OK, 0 if running, if count is invalid or if the block size 
+ * @returns is not a multiple of count
+ */
+int set_acquisition_channels(acquisition_t* acquisition, const int* channels, int count)
+{
+  if (acquisition->running || count < 1 || count > ACQUISITION_MAX_CHANNELS ||
+      acquisition->block_size % count != 0) {
+    return 0;
+  }
+
+  for (int i = 0; i < count; i++) {
+    acquisition->channel[i] = channels[i];
+  }
+  acquisition->channel_count = count;
+  return 1;
+}
+
+int get_channel_count(acquisition_t* acquisition) { return acquisition->channel_count; }
+
+/**
+ * @brief oldest complete block, or NULL if none (loop side)
+ * @details the block belongs to the loop until release_block()
+ */
+const uint16_t* get_block(acquisition_t* acquisition)
+{
+  int tail = __atomic_load_n(&acquisition->tail, __ATOMIC_RELAXED);
+
+  if (acquisition->backend->poll != NULL && acquisition->running) {
+    acquisition->backend->poll(acquisition);
+  }
+
+  if (tail == __atomic_load_n(&acquisition->head, __ATOMIC_ACQUIRE)) return NULL;
+  return acquisition->slot[tail];
+}
+
+/**
+ * @brief give the block returned by get_block() back to the backend (loop side)
+ */
+void release_block(acquisition_t* acquisition)
+{
+  int tail = __atomic_load_n(&acquisition->tail, __ATOMIC_RELAXED);
+
+  if (tail == __atomic_load_n(&acquisition->head, __ATOMIC_ACQUIRE)) return;
+  __atomic_store_n(&acquisition->tail, (tail + 1) % acquisition->depth, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief move the oldest complete block to a signal (loop side)
+ * @returns 1 if a block was moved, 0 if none was complete
+ * @details the samples go through add_sample(): decimation and streaming apply
+ * @details (single channel acquisitions, see acquire_bank_block() otherwise)
+ */
+int acquire_block(acquisition_t* acquisition, signal_t* signal)
+{
+  const uint16_t* block = get_block(acquisition);
+
+  if (block == NULL) return 0;
+
+  for (int i = 0; i < acquisition->block_size; i++) {
+    add_sample(signal, block[i]);
+  }
+  release_block(acquisition);
+  return 1;
+}
+
+/**
+ * @brief number of blocks dropped because the loop fell behind
+ */
+uint32_t get_dropped_blocks(acquisition_t* acquisition)
+{
+  return __atomic_load_n(&acquisition->dropped, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief backend side getters
+ */
+void* get_backend_context(acquisition_t* acquisition)         { return acquisition->context; }
+int get_channel(acquisition_t* acquisition)                   { return acquisition->channel[0]; }
+int get_channel_at(acquisition_t* acquisition, int index)     { return acquisition->channel[index]; }
+double get_acquisition_frequency(acquisition_t* acquisition)  { return acquisition->sampling_frequency; }
+int get_block_size(acquisition_t* acquisition)                { return acquisition->block_size; }
+
+/**
+ * @brief block being filled (backend side)
+ */
+uint16_t* get_filling_block(acquisition_t* acquisition)
+{
+  return acquisition->slot[__atomic_load_n(&acquisition->head, __ATOMIC_RELAXED)];
+}
+
+/**
+ * @brief block to fill after the current one (backend side)
+ */
+uint16_t* get_next_block(acquisition_t* acquisition)
+{
+  int head = __atomic_load_n(&acquisition->head, __ATOMIC_RELAXED);
+  return acquisition->slot[(head + 1) % acquisition->depth];
+}
+
+/**
+ * @brief the block being filled is full, the backend goes on with the next one (backend side)
+ * @returns 1 if the block was given to the loop, 0 if it was dropped (the
+ * @returns loop holds every other block): it is then the next block
+ */
+int complete_block(acquisition_t* acquisition)
+{
+  int depth = acquisition->depth;
+  int head = __atomic_load_n(&acquisition->head, __ATOMIC_RELAXED);
+  int next = (head + 1) % depth;
+
+  if ((head + 2) % depth == __atomic_load_n(&acquisition->tail, __ATOMIC_ACQUIRE)) {
+    uint16_t* filled = acquisition->slot[head];
+    acquisition->slot[head] = acquisition->slot[next];
+    acquisition->slot[next] = filled;
+    __atomic_store_n(&acquisition->dropped, acquisition->dropped + 1, __ATOMIC_RELAXED);
+    return 0;
+  }
+
+  __atomic_store_n(&acquisition->head, next, __ATOMIC_RELEASE);
+  return 1;
+}
@@ -0,0 +1,66 @@
+/**
+ * acquisition.h
+ *
+ * C module acquiring blocks of ADC samples for a signal, through
+ * interchangeable backends (Due ADC with DMA, host mock)
+ *
+ * Author: Vincent Lacasse (lacasse4@yahoo.com)
+ * Date: 2026-10-18
+ * Target system: Arduino Due
+ *
+ */
+
+#ifndef _ACQUISITION_H
+#define _ACQUISITION_H
+
+#include <stdint.h>
+#include "spectrum.h"
+
+#define ACQUISITION_MIN_DEPTH  3     // a block being filled, the next one and one for the loop
+#define ACQUISITION_MAX_CHANNELS 8    // most channels in an interleaved acquisition
+
+typedef struct acquisition acquisition_t;
+
+/*
+ * A backend fills the acquisition's blocks, one after the other, and calls
+ * complete_block() when the block being filled is full.  The block after it
+ * (get_next_block()) is always free: a DMA can be given both in advance.
+ */
+typedef struct acquisition_backend {
+    const char* name;
+    int (*start)(acquisition_t* acquisition);   // returns 1 if OK, 0 on failure
+    void (*stop)(acquisition_t* acquisition);
+    void (*poll)(acquisition_t* acquisition);   // called by the loop, NULL if interrupt driven
+} acquisition_backend_t;
+
+#if defined(ARDUINO_ARCH_SAM)
+extern const acquisition_backend_t due_adc_backend;
+#endif
+
+acquisition_t* create_acquisition(const acquisition_backend_t* backend, void* context, int channel,
+                                  double sampling_frequency, int block_size, int depth);
+void delete_acquisition(acquisition_t* acquisition);
+
+int start_acquisition(acquisition_t* acquisition);
+void stop_acquisition(acquisition_t* acquisition);
+int is_acquisition_running(acquisition_t* acquisition);
+int set_acquisition_channels(acquisition_t* acquisition, const int* channels, int count);
+int get_channel_count(acquisition_t* acquisition);
+
+// loop side
+const uint16_t* get_block(acquisition_t* acquisition);
+void release_block(acquisition_t* acquisition);
+int acquire_block(acquisition_t* acquisition, signal_t* signal);
+uint32_t get_dropped_blocks(acquisition_t* acquisition);
+
+// backend side
+void* get_backend_context(acquisition_t* acquisition);
+int get_channel(acquisition_t* acquisition);
+int get_channel_at(acquisition_t* acquisition, int index);
+double get_acquisition_frequency(acquisition_t* acquisition);
+int get_block_size(acquisition_t* acquisition);
+uint16_t* get_filling_block(acquisition_t* acquisition);
+uint16_t* get_next_block(acquisition_t* acquisition);
+int complete_block(acquisition_t* acquisition);
+
+#endif
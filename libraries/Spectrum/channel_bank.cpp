@@ -0,0 +1,222 @@
+/**
+ * channel_bank.cpp
+ *
+ * C module analyzing several input channels at once: one signal per
+ * channel, shared window and twiddle tables, batched FFT
+ *
+ * Author: Vincent Lacasse (lacasse4@yahoo.com)
+ * Date: 2026-10-18
+ * Target system: Arduino Due
+ *
+ */
+
+/*
+ * Every channel is a signal of its own (ring, decimator, peak list,
+ * tracking, estimator): get_bank_signal() gives access to the per channel
+ * settings.  The first signal owns the window and twiddle tables, the
+ * others share them (share_tables()): change the tables through the bank
+ * only.  compute_bank_spectra() runs one batched FFT over all channels
+ * (compute_spectra()): each twiddle factor is computed or read once.  The
+ * batch pays off from BATCH_MIN_SIGNALS channels, with a twiddle table for
+ * floating point samples (enable_bank_twiddle_table()).
+ *
+ * Samples come interleaved, as an interleaved acquisition writes them
+ * (see set_acquisition_channels()): sample i goes to channel i % channels.
+ */
+
+#include <stdlib.h>
+#include "channel_bank.h"
+
+struct channel_bank {
+    int channels;                // number of channels
+    signal_t* signal[BANK_MAX_CHANNELS];
+    int next;                    // channel of the next interleaved sample
+};
+
+/**
+ * @brief share the first signal's tables with the other signals
+ */
+static int share_bank_tables(channel_bank_t* bank)
+{
+  for (int i = 1; i < bank->channels; i++) {
+    if (!share_tables(bank->signal[i], bank->signal[0])) return 0;
+  }
+  return 1;
+}
+
+/**
+ * @brief create a bank of 'channels' signals (see create_signal())
+ * @param channels at most BANK_MAX_CHANNELS
+ * @returns the bank, or NULL if out of memory or if channels is invalid
+ */
+channel_bank_t* create_channel_bank(int channels, int length, double sampling_frequency,
+                                    int zero_padding_enabled, int sample_type, int real_fft_enabled)
+{
+  if (channels < 1 || channels > BANK_MAX_CHANNELS) return NULL;
+
+  channel_bank_t* bank = (channel_bank_t*) malloc(sizeof(channel_bank_t));
+  if (bank == NULL) return NULL;
+
+  bank->channels = 0;
+  bank->next = 0;
+  for (int i = 0; i < channels; i++) {
+    bank->signal[i] = create_signal(length, sampling_frequency, zero_padding_enabled,
+                                    sample_type, real_fft_enabled);
+    if (bank->signal[i] == NULL) {
+      delete_channel_bank(bank);
+      return NULL;
+    }
+    bank->channels++;
+  }
+
+  if (!share_bank_tables(bank)) {
+    delete_channel_bank(bank);
+    return NULL;
+  }
+  return bank;
+}
+
+/**
+ * @brief release bank resources (the owner of the tables goes last)
+ */
+void delete_channel_bank(channel_bank_t* bank)
+{
+  for (int i = bank->channels - 1; i >= 0; i--) {
+    delete_signal(bank->signal[i]);
+  }
+  free(bank);
+}
+
+/**
+ * @brief getters
+ */
+int get_bank_channels(channel_bank_t* bank)                       { return bank->channels; }
+signal_t* get_bank_signal(channel_bank_t* bank, int channel)      { return bank->signal[channel]; }
+peak_list_t* get_bank_peak_list(channel_bank_t* bank, int channel) { return get_peak_list(bank->signal[channel]); }
+
+/**
+ * @brief set the window type of every channel (see set_window_type())
+ * @returns 1 on success, 0 if out of memory
+ * @details the tables are shared again even on failure: the other channels
+ * @details must not keep the first signal's released tables.
+ */
+int set_bank_window_type(channel_bank_t* bank, FFTWindow window_type)
+{
+  int ok = set_window_type(bank->signal[0], window_type);
+  return share_bank_tables(bank) && ok;
+}
+
+/**
+ * @brief enable or disable the twiddle table of every channel (see enable_twiddle_table())
+ * @returns 1 on success, 0 if out of memory
+ */
+int enable_bank_twiddle_table(channel_bank_t* bank, int enabled)
+{
+  int ok = enable_twiddle_table(bank->signal[0], enabled);
+  return share_bank_tables(bank) && ok;
+}
+
+/**
+ * @brief use the const tables for every channel (see enable_const_tables())
+ * @returns 1 on success, 0 if out of memory
+ */
+int enable_bank_const_tables(channel_bank_t* bank, int enabled)
+{
+  int ok = enable_const_tables(bank->signal[0], enabled);
+  return share_bank_tables(bank) && ok;
+}
+
+/**
+ * @brief enable streaming on every channel (see enable_streaming())
+ * @returns 1 on success, 0 if out of memory
+ */
+int enable_bank_streaming(channel_bank_t* bank, int hop)
+{
+  for (int i = 0; i < bank->channels; i++) {
+    if (!enable_streaming(bank->signal[i], hop)) return 0;
+  }
+  bank->next = 0;
+  return 1;
+}
+
+/**
+ * @brief add interleaved samples: sample i goes to channel i % channels
+ * @param count number of samples (all channels), the channel of the next
+ * @param count sample is kept from one call to the next
+ */
+void add_interleaved_samples(channel_bank_t* bank, const uint16_t* samples, int count)
+{
+  int channel = bank->next;
+
+  for (int i = 0; i < count; i++) {
+    add_sample(bank->signal[channel], samples[i]);
+    if (++channel == bank->channels) channel = 0;
+  }
+  bank->next = channel;
+}
+
+/**
+ * @brief move the oldest complete block of an interleaved acquisition to the bank
+ * @returns 1 if a block was moved, 0 if none was complete
+ */
+int acquire_bank_block(acquisition_t* acquisition, channel_bank_t* bank)
+{
+  const uint16_t* block = get_block(acquisition);
+
+  if (block == NULL) return 0;
+
+  add_interleaved_samples(bank, block, get_block_size(acquisition));
+  release_block(acquisition);
+  return 1;
+}
+
+/**
+ * @brief return true when every channel holds a frame (see is_buffer_full())
+ */
+int is_bank_full(channel_bank_t* bank)
+{
+  for (int i = 0; i < bank->channels; i++) {
+    if (!is_buffer_full(bank->signal[i])) return 0;
+  }
+  return 1;
+}
+
+/**
+ * @brief load the latest frame of every channel (see load_latest_frame())
+ */
+void load_latest_frames(channel_bank_t* bank)
+{
+  for (int i = 0; i < bank->channels; i++) {
+    load_latest_frame(bank->signal[i]);
+  }
+}
+
+/**
+ * @brief remove the bias of every channel
+ */
+void remove_bank_bias(channel_bank_t* bank)
+{
+  for (int i = 0; i < bank->channels; i++) {
+    remove_bias(bank->signal[i]);
+  }
+}
+
+/**
+ * @brief compute the spectrum of every channel with one batched FFT
+ * @details see compute_spectra(): below BATCH_MIN_SIGNALS channels, or for
+ * @details floating point channels without a twiddle table, each channel has its own FFT.
+ */
+void compute_bank_spectra(channel_bank_t* bank)
+{
+  compute_spectra(bank->signal, bank->channels);
+}
+
+/**
+ * @brief compute the peak list of every channel (see compute_peak_list())
+ */
+void compute_bank_peak_lists(channel_bank_t* bank, double low_frequency, double high_frequency)
+{
+  for (int i = 0; i < bank->channels; i++) {
+    compute_peak_list(bank->signal[i], low_frequency, high_frequency);
+  }
+}
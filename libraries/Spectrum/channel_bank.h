@@ -0,0 +1,48 @@
+/**
+ * channel_bank.h
+ *
+ * C module analyzing several input channels at once: one signal per
+ * channel, shared window and twiddle tables, batched FFT
+ *
+ * Author: Vincent Lacasse (lacasse4@yahoo.com)
+ * Date: 2026-10-18
+ * Target system: Arduino Due
+ *
+ */
+
+#ifndef _CHANNEL_BANK_H
+#define _CHANNEL_BANK_H
+
+#include <stdint.h>
+#include "spectrum.h"
+#include "acquisition.h"
+
+#define BANK_MAX_CHANNELS  BATCH_MAX_SIGNALS
+
+typedef struct channel_bank channel_bank_t;
+
+channel_bank_t* create_channel_bank(int channels, int length, double sampling_frequency,
+                                    int zero_padding_enabled, int sample_type = SAMPLE_DOUBLE,
+                                    int real_fft_enabled = REAL_FFT_DISABLED);
+void delete_channel_bank(channel_bank_t* bank);
+
+int get_bank_channels(channel_bank_t* bank);
+signal_t* get_bank_signal(channel_bank_t* bank, int channel);
+peak_list_t* get_bank_peak_list(channel_bank_t* bank, int channel);
+
+// settings of every channel (the tables stay shared)
+int set_bank_window_type(channel_bank_t* bank, FFTWindow window_type);
+int enable_bank_twiddle_table(channel_bank_t* bank, int enabled);
+int enable_bank_const_tables(channel_bank_t* bank, int enabled);
+int enable_bank_streaming(channel_bank_t* bank, int hop);
+
+void add_interleaved_samples(channel_bank_t* bank, const uint16_t* samples, int count);
+int acquire_bank_block(acquisition_t* acquisition, channel_bank_t* bank);
+int is_bank_full(channel_bank_t* bank);
+void load_latest_frames(channel_bank_t* bank);
+
+void remove_bank_bias(channel_bank_t* bank);
+void compute_bank_spectra(channel_bank_t* bank);
+void compute_bank_peak_lists(channel_bank_t* bank, double low_frequency, double high_frequency);
+
+#endif
@@ -0,0 +1,1378 @@
+/**
+ * const_tables.cpp
+ * 
+ * const (flash) window and sine tables of the Spectrum library
+ * Generated by extras/gen_tables.py, do not edit.
+ * 
+ * Author: Vincent Lacasse (lacasse4@yahoo.com)
+ * Date: 2026-10-18
+ * Target system: Arduino Due
+ * 
+ */
+
+#include <stddef.h>
+#include "tables.h"
+#include "spectrum.h"
+#include "fixed_fft.h"
+
+const double hamming_1024_double[512] = {
+  0.080000000000000016, 0.080008676307597004, 0.080034704903091058, 0.080078084804603378, 0.080138814375710632, 0.08021689132550669, 0.080312312708688605, 0.080425074925668416,
+  0.080555173722708207, 0.080702604192081251, 0.080867360772256647, 0.081049437248109257, 0.081248826751154302, 0.081465521759806314, 0.081699514099662862, 0.081950794943813021,
+  0.082219354813170276, 0.082505183576830121, 0.082808270452452259, 0.083128604006667328, 0.083466172155508056, 0.083820962164865398, 0.084192960650968707, 0.084582153580890551,
+  0.084988526273076404, 0.085412063397897919, 0.085852748978231863, 0.086310566390062349, 0.086785498363108116, 0.087277526981473952, 0.087786633684326709, 0.088312799266595299,
+  0.088856003879695167, 0.08941622703227714, 0.089993447591000364, 0.090587643781329552, 0.091198793188356331, 0.091826872757644951, 0.092471858796101647, 0.093133726972868813,
+  0.09381245232024249, 0.094508009234614609, 0.095220371477438392, 0.095949512176218443, 0.09669540382552444, 0.097458018288028581, 0.098237326795567181, 0.099033299950225806,
+  0.099845907725448158, 0.10067511946716912, 0.10152090389497048, 0.10238322910326175, 0.1032620625624831, 0.10415737112033269, 0.10506912100301724, 0.10599727781652624,
+  0.10694180654792912, 0.10790267156669636, 0.10887983662604328, 0.1098732648642976, 0.11088291880628998, 0.11190876036476743, 0.11295075084183032, 0.11400885093039226,
+  0.11508302071566251, 0.11617321967665223, 0.11727940668770254, 0.11840154002003617, 0.11953957734333159, 0.12069347572731981, 0.12186319164340376, 0.12304868096630051,
+  0.12424989897570554, 0.12546680035798008, 0.12669933920786008, 0.12794746903018828, 0.12921114274166789, 0.13049031267263872, 0.13178493056887575, 0.13309494759340895,
+  0.13442031432836582, 0.13576098077683568, 0.1371168963647556, 0.13848800994281796, 0.1398742697884004, 0.14127562360751678, 0.1426920185367897, 0.14412340114544486,
+  0.14556971743732672, 0.14703091285293496, 0.14850693227148332, 0.14999772001297818, 0.15150321984031956, 0.15302337496142238, 0.15455812803135854, 0.15610742115452064,
+  0.15767119588680573, 0.15924939323781984, 0.16084195367310361, 0.16244881711637782, 0.16406992295181, 0.16570521002630062, 0.16735461665179013, 0.16901808060758639,
+  0.17069553914271124, 0.17238692897826807, 0.17409218630982859, 0.17581124680984012, 0.17754404563005188, 0.17929051740396135, 0.18105059624928022, 0.18282421577041957,
+  0.18461130906099454, 0.18641180870634805, 0.18822564678609432, 0.19005275487668077, 0.191893064053969, 0.19374650489583517, 0.19561300748478849, 0.19749250141060909,
+  0.19938491577300388, 0.20129017918428099, 0.2032082197720429, 0.20513896518189789, 0.20708234258018915, 0.2090382786567424, 0.21100669962763136, 0.21298753123796105,
+  0.21498069876466919, 0.21698612701934467, 0.21900374035106396, 0.221033462649245, 0.22307521734651825, 0.22512892742161511, 0.22719451540227315, 0.22927190336815911,
+  0.23136101295380773, 0.2334617653515782, 0.2355740813146272, 0.23769788115989804, 0.23983308477112658, 0.24197961160186376, 0.24413738067851359, 0.2463063106033882,
+  0.24848631955777811, 0.25067732530503856, 0.25287924519369231, 0.2550919961605469, 0.2573154947338282, 0.25954965703632954, 0.26179439878857536, 0.26404963531200087,
+  0.26631528153214618, 0.26859125198186545, 0.27087746080455138, 0.27317382175737359, 0.27548024821453215, 0.27779665317052543, 0.28012294924343201, 0.28245904867820715,
+  0.28480486334999311, 0.28716030476744359, 0.28952528407606176, 0.2918997120615523, 0.29428349915318652, 0.29667655542718163, 0.29907879061009279, 0.30149011408221832,
+  0.30391043488101832, 0.3063396617045463, 0.30877770291489293, 0.31122446654164293, 0.31367986028534495, 0.31614379152099292, 0.31861616730152026, 0.32109689436130628,
+  0.32358587911969439, 0.32608302768452196, 0.32858824585566271, 0.33110143912857992, 0.33362251269789145, 0.33615137146094615, 0.33868792002141146, 0.34123206269287187,
+  0.34378370350243881, 0.34634274619437089, 0.34890909423370464, 0.35148265080989671, 0.35406331884047559, 0.35665100097470359, 0.35924559959724967, 0.36184701683187137,
+  0.36445515454510746, 0.36706991434997938, 0.36969119760970282, 0.372318905441409, 0.37495293871987434, 0.37759319808125974, 0.38023958392685953, 0.38289199642685795,
+  0.38555033552409534, 0.38821450093784243, 0.39088439216758358, 0.39355990849680766, 0.39624094899680745, 0.39892741253048702, 0.40161919775617705, 0.40431620313145739,
+  0.40701832691698814, 0.40972546718034675, 0.41243752179987414, 0.4151543884685262, 0.41787596469773391, 0.42060214782126887, 0.42333283499911656, 0.42606792322135556,
+  0.42880730931204369, 0.43155088993310997, 0.43429856158825253, 0.4370502206268434, 0.43980576324783816, 0.44256508550369156, 0.4453280833042792, 0.44809465242082358,
+  0.45086468848982625, 0.45363808701700453, 0.45641474338123383, 0.45919455283849359, 0.46197741052581887, 0.46476321146525634, 0.467551850567824, 0.47034322263747558,
+  0.47313722237506894, 0.47593374438233826, 0.47873268316586987, 0.48153393314108178, 0.48433738863620712, 0.48714294389627955, 0.48995049308712346, 0.49275993029934584,
+  0.49557114955233195, 0.49838404479824255, 0.50119850992601522, 0.50401443876536656, 0.50683172509079755, 0.50965026262560065, 0.51246994504586885, 0.51529066598450624,
+  0.51811231903524124, 0.52093479775663987, 0.52375799567612136, 0.52658180629397466, 0.52940612308737567, 0.53223083951440597, 0.53505584901807168, 0.53788104503032319,
+  0.54070632097607507, 0.54353157027722687, 0.54635668635668277, 0.54918156264237306, 0.5520060925712732, 0.55483016959342468, 0.55765368717595398, 0.56047653880709136,
+  0.56329861800018854, 0.56611981829773639, 0.56894003327538023, 0.57175915654593468, 0.57457708176339695, 0.57739370262695833, 0.58020891288501453, 0.58302260633917369,
+  0.58583467684826229, 0.58864501833232952, 0.59145352477664814, 0.59426009023571513, 0.59706460883724688, 0.59986697478617346, 0.60266708236862976, 0.60546482595594342,
+  0.60826010000861874, 0.61105279908031906, 0.61384281782184358, 0.61663005098510171, 0.61941439342708349, 0.62219574011382628, 0.62497398612437605, 0.62774902665474608,
+  0.63052075702187016, 0.6332890726675513, 0.63605386916240669, 0.63881504220980667, 0.64157248764980934, 0.64432610146308911, 0.64707577977486164, 0.6498214188588014,
+  0.65256291514095521, 0.6553001652036492, 0.65803306578938969, 0.66076151380475889, 0.66348540632430331, 0.66620464059441742, 0.6689191140372186, 0.67162872425441766,
+  0.6743333690311808, 0.67703294633998623, 0.67972735434447273, 0.68241649140328098, 0.68510025607388791, 0.68777854711643349, 0.69045126349753982, 0.69311830439412236,
+  0.69577956919719341, 0.6984349575156571, 0.70108436918009676, 0.70372770424655351, 0.70636486300029644, 0.70899574595958392, 0.71162025387941708, 0.71423828775528253,
+  0.71684974882688834, 0.71945453858188846, 0.72205255875959984, 0.72464371135470862, 0.72722789862096715, 0.72980502307488138, 0.73237498749938834, 0.73493769494752348,
+  0.7374930487460778, 0.74004095249924418, 0.7425813100922547, 0.74511402569500529, 0.74763900376567161, 0.7501561490543126, 0.75266536660646421, 0.75516656176672037,
+  0.75765964018230481, 0.76014450780663001, 0.76262107090284403, 0.76508923604736823, 0.76754891013341942, 0.77000000037452443, 0.77244241430801797, 0.77487605979853302,
+  0.77730084504147401, 0.77971667856648208, 0.78212346924088394, 0.78452112627313109, 0.78690955921622407, 0.78928867797112379, 0.79165839279015171, 0.79401861428037435,
+  0.79636925340697595, 0.79871022149661675, 0.80104143024077823, 0.80336279169909508, 0.80567421830267083, 0.80797562285738334, 0.81026691854717225, 0.8125480189373151,
+  0.81481883797768706, 0.81707929000600821, 0.81932928975107322, 0.82156875233596982, 0.82379759328127977, 0.82601572850826521, 0.82822307434204168, 0.8304195475147329,
+  0.83260506516861388, 0.83477954485923433, 0.83694290455853104, 0.83909506265792022, 0.84123593797137752, 0.84336544973849947, 0.8454835176275507, 0.8475900617384946,
+  0.84968500260600588, 0.8517682612024704, 0.85383975894096453, 0.85589941767822086, 0.85794715971757474, 0.85998290781189723, 0.86200658516650641, 0.86401811544206719,
+  0.86601742275746907, 0.86800443169268893, 0.86997906729163699, 0.87194125506498321, 0.87389092099296839, 0.87582799152819502, 0.87775239359840374, 0.87966405460922759,
+  0.88156290244693225, 0.88344886548113533, 0.88532187256750894, 0.88718185305046371, 0.88902873676581329, 0.89086245404342224, 0.89268293570983304, 0.89449011309087689,
+  0.89628391801426288, 0.898064282812151, 0.89983114032370337, 0.90158442389761895, 0.90332406739464788, 0.90505000519008472, 0.90676217217624633, 0.90846050376492637,
+  0.91014493588983258, 0.91181540500900271, 0.91347184810720272, 0.91511420269830257, 0.91674240682763464, 0.91835639907432975, 0.91995611855363513, 0.92154150491921027,
+  0.92311249836540421, 0.92466903962951075, 0.92621106999400471, 0.92773853128875683, 0.92925136589322788, 0.93074951673864204, 0.93223292731014062, 0.93370154164891295,
+  0.93515530435430816, 0.93659416058592426, 0.93801805606567767, 0.93942693707985025, 0.94082075048111591, 0.94219944369054454, 0.94356296469958723, 0.94491126207203657,
+  0.94624428494596735, 0.94756198303565597, 0.94886430663347632, 0.9501512066117761, 0.95142263442472852, 0.95267854211016523, 0.95391888229138422, 0.9551436081789384,
+  0.95635267357239884, 0.95754603286209961, 0.95872364103085683, 0.95988545365566735, 0.96103142690938481, 0.96216151756237234, 0.9632756829841338, 0.96437388114492184,
+  0.96545607061732297, 0.96652221057782128, 0.96757226080833703, 0.96860618169774559, 0.96962393424336968, 0.97062548005245231, 0.97161078134360435, 0.97257980094822982,
+  0.97353250231192789, 0.97446884949587231, 0.97538880717816645, 0.97629234065517645, 0.97717941584283952, 0.97804999927795078, 0.97890405811942482, 0.97974156014953429,
+  0.98056247377512618, 0.98136676802881295, 0.98215441257014102, 0.98292537768673494, 0.98367963429541883, 0.98441715394331264, 0.98513790880890661, 0.98584187170310955,
+  0.98652901607027554, 0.98719931598920485, 0.98785274617412244, 0.98848928197563146, 0.98910889938164326, 0.98971157501828277, 0.99029728615077106, 0.99086601068428226,
+  0.99141772716477727, 0.99195241477981289, 0.99247005335932748, 0.9929706233764013, 0.99345410594799333, 0.99392048283565348, 0.99436973644621074, 0.99480184983243669,
+  0.99521680669368517, 0.99561459137650665, 0.99599518887523919, 0.996358584832574, 0.99670476554009801, 0.99703371793880946, 0.99734542961961203, 0.99763988882378229,
+  0.99791708444341287, 0.99817700602183224, 0.99841964375399905, 0.99864498848687133, 0.99885303171975259, 0.99904376560461206, 0.99921718294638084, 0.99937327720322311,
+  0.99951204248678338, 0.99963347356240817, 0.99973756584934392, 0.9998243154209091, 0.99989371900464308, 0.99994577398242912, 0.99998047839059345, 0.99999783091997885,
+};
+
+const double hamming_2048_double[1024] = {
+  0.080000000000000016, 0.080002166963253685, 0.080008667832598412, 0.080019502546785803, 0.08003467100373568, 0.080054173060537248, 0.080078008533450373, 0.080106177197907191,
+  0.080138678788514384, 0.080175512999055731, 0.080216679482494724, 0.080262177850978111, 0.080312007675839292, 0.080366168487602752, 0.080424659775988006, 0.080487480989914872,
+  0.080554631537508137, 0.080626110786103711, 0.080701918062254019, 0.080782052651735048, 0.080866513799552175, 0.080955300709948108, 0.081048412546409876, 0.081145848431676937,
+  0.081247607447749393, 0.081353688635896482, 0.081464090996666072, 0.081578813489893431, 0.081697855034711442, 0.081821214509560869, 0.081948890752200521, 0.082080882559718571,
+  0.082217188688543774, 0.082357807854457121, 0.082502738732603886, 0.082651979957506394, 0.082805530123076565, 0.08296338778262935, 0.083125551448896218, 0.083292019594039368,
+  0.083462790649665941, 0.08363786300684295, 0.083817235016112213, 0.08400090498750612, 0.084188871190563452, 0.084381131854345759, 0.084577685167453842, 0.084778529278045189,
+  0.084983662293851014, 0.085193082282194299, 0.085406787270008, 0.085624775243853646, 0.085847044149940266, 0.086073591894143653, 0.086304416342026347, 0.086539515318857396,
+  0.086778886609633177, 0.087022527959098095, 0.087270437071765794, 0.087522611611940915, 0.087779049203741077, 0.088039747431119031, 0.088304703837885856, 0.088573915927733615,
+  0.088847381164259387, 0.089125096970988638, 0.089407060731399868, 0.089693269788949148, 0.089983721447095155, 0.090278412969324484, 0.090577341579177628, 0.090880504460274847,
+  0.091187898756343144, 0.091499521571242692, 0.091815369968994476, 0.092135440973807603, 0.092459731570107839, 0.092788238702565529, 0.093120959276124682, 0.093457890156031953,
+  0.093799028167866394, 0.094144370097569097, 0.094493912691473669, 0.094847652656336878, 0.095205586659369512, 0.095567711328267912, 0.095934023251245948, 0.096304518977066544,
+  0.096679195015074937, 0.097058047835231087, 0.097441073868143102, 0.097828269505100762, 0.098219631098109661, 0.098615154959925511, 0.099014837364088837, 0.099418674544960173,
+  0.099826662697755419, 0.10023879797858187, 0.10065507650447425, 0.10107549435343138, 0.10150004756445313, 0.10192873213757775, 0.10236154403391945, 0.10279847917570673,
+  0.10323953344632036, 0.10368470269033248, 0.1041339827135459, 0.10458736928303308, 0.10504485812717651, 0.10550644493570882, 0.10597212535975314, 0.10644189501186441,
+  0.10691574946607063, 0.10739368425791446, 0.10787569488449528, 0.1083617768045117, 0.10885192543830441, 0.10934613616789912, 0.10984440433705017, 0.11034672525128458,
+  0.11085309417794587, 0.11136350634623898, 0.11187795694727526, 0.11239644113411756, 0.11291895402182595, 0.11344549068750376, 0.1139760461703439, 0.11451061547167596,
+  0.11504919355501275, 0.11559177534609816, 0.11613835573295472, 0.11668892956593202, 0.11724349165775494, 0.11780203678357271, 0.11836455968100812, 0.11893105505020707,
+  0.11950151755388844, 0.1200759418173945, 0.12065432242874147, 0.12123665393867045, 0.12182293086069906, 0.12241314767117262, 0.1230072988093166, 0.12360537867728888,
+  0.12420738164023271, 0.12481330202632912, 0.12542313412685135, 0.12603687219621773, 0.12665451045204634, 0.1272760430752094, 0.12790146420988796, 0.12853076796362706,
+  0.12916394840739154, 0.12980099957562158, 0.13044191546628903, 0.13108669004095397, 0.13173531722482151, 0.13238779090679931, 0.13304410493955465, 0.13370425313957285,
+  0.1343682292872152, 0.13503602712677781, 0.13570764036655025, 0.13638306267887512, 0.13706228770020745, 0.13774530903117493, 0.13843212023663776, 0.13912271484574973,
+  0.13981708635201889, 0.14051522821336893, 0.14121713385220097, 0.14192279665545532, 0.14263220997467385, 0.14334536712606272, 0.14406226139055522, 0.14478288601387501,
+  0.14550723420660022, 0.14623529914422673, 0.14696707396723296, 0.14770255178114433, 0.14844172565659836, 0.14918458862940953, 0.1499311337006356, 0.15068135383664277,
+  0.15143524196917252, 0.152192790995408, 0.15295399377804098, 0.15371884314533896, 0.15448733189121294, 0.1552594527752853, 0.15603519852295766, 0.15681456182548004,
+  0.15759753534001925, 0.1583841116897281, 0.15917428346381507, 0.15996804321761421, 0.16076538347265484, 0.16156629671673262, 0.16237077540397976, 0.16317881195493644,
+  0.1639903987566223, 0.16480552816260774, 0.16562419249308646, 0.16644638403494744, 0.16727209504184781, 0.16810131773428583, 0.16893404429967407, 0.16977026689241309,
+  0.17060997763396546, 0.1714531686129297, 0.172299831885115, 0.17314995947361633, 0.17400354336888901, 0.17486057552882478, 0.17572104787882686, 0.17658495231188703,
+  0.17745228068866087, 0.17832302483754542, 0.17919717655475542, 0.18007472760440119, 0.1809556697185658, 0.1818399945973832, 0.18272769390911647, 0.18361875929023608,
+  0.18451318234549874, 0.1854109546480267, 0.18631206773938691, 0.18721651312967091, 0.18812428229757466, 0.18903536669047888, 0.18994975772452971, 0.19086744678471945,
+  0.19178842522496775, 0.19271268436820316, 0.19364021550644478, 0.19457100990088444, 0.19550505878196878, 0.19644235334948229, 0.19738288477262966, 0.19832664419011953,
+  0.19927362271024762, 0.20022381141098067, 0.20117720134004047, 0.20213378351498801, 0.20309354892330844, 0.20405648852249586, 0.20502259324013838, 0.20599185397400382,
+  0.20696426159212505, 0.20793980693288672, 0.20891848080511094, 0.20990027398814398, 0.21088517723194367, 0.21187318125716587, 0.21286427675525216, 0.21385845438851769,
+  0.21485570479023908, 0.2158560185647424, 0.21685938628749207, 0.21786579850517945, 0.21887524573581202, 0.21988771846880251, 0.22090320716505879, 0.22192170225707342,
+  0.2229431941490142, 0.22396767321681404, 0.22499512980826208, 0.22602555424309467, 0.2270589368130862, 0.22809526778214068, 0.22913453738638362, 0.23017673583425402,
+  0.2312218533065965, 0.23226987995675386, 0.23332080591065973, 0.23437462126693193, 0.23543131609696544, 0.23649088044502603, 0.23755330432834421, 0.23861857773720885,
+  0.23968669063506215, 0.24075763295859354, 0.24183139461783504, 0.24290796549625593, 0.24398733545085816, 0.24506949431227221, 0.24615443188485225, 0.24724213794677308,
+  0.24833260225012554, 0.2494258145210137, 0.25052176445965135, 0.25162044174045933, 0.25272183601216219, 0.25382593689788663, 0.2549327339952584, 0.25604221687650081,
+  0.25715437508853284, 0.25826919815306765, 0.2593866755667113, 0.26050679680106159, 0.26162955130280741, 0.2627549284938282, 0.26388291777129336, 0.26501350850776245,
+  0.266146690051285, 0.2672824517255013, 0.26842078282974252, 0.26956167263913189, 0.27070511040468542, 0.27185108535341351, 0.27299958668842234, 0.27415060358901516,
+  0.27530412521079523, 0.2764601406857668, 0.27761863912243834, 0.27877960960592502, 0.27994304119805125, 0.28110892293745382, 0.28227724383968555, 0.28344799289731826,
+  0.28462115908004687, 0.28579673133479294, 0.28697469858580926, 0.2881550497347839, 0.28933777366094482, 0.29052285922116472, 0.29171029525006581, 0.29290007056012546,
+  0.294092173941781, 0.29528659416353603, 0.29648331997206545, 0.29768234009232214, 0.29888364322764294, 0.30008721805985483, 0.30129305324938227, 0.30250113743535312,
+  0.30371145923570642, 0.30492400724729918, 0.30613877004601425, 0.3073557361868674, 0.30857489420411566, 0.30979623261136491, 0.31101973990167842, 0.31224540454768512,
+  0.31347321500168834, 0.31470315969577445, 0.3159352270419219, 0.31716940543211036, 0.31840568323843021, 0.31964404881319197, 0.32088449048903611, 0.32212699657904298,
+  0.32337155537684259, 0.32461815515672587, 0.3258667841737537, 0.32711743066386895, 0.32837008284400637, 0.3296247289122039, 0.33088135704771421, 0.33213995541111552,
+  0.33340051214442346, 0.33466301537120274, 0.33592745319667905, 0.33719381370785095, 0.33846208497360253, 0.33973225504481519, 0.34100431195448105, 0.34227824371781479,
+  0.34355403833236731, 0.34483168377813833, 0.34611116801769004, 0.34739247899625991, 0.34867560464187497, 0.34996053286546513, 0.35124725156097714, 0.3525357486054887,
+  0.35382601185932261, 0.35511802916616125, 0.35641178835316101, 0.35770727723106704, 0.35900448359432807, 0.36030339522121141, 0.36160399987391795, 0.36290628529869795,
+  0.36421023922596585, 0.36551584937041615, 0.36682310343113933, 0.3681319890917375, 0.36944249402044055, 0.37075460587022224, 0.37206831227891668, 0.37338360086933464,
+  0.37470045924938034, 0.37601887501216802, 0.37733883573613891, 0.37866032898517821, 0.3799833423087326, 0.38130786324192684, 0.38263387930568205, 0.38396137800683244,
+  0.38529034683824381, 0.3866207732789308, 0.38795264479417502, 0.38928594883564344, 0.39062067284150609, 0.39195680423655488, 0.39329433043232176, 0.39463323882719759,
+  0.39597351680655068, 0.39731515174284571, 0.39865813099576253, 0.4000024419123156, 0.40134807182697274, 0.40269500806177527, 0.40404323792645636, 0.4053927487185614,
+  0.40674352772356726, 0.40809556221500243, 0.40944883945456667, 0.41080334669225094, 0.41215907116645789, 0.41351600010412182, 0.41487412072082896, 0.41623342022093818,
+  0.4175938857977014, 0.41895550463338416, 0.42031826389938653, 0.42168215075636384, 0.42304715235434809, 0.42441325583286826, 0.42578044832107198, 0.42714871693784673,
+  0.42851804879194111, 0.42988843098208646, 0.43125985059711819, 0.43263229471609749, 0.43400575040843326, 0.43538020473400363, 0.4367556447432781, 0.4381320574774395,
+  0.439509429968506, 0.44088774923945334, 0.44226700230433708, 0.44364717616841509, 0.44502825782826982, 0.44641023427193072, 0.44779309247899701, 0.44917681942076038,
+  0.45056140206032769, 0.45194682735274366, 0.45333308224511393, 0.45472015367672808, 0.45610802857918242, 0.45749669387650355, 0.45888613648527105, 0.46027634331474121,
+  0.46166730126696992, 0.46305899723693644, 0.46445141811266694, 0.46584455077535747, 0.46723838209949814, 0.46863289895299653, 0.47002808819730135, 0.47142393668752641,
+  0.47282043127257445, 0.47421755879526095, 0.47561530609243791, 0.47701365999511836, 0.47841260732859997, 0.47981213491258945, 0.48121222956132664, 0.48261287808370856,
+  0.48401406728341401, 0.4854157839590279, 0.48681801490416521, 0.48822074690759582, 0.48962396675336883, 0.49102766122093711, 0.49243181708528183, 0.49383642111703702,
+  0.49524146008261444, 0.49664692074432781, 0.49805278986051815, 0.49945905418567782, 0.50086570047057599, 0.50227271546238306, 0.50368008590479552, 0.5050877985381611,
+  0.50649584009960347, 0.50790419732314751, 0.50931285693984363, 0.51072180567789349, 0.51213103026277484, 0.51354051741736639, 0.51495025386207294, 0.51636022631495082,
+  0.51777042149183261, 0.51918082610645255, 0.52059142687057158, 0.52200221049410267, 0.52341316368523605, 0.52482427315056401, 0.52623552559520692, 0.52764690772293787,
+  0.52905840623630818, 0.53047000783677234, 0.5318816992248141, 0.53329346710007097, 0.53470529816145973, 0.53611717910730206, 0.53752909663544968, 0.53894103744340938,
+  0.54035298822846878, 0.5417649356878218, 0.5431768665186929, 0.54458876741846407, 0.54600062508479885, 0.54741242621576813, 0.54882415750997549, 0.55023580566668262,
+  0.55164735738593429, 0.55305879936868407, 0.55447011831691895, 0.55588130093378596, 0.55729233392371569, 0.55870320399254914, 0.56011389784766163, 0.56152440219808941,
+  0.56293470375465338, 0.56434478923008591, 0.56575464533915454, 0.56716425879878818, 0.56857361632820158, 0.56998270464902123, 0.57139151048540926, 0.57280002056419022,
+  0.57420822161497398, 0.5756161003702831, 0.57702364356567581, 0.5784308379398726, 0.57983767023487942, 0.58124412719611473, 0.58265019557253206, 0.5840558621167472,
+  0.58546111358516084, 0.58686593673808485, 0.58827031833986654, 0.58967424515901301, 0.59107770396831627, 0.59248068154497813, 0.59388316467073343, 0.59528514013197675,
+  0.5966865947198845, 0.59808751523054138, 0.59948788846506318, 0.60088770122972301, 0.60228694033607311, 0.6036855926010718, 0.60508364484720512, 0.60648108390261346,
+  0.60787789660121361, 0.60927406978282383, 0.61066959029328771, 0.61206444498459822, 0.61345862071502077, 0.61485210434921855, 0.61624488275837452, 0.61763694282031656,
+  0.61902827141964023, 0.62041885544783282, 0.62180868180339632, 0.62319773739197171, 0.62458600912646123, 0.6259734839271528, 0.62736014872184243, 0.62874599044595758,
+  0.63013099604268052, 0.63151515246307111, 0.63289844666618977, 0.63428086561922059, 0.63566239629759325, 0.63704302568510718, 0.63842274077405292, 0.63980152856533534,
+  0.64117937606859554, 0.64255627030233442, 0.64393219829403314, 0.64530714708027748, 0.6466811037068777, 0.64805405522899295, 0.64942598871125123, 0.65079689122787243,
+  0.65216674986278955, 0.65353555170977118, 0.65490328387254149, 0.65626993346490381, 0.65763548761086021, 0.65899993344473429, 0.66036325811129093, 0.66172544876585904,
+  0.66308649257445074, 0.6644463767138844, 0.665805088371903, 0.66716261474729732, 0.66851894305002457, 0.66987406050133025, 0.67122795433386762, 0.67258061179181849,
+  0.67393202013101317, 0.67528216661905094, 0.67663103853541939, 0.67797862317161484, 0.67932490783126143, 0.68066987983023164, 0.68201352649676483, 0.6833558351715876,
+  0.6846967932080319, 0.68603638797215538, 0.68737460684285956, 0.68871143721200911, 0.69004686648455082, 0.69138088207863158, 0.69271347142571771, 0.69404462197071293,
+  0.69537432117207654, 0.69670255650194235, 0.69802931544623548, 0.69935458550479146, 0.70067835419147295, 0.70200060903428851, 0.70332133757550896, 0.70464052737178584,
+  0.70595816599426753, 0.70727424102871717, 0.70858874007562955, 0.7099016507503475, 0.71121296068317874, 0.71252265751951294, 0.71383072891993715, 0.71513716256035309,
+  0.71644194613209233, 0.71774506734203325, 0.71904651391271546, 0.72034627358245717, 0.72164433410546924, 0.72294068325197181, 0.724235308808308, 0.72552819857706086,
+  0.72681934037716645, 0.7281087220440301, 0.72939633142963989, 0.73068215640268208, 0.73196618484865428, 0.7332484046699812, 0.73452880378612606, 0.73580737013370801,
+  0.73708409166661182, 0.73835895635610482, 0.73963195219094813, 0.74090306717751031, 0.74217228933988055, 0.74343960671998177, 0.74470500737768242, 0.74596847939091004,
+  0.74723001085576257, 0.74848958988662129, 0.74974720461626243, 0.75100284319596899, 0.75225649379564241, 0.75350814460391402, 0.75475778382825642, 0.7560053996950945,
+  0.75725098044991634, 0.75849451435738413, 0.75973598970144418, 0.76097539478543852, 0.76221271793221312, 0.76344794748423039, 0.7646810718036765, 0.76591207927257332,
+  0.76714095829288587, 0.76836769728663334, 0.76959228469599639, 0.7708147089834283, 0.77203495863176086, 0.77325302214431579, 0.77446888804501035, 0.77568254487846822,
+  0.77689398121012476, 0.77810318562633662, 0.77931014673448828, 0.78051485316309999, 0.78171729356193442, 0.78291745660210399, 0.78411533097617736, 0.78531090539828607,
+  0.78650416860423078, 0.78769510935158749, 0.78888371641981347, 0.79006997861035277, 0.79125388474674219, 0.79243542367471598, 0.79361458426231146, 0.79479135539997348,
+  0.79596572600065929, 0.79713768499994342, 0.79830722135612076, 0.79947432405031216, 0.80063898208656625, 0.80180118449196569, 0.80296092031672761, 0.80411817863430957,
+  0.80527294854150977, 0.80642521915857257, 0.80757497962928826, 0.80872221912109798, 0.80986692682519312, 0.81100909195661974, 0.81214870375437809, 0.81328575148152527,
+  0.81442022442527606, 0.8155521118971033, 0.81668140323283955, 0.81780808779277669, 0.81893215496176675, 0.82005359414932188, 0.8211723947897136, 0.82228854634207293,
+  0.82340203829048941, 0.8245128601441104, 0.82562100143723938, 0.82672645172943549, 0.82782920060561094, 0.82892923767612969, 0.83002655257690505, 0.83112113496949791,
+  0.83221297454121301, 0.83330206100519766, 0.83438838410053662, 0.83547193359235139, 0.8365526992718938, 0.83763067095664479, 0.83870583849040792, 0.83977819174340773,
+  0.84084772061238211, 0.84191441502068054, 0.84297826491835681, 0.84403926028226461, 0.84509739111615201, 0.84615264745075536, 0.84720501934389336, 0.84825449688056065,
+  0.84930107017302137, 0.85034472936090211, 0.85138546461128528, 0.8524232661188007, 0.85345812410571931, 0.8544900288220445, 0.85551897054560411, 0.85654493958214206,
+  0.85756792626540934, 0.858587920957256, 0.8596049140477211, 0.86061889595512342, 0.86162985712615192, 0.86263778803595592, 0.86364267918823412, 0.86464452111532497,
+  0.86564330437829495, 0.86663901956702871, 0.86763165730031599, 0.86862120822594235, 0.86960766302077452, 0.8705910123908509, 0.87157124707146683, 0.87254835782726392,
+  0.87352233545231539, 0.87449317077021393, 0.87546085463415735, 0.87642537792703545, 0.87738673156151548, 0.87834490648012786, 0.87929989365535144, 0.88025168408969889,
+  0.88120026881580105, 0.88214563889649167, 0.88308778542489141, 0.88402669952449209, 0.88496237234923991, 0.88589479508361935, 0.88682395894273514, 0.88774985517239668,
+  0.888672475049199, 0.8895918098806056, 0.89050785100503049, 0.89142058979191963, 0.89233001764183195, 0.89323612598652091, 0.89413890628901471, 0.89503835004369725,
+  0.89593444877638739, 0.89682719404442046, 0.8977165774367255, 0.89860259057390657, 0.89948522510832052, 0.90036447272415598, 0.90124032513751184, 0.90211277409647495,
+  0.90298181138119848, 0.90384742880397839, 0.90470961820933149, 0.9055683714740721, 0.90642368050738786, 0.90727553725091703, 0.9081239336788236, 0.9089688617978734,
+  0.90981031364750908, 0.91064828129992503, 0.9114827568601428, 0.9123137324660846, 0.91314120028864765, 0.91396515253177846, 0.91478558143254529, 0.91560247926121241,
+  0.91641583832131168, 0.91722565094971686, 0.91803190951671332, 0.9188346064260724, 0.91963373411512117, 0.92042928505481503, 0.92122125174980718, 0.92200962673852116,
+  0.92279440259321888, 0.92357557192007267, 0.92435312735923358, 0.92512706158490143, 0.9258973673053934, 0.92666403726321311, 0.92742706423511867, 0.92818644103219095,
+  0.92894216049990097, 0.92969421551817799, 0.93044259900147597, 0.93118730389884052, 0.93192832319397523, 0.9326656499053082, 0.93339927708605708, 0.93412919782429538,
+  0.93485540524301669, 0.93557789250020029, 0.93629665278887531, 0.93701167933718443, 0.93772296540844835, 0.93843050430122887, 0.93913428934939214, 0.93983431392217176,
+  0.94053057142423024, 0.94122305529572259, 0.94191175901235669, 0.94259667608545628, 0.94327780006202044, 0.9439551245247858, 0.94462864309228589, 0.94529834941891244,
+  0.94596423719497391, 0.94662630014675575, 0.94728453203657947, 0.94793892666286095, 0.94858947786016934, 0.94923617949928496, 0.94987902548725678, 0.95051800976746059,
+  0.9511531263196551, 0.95178436916003928, 0.95241173234130871, 0.9530352099527114, 0.95365479612010351, 0.95427048500600475, 0.9548822708096536, 0.9554901477670612,
+  0.95609411015106693, 0.9566941522713911, 0.95729026847468934, 0.95788245314460529, 0.95847070070182405, 0.95905500560412515, 0.95963536234643287, 0.96021176546087073,
+  0.96078420951681043, 0.96135268912092542, 0.96191719891723959, 0.96247773358717936, 0.96303428784962264, 0.96358685646094955, 0.96413543421509063, 0.96468001594357733,
+  0.96522059651558978, 0.96575717083800505, 0.96628973385544548, 0.96681828055032659, 0.96734280594290356, 0.96786330509131879, 0.96837977309164835, 0.96889220507794793,
+  0.9694005962222989, 0.96990494173485364, 0.97040523686388103, 0.97090147689581074, 0.97139365715527792, 0.97188177300516732, 0.97236581984665649, 0.97284579311925978,
+  0.97332168830087107, 0.97379350090780603, 0.97426122649484459, 0.97472486065527331, 0.9751843990209258, 0.97563983726222525, 0.97609117108822385, 0.97653839624664429,
+  0.97698150852391907, 0.97742050374523093, 0.97785537777455134, 0.97828612651468028, 0.97871274590728419, 0.97913523193293472, 0.97955358061114617, 0.9799677880004134,
+  0.9803778501982483, 0.98078376334121775, 0.98118552360497846, 0.98158312720431451, 0.98197657039317199, 0.98236584946469452, 0.98275096075125845, 0.98313190062450739,
+  0.98350866549538607, 0.98388125181417418, 0.98424965607052028, 0.98461387479347451, 0.98497390455152112, 0.98532974195261114, 0.98568138364419444, 0.98602882631325062,
+  0.98637206668632138, 0.98671110152954011, 0.98704592764866295, 0.9873765418890994, 0.98770294113594093, 0.98802512231399131, 0.98834308238779456, 0.9886568183616653,
+  0.98896632727971445, 0.98927160622587962, 0.98957265232395086, 0.98986946273759857, 0.99016203467039965, 0.99045036536586462, 0.99073445210746292, 0.99101429221864867,
+  0.99128988306288612, 0.99156122204367425, 0.99182830660457144, 0.99209113422921902, 0.99234970244136589, 0.99260400880489108, 0.99285405092382695, 0.99309982644238182,
+  0.9933413330449623, 0.99357856845619463, 0.9938115304409465, 0.99404021680434829, 0.99426462539181293, 0.99448475408905745, 0.99470060082212164, 0.99491216355738854,
+  0.99511944030160293, 0.99532242910189062, 0.9955211280457763, 0.99571553526120238, 0.99590564891654565, 0.99609146722063535, 0.99627298842276946, 0.99645021081273177,
+  0.99662313272080716, 0.99679175251779828, 0.99695606861504049, 0.99711607946441649, 0.99727178355837132, 0.99742317942992664, 0.99757026565269413, 0.99771304084088941,
+  0.9978515036493445, 0.99798565277352114, 0.99811548694952279, 0.99824100495410639, 0.99836220560469413, 0.99847908775938432, 0.99859165031696273, 0.99869989221691213,
+  0.99880381243942273, 0.99890341000540217, 0.99899868397648395, 0.99908963345503687, 0.99917625758417306, 0.99925855554775656, 0.99933652657041039, 0.99941016991752463,
+  0.99947948489526239, 0.9995444708505673, 0.99960512717116878, 0.99966145328558875, 0.99971344866314626, 0.99976111281396252, 0.99980444528896606, 0.99984344567989647,
+  0.99987811361930856, 0.99990844878057561, 0.99993445087789246, 0.99995611966627806, 0.99997345494157863, 0.99998645654046814, 0.99999512434045112, 0.99999945825986325,
+};
+
+const double sine_4096_double[1025] = {
+  0, 0.0015339801862847655, 0.0030679567629659761, 0.0046019261204485705, 0.0061358846491544753, 0.007669828739531097, 0.0092037547820598194, 0.010737659167264491,
+  0.012271538285719925, 0.013805388528060391, 0.0153392062849881, 0.01687298794728171, 0.01840672990580482, 0.019940428551514441, 0.021474080275469508, 0.023007681468839369,
+  0.024541228522912288, 0.026074717829103901, 0.02760814577896574, 0.029141508764193722, 0.030674803176636626, 0.032208025408304586, 0.03374117185137758, 0.035274238898213947,
+  0.036807222941358832, 0.038340120373552694, 0.039872927587739811, 0.041405640977076739, 0.04293825693494082, 0.044470771854938668, 0.046003182130914623, 0.047535484156959303,
+  0.049067674327418015, 0.050599749036899282, 0.052131704680283324, 0.05366353765273052, 0.055195244349689934, 0.056726821166907748, 0.058258264500435752, 0.059789570746639868,
+  0.061320736302208578, 0.062851757564161406, 0.064382630929857465, 0.065913352797003805, 0.067443919563664051, 0.068974327628266746, 0.070504573389613856, 0.072034653246889332,
+  0.073564563599667426, 0.075094300847921305, 0.076623861392031492, 0.078153241632794232, 0.079682437971430126, 0.081211446809592441, 0.082740264549375692, 0.084268887593324071,
+  0.085797312344439894, 0.087325535206192059, 0.0888535525825246, 0.090381360877864983, 0.091908956497132724, 0.093436335845747787, 0.094963495329638992, 0.096490431355252593,
+  0.098017140329560604, 0.099543618660069319, 0.10106986275482782, 0.10259586902243628, 0.10412163387205459, 0.10564715371341062, 0.10717242495680884, 0.10869744401313872,
+  0.11022220729388306, 0.11174671121112659, 0.11327095217756435, 0.11479492660651008, 0.11631863091190475, 0.11784206150832498, 0.11936521481099135, 0.12088808723577708,
+  0.1224106751992162, 0.12393297511851216, 0.12545498341154623, 0.12697669649688587, 0.12849811079379317, 0.13001922272223335, 0.13154002870288312, 0.13306052515713906,
+  0.13458070850712617, 0.1361005751757062, 0.13762012158648604, 0.1391393441638262, 0.14065823933284921, 0.14217680351944803, 0.14369503315029447, 0.14521292465284746,
+  0.14673047445536175, 0.14824767898689603, 0.14976453467732151, 0.15128103795733022, 0.15279718525844344, 0.1543129730130201, 0.15582839765426523, 0.15734345561623825,
+  0.15885814333386145, 0.16037245724292828, 0.16188639378011183, 0.16339994938297323, 0.16491312048996992, 0.1664259035404641, 0.16793829497473117, 0.16945029123396796,
+  0.17096188876030122, 0.17247308399679595, 0.17398387338746382, 0.17549425337727143, 0.17700422041214875, 0.17851377093899751, 0.18002290140569951, 0.18153160826112497,
+  0.18303988795514095, 0.18454773693861962, 0.18605515166344663, 0.1875621285825296, 0.18906866414980619, 0.19057475482025274, 0.19208039704989244, 0.19358558729580361,
+  0.19509032201612825, 0.19659459767008022, 0.19809841071795356, 0.19960175762113097, 0.2011046348420919, 0.20260703884442113, 0.20410896609281687, 0.20561041305309924,
+  0.20711137619221856, 0.20861185197826349, 0.21011183688046961, 0.21161132736922755, 0.21311031991609136, 0.21460881099378676, 0.21610679707621952, 0.21760427463848364,
+  0.2191012401568698, 0.22059769010887351, 0.22209362097320351, 0.22358902922978999, 0.22508391135979283, 0.22657826384561, 0.22807208317088573, 0.22956536582051887,
+  0.23105810828067111, 0.23255030703877524, 0.23404195858354343, 0.23553305940497549, 0.2370236059943672, 0.23851359484431842, 0.2400030224487415, 0.24149188530286933,
+  0.24298017990326387, 0.24446790274782415, 0.24595505033579459, 0.24744161916777327, 0.24892760574572015, 0.25041300657296522, 0.25189781815421697, 0.25338203699557016,
+  0.25486565960451457, 0.25634868248994291, 0.25783110216215899, 0.25931291513288623, 0.26079411791527551, 0.26227470702391359, 0.26375467897483135, 0.26523403028551179,
+  0.26671275747489837, 0.26819085706340318, 0.26966832557291509, 0.27114515952680801, 0.27262135544994898, 0.27409690986870638, 0.27557181931095814, 0.2770460803060999,
+  0.27851968938505306, 0.27999264308027322, 0.28146493792575794, 0.28293657045705539, 0.28440753721127188, 0.28587783472708062, 0.28734745954472951, 0.28881640820604948,
+  0.29028467725446233, 0.29175226323498926, 0.29321916269425863, 0.29468537218051433, 0.29615088824362379, 0.2976157074350862, 0.29907982630804048, 0.30054324141727345,
+  0.30200594931922808, 0.30346794657201132, 0.30492922973540237, 0.30638979537086092, 0.30784964004153487, 0.30930876031226873, 0.31076715274961147, 0.31222481392182488,
+  0.31368174039889152, 0.31513792875252244, 0.31659337555616585, 0.31804807738501495, 0.31950203081601569, 0.32095523242787521, 0.32240767880106985, 0.32385936651785285,
+  0.32531029216226293, 0.32676045232013173, 0.3282098435790925, 0.32965846252858749, 0.33110630575987643, 0.33255336986604422, 0.33399965144200938, 0.3354451470845316,
+  0.33688985339222005, 0.33833376696554113, 0.33977688440682685, 0.34121920232028236, 0.34266071731199438, 0.34410142598993881, 0.34554132496398909, 0.34698041084592368,
+  0.34841868024943456, 0.34985612979013492, 0.35129275608556709, 0.35272855575521073, 0.35416352542049034, 0.35559766170478385, 0.35703096123342998, 0.35846342063373654,
+  0.35989503653498811, 0.36132580556845428, 0.36275572436739723, 0.36418478956707989, 0.36561299780477385, 0.36704034571976718, 0.36846682995337232, 0.3698924471489341,
+  0.37131719395183754, 0.37274106700951576, 0.37416406297145793, 0.37558617848921722, 0.37700741021641826, 0.37842775480876556, 0.37984720892405116, 0.38126576922216238,
+  0.38268343236508978, 0.38410019501693504, 0.38551605384391885, 0.38693100551438858, 0.38834504669882625, 0.38975817406985641, 0.39117038430225387, 0.39258167407295147,
+  0.3939920400610481, 0.39540147894781635, 0.39680998741671031, 0.39821756215337356, 0.39962419984564679, 0.40102989718357562, 0.40243465085941843, 0.40383845756765407,
+  0.40524131400498986, 0.40664321687036903, 0.40804416286497869, 0.40944414869225759, 0.41084317105790391, 0.41224122666988289, 0.4136383122384345, 0.41503442447608163,
+  0.41642956009763715, 0.41782371582021227, 0.41921688836322391, 0.42060907444840251, 0.42200027079979968, 0.42339047414379605, 0.42477968120910881, 0.42616788872679962,
+  0.42755509343028208, 0.42894129205532949, 0.43032648134008261, 0.43171065802505726, 0.43309381885315196, 0.43447596056965565, 0.43585707992225547, 0.43723717366104409,
+  0.43861623853852766, 0.43999427130963326, 0.44137126873171667, 0.44274722756457002, 0.4441221445704292, 0.44549601651398174, 0.44686884016237416, 0.44824061228521989,
+  0.44961132965460654, 0.45098098904510386, 0.45234958723377089, 0.45371712100016387, 0.45508358712634384, 0.45644898239688392, 0.45781330359887717, 0.45917654752194409,
+  0.46053871095824001, 0.46189979070246273, 0.46325978355186015, 0.46461868630623782, 0.46597649576796618, 0.46733320874198842, 0.4686888220358279, 0.47004333245959562,
+  0.47139673682599764, 0.47274903195034279, 0.47410021465054997, 0.47545028174715587, 0.47679923006332209, 0.47814705642484301, 0.47949375766015301, 0.48083933060033396,
+  0.48218377207912272, 0.48352707893291874, 0.48486924800079106, 0.48621027612448642, 0.487550160148436, 0.48888889691976317, 0.49022648328829116, 0.4915629161065499,
+  0.49289819222978404, 0.49423230851595967, 0.49556526182577254, 0.49689704902265447, 0.49822766697278187, 0.49955711254508184, 0.50088538261124071, 0.50221247404571079,
+  0.50353838372571758, 0.50486310853126759, 0.50618664534515523, 0.50750899105297087, 0.50883014254310699, 0.51015009670676681, 0.5114688504379703, 0.51278640063356296,
+  0.51410274419322166, 0.51541787801946293, 0.51673179901764987, 0.51804450409599934, 0.51935599016558964, 0.52066625414036716, 0.52197529293715439, 0.52328310347565643,
+  0.52458968267846895, 0.52589502747108463, 0.52719913478190128, 0.52850200154222848, 0.52980362468629461, 0.531104001151255, 0.5324031278771979, 0.53370100180715296,
+  0.53499761988709715, 0.53629297906596318, 0.53758707629564539, 0.53887990853100842, 0.54017147272989285, 0.54146176585312344, 0.54275078486451589, 0.54403852673088382,
+  0.54532498842204646, 0.54661016691083486, 0.54789405917310019, 0.54917666218771966, 0.55045797293660481, 0.55173798840470734, 0.55301670558002747, 0.55429412145362,
+  0.55557023301960218, 0.5568450372751601, 0.5581185312205561, 0.55939071185913614, 0.56066157619733603, 0.56193112124468947, 0.56319934401383409, 0.5644662415205195,
+  0.56573181078361312, 0.56699604882510868, 0.56825895267013149, 0.56952051934694714, 0.57078074588696726, 0.57203962932475705, 0.5732971666980422, 0.57455335504771576,
+  0.57580819141784534, 0.57706167285567944, 0.57831379641165559, 0.57956455913940563, 0.58081395809576453, 0.58206199034077544, 0.58330865293769829, 0.58455394295301533,
+  0.58579785745643886, 0.58704039352091797, 0.58828154822264522, 0.58952131864106394, 0.59075970185887416, 0.59199669496204099, 0.5932322950397998, 0.59446649918466443,
+  0.59569930449243336, 0.5969307080621965, 0.59816070699634227, 0.59938929840056454, 0.60061647938386897, 0.60184224705858003, 0.60306659854034816, 0.60428953094815596,
+  0.60551104140432555, 0.60673112703452448, 0.60794978496777363, 0.60916701233645321, 0.61038280627630948, 0.61159716392646191, 0.61281008242940971, 0.61402155893103838,
+  0.61523159058062682, 0.61644017453085365, 0.61764730793780387, 0.61885298796097632, 0.6200572117632891, 0.62125997651108755, 0.62246127937414997, 0.62366111752569453,
+  0.62485948814238634, 0.62605638840434352, 0.62725181549514408, 0.62844576660183271, 0.62963823891492698, 0.63082922962842447, 0.63201873593980906, 0.63320675505005719,
+  0.63439328416364549, 0.63557832048855611, 0.6367618612362842, 0.63794390362184406, 0.63912444486377573, 0.64030348218415167, 0.64148101280858316, 0.64265703396622686,
+  0.64383154288979139, 0.64500453681554393, 0.64617601298331628, 0.64734596863651206, 0.64851440102211244, 0.64968130739068319, 0.65084668499638088, 0.6520105310969595,
+  0.65317284295377676, 0.65433361783180044, 0.65549285299961535, 0.65665054572942894, 0.65780669329707864, 0.65896129298203732, 0.66011434206742048, 0.66126583783999227,
+  0.66241577759017178, 0.66356415861203977, 0.66471097820334479, 0.66585623366550972, 0.66699992230363747, 0.66814204142651845, 0.66928258834663601, 0.67042156038017309,
+  0.67155895484701833, 0.67269476907077286, 0.67382900037875604, 0.67496164610201193, 0.67609270357531592, 0.67722217013718033, 0.67835004312986147, 0.67947631989936497,
+  0.68060099779545302, 0.68172407417164971, 0.68284554638524808, 0.6839654117973154, 0.68508366777270036, 0.68620031168003859, 0.68731534089175905, 0.68842875278409044,
+  0.68954054473706683, 0.6906507141345346, 0.69175925836415775, 0.69286617481742463, 0.693971460889654, 0.69507511398000088, 0.69617713149146299, 0.69727751083088652,
+  0.69837624940897292, 0.69947334464028377, 0.70056879394324834, 0.70166259474016845, 0.7027547444572253, 0.70384524052448494, 0.70493408037590488, 0.70602126144933974,
+  0.70710678118654746, 0.70819063703319529, 0.70927282643886558, 0.71035334685706231, 0.71143219574521643, 0.71250937056469232, 0.71358486878079352, 0.71465868786276898,
+  0.71573082528381859, 0.71680127852109954, 0.71787004505573171, 0.71893712237280438, 0.72000250796138165, 0.72106619931450811, 0.72212819392921535, 0.72318848930652735,
+  0.72424708295146689, 0.72530397237306066, 0.72635915508434601, 0.72741262860237577, 0.7284643904482252, 0.7295144381469969, 0.73056276922782759, 0.73160938122389252,
+  0.73265427167241282, 0.73369743811466026, 0.73473887809596339, 0.73577858916571348, 0.73681656887736979, 0.73785281478846598, 0.73888732446061511, 0.73992009545951609,
+  0.74095112535495911, 0.74198041172083096, 0.74300795213512172, 0.74403374417992918, 0.74505778544146595, 0.74608007351006378, 0.74710060598018013, 0.74811938045040349,
+  0.74913639452345926, 0.75015164580621496, 0.75116513190968637, 0.7521768504490427, 0.75318679904361241, 0.75419497531688917, 0.75520137689653655, 0.75620600141439454,
+  0.75720884650648446, 0.75820990981301528, 0.75920918897838796, 0.76020668165120242, 0.76120238548426178, 0.7621962981345789, 0.76318841726338127, 0.76417874053611667,
+  0.76516726562245896, 0.76615399019631281, 0.7671389119358204, 0.76812202852336531, 0.76910333764557959, 0.7700828369933479, 0.77106052426181371, 0.77203639715038441,
+  0.77301045336273699, 0.77398269060682279, 0.77495310659487382, 0.77592169904340758, 0.77688846567323244, 0.77785340420945304, 0.77881651238147587, 0.77977778792301444,
+  0.78073722857209438, 0.78169483207105939, 0.78265059616657573, 0.7836045186096382, 0.78455659715557524, 0.78550682956405393, 0.78645521359908577, 0.78740174702903132,
+  0.78834642762660623, 0.78928925316888565, 0.79023022143731003, 0.79116933021769009, 0.79210657730021239, 0.79304196047944364, 0.79397547755433717, 0.79490712632823701,
+  0.79583690460888346, 0.79676481020841872, 0.79769084094339104, 0.79861499463476082, 0.79953726910790501, 0.80045766219262271, 0.80137617172314013, 0.80229279553811572,
+  0.80320753148064483, 0.8041203773982657, 0.80503133114296366, 0.80594039057117628, 0.80684755354379922, 0.80775281792619036, 0.80865618158817498, 0.80955764240405126,
+  0.81045719825259477, 0.81135484701706373, 0.81225058658520388, 0.81314441484925359, 0.8140363297059483, 0.81492632905652662, 0.81581441080673378, 0.81670057286682785,
+  0.81758481315158371, 0.81846712958029866, 0.8193475200767969, 0.82022598256943469, 0.82110251499110465, 0.82197711527924155, 0.82284978137582632, 0.82372051122739132,
+  0.82458930278502529, 0.82545615400437744, 0.82632106284566342, 0.82718402727366902, 0.8280450452577558, 0.82890411477186487, 0.82976123379452305, 0.8306164003088462,
+  0.83146961230254524, 0.83232086776792968, 0.83317016470191319, 0.83401750110601813, 0.83486287498638001, 0.8357062843537526, 0.83654772722351189, 0.83738720161566194,
+  0.83822470555483797, 0.83906023707031263, 0.83989379419599941, 0.84072537497045807, 0.84155497743689833, 0.84238259964318596, 0.84320823964184544, 0.84403189549006641,
+  0.84485356524970701, 0.84567324698729907, 0.84649093877405202, 0.84730663868585832, 0.84812034480329712, 0.84893205521163961, 0.84974176800085244, 0.85054948126560337,
+  0.8513551931052652, 0.85215890162391983, 0.85296060493036363, 0.8537603011381113, 0.85455798836540053, 0.85535366473519603, 0.85614732837519447, 0.85693897741782865,
+  0.85772861000027212, 0.85851622426444274, 0.85930181835700836, 0.86008539042939014, 0.86086693863776731, 0.8616464611430813, 0.8624239561110405, 0.86319942171212416,
+  0.8639728561215867, 0.86474425751946238, 0.86551362409056898, 0.86628095402451299, 0.86704624551569265, 0.86780949676330321, 0.8685707059713409, 0.86932987134860673,
+  0.87008699110871135, 0.87084206347007886, 0.87159508665595109, 0.87234605889439154, 0.87309497841829009, 0.87384184346536675, 0.87458665227817611, 0.87532940310411078,
+  0.8760700941954066, 0.87680872380914576, 0.87754529020726124, 0.87827979165654146, 0.87901222642863341, 0.87974259280004741, 0.88047088905216075, 0.88119711347122198,
+  0.88192126434835494, 0.88264333997956279, 0.88336333866573158, 0.88408125871263499, 0.88479709843093779, 0.88551085613619995, 0.88622253014888064, 0.88693211879434208,
+  0.88763962040285393, 0.88834503330959624, 0.88904835585466457, 0.88974958638307289, 0.89044872324475788, 0.89114576479458318, 0.89184070939234272, 0.89253355540276469,
+  0.89322430119551532, 0.89391294514520325, 0.89459948563138258, 0.89528392103855758, 0.89596624975618511, 0.89664647017868015, 0.89732458070541832, 0.89800057974073988,
+  0.89867446569395382, 0.89934623697934146, 0.90001589201616028, 0.90068342922864686, 0.90134884704602203, 0.90201214390249307, 0.90267331823725883, 0.90333236849451182,
+  0.90398929312344334, 0.90464409057824624, 0.90529675931811882, 0.90594729780726846, 0.90659570451491533, 0.90724197791529593, 0.90788611648766615, 0.90852811871630612,
+  0.90916798309052227, 0.90980570810465222, 0.91044129225806714, 0.91107473405517625, 0.91170603200542988, 0.91233518462332275, 0.9129621904283981, 0.91358704794525081,
+  0.91420975570353069, 0.91483031223794609, 0.91544871608826783, 0.91606496579933161, 0.9166790599210427, 0.91729099700837791, 0.91790077562139039, 0.91850839432521225,
+  0.91911385169005777, 0.91971714629122736, 0.92031827670911048, 0.92091724152918952, 0.9215140393420419, 0.92210866874334507, 0.92270112833387852, 0.92329141671952764,
+  0.92387953251128674, 0.9244654743252626, 0.92504924078267758, 0.92563083050987272, 0.92621024213831127, 0.92678747430458175, 0.92736252565040111, 0.92793539482261789,
+  0.92850608047321548, 0.92907458125931575, 0.92964089584318133, 0.93020502289221907, 0.93076696107898371, 0.93132670908118043, 0.93188426558166815, 0.93243962926846236,
+  0.93299279883473885, 0.93354377297883617, 0.93409255040425887, 0.93463912981968078, 0.9351835099389475, 0.93572568948108037, 0.93626566717027826, 0.93680344173592156,
+  0.93733901191257496, 0.93787237643998989, 0.93840353406310806, 0.93893248353206449, 0.93945922360218992, 0.93998375303401394, 0.9405060705932683, 0.94102617505088926,
+  0.94154406518302081, 0.94205973977101731, 0.94257319760144687, 0.94308443746609349, 0.94359345816196039, 0.94410025849127266, 0.94460483726148026, 0.94510719328526061,
+  0.94560732538052128, 0.94610523237040334, 0.94660091308328353, 0.94709436635277722, 0.94758559101774109, 0.94807458592227623, 0.94856134991573027, 0.94904588185270056,
+  0.94952818059303667, 0.950008245001843, 0.9504860739494817, 0.95096166631157508, 0.95143502096900834, 0.95190613680793223, 0.95237501271976588, 0.95284164760119872,
+  0.95330604035419375, 0.95376818988599033, 0.95422809510910567, 0.95468575494133834, 0.95514116830577067, 0.95559433413077111, 0.95604525134999641, 0.95649391890239499,
+  0.95694033573220894, 0.95738450078897586, 0.95782641302753291, 0.95826607140801767, 0.9587034748958716, 0.95913862246184189, 0.95957151308198452, 0.96000214573766585,
+  0.96043051941556579, 0.96085663310767966, 0.96128048581132064, 0.96170207652912254, 0.96212140426904158, 0.96253846804435916, 0.96295326687368388, 0.96336579978095405,
+  0.96377606579543984, 0.96418406395174572, 0.96458979328981265, 0.96499325285492032, 0.9653944416976894, 0.96579335887408357, 0.96619000344541262, 0.96658437447833312,
+  0.96697647104485207, 0.96736629222232851, 0.96775383709347551, 0.96813910474636233, 0.96852209427441727, 0.96890280477642887, 0.96928123535654853, 0.96965738512429245,
+  0.97003125319454397, 0.9704028386875555, 0.97077214072895035, 0.97113915844972509, 0.97150389098625178, 0.9718663374802794, 0.97222649707893627, 0.97258436893473221,
+  0.97293995220556007, 0.97329324605469825, 0.97364424965081187, 0.97399296216795583, 0.97433938278557586, 0.97468351068851067, 0.97502534506699412, 0.97536488511665687,
+  0.97570213003852857, 0.97603707903903902, 0.97636973133002114, 0.97670008612871184, 0.97702814265775439, 0.97735390014519996, 0.97767735782450993, 0.97799851493455714,
+  0.97831737071962765, 0.9786339244294231, 0.9789481753190622, 0.97926012264908202, 0.97956976568544052, 0.97987710369951764, 0.98018213596811732, 0.98048486177346938,
+  0.98078528040323043, 0.98108339115048659, 0.98137919331375456, 0.98167268619698311, 0.98196386910955524, 0.98225274136628937, 0.98253930228744124, 0.98282355119870524,
+  0.98310548743121629, 0.98338511032155118, 0.98366241921173025, 0.98393741344921892, 0.98421009238692903, 0.98448045538322093, 0.98474850180190421, 0.98501423101223984,
+  0.98527764238894122, 0.98553873531217606, 0.98579750916756737, 0.98605396334619544, 0.98630809724459867, 0.98655991026477541, 0.98680940181418542, 0.98705657130575097,
+  0.98730141815785843, 0.98754394179435923, 0.98778414164457218, 0.98802201714328353, 0.98825756773074946, 0.98849079285269659, 0.98872169196032378, 0.98895026451030299,
+  0.98917650996478101, 0.98940042779138038, 0.98962201746320078, 0.98984127845882053, 0.99005821026229712, 0.99027281236316911, 0.99048508425645698, 0.99069502544266463,
+  0.99090263542778001, 0.99110791372327678, 0.99131085984611544, 0.9915114733187439, 0.99170975366909953, 0.99190570043060933, 0.9920993131421918, 0.99229059134825737,
+  0.99247953459870997, 0.99266614244894802, 0.9928504144598651, 0.99303235019785141, 0.9932119492347945, 0.99338921114808065, 0.9935641355205953, 0.9937367219407246,
+  0.99390697000235606, 0.99407487930487937, 0.9942404494531879, 0.9944036800576791, 0.99456457073425542, 0.9947231211043257, 0.99487933079480562, 0.99503319943811863,
+  0.99518472667219682, 0.99533391214048228, 0.99548075549192694, 0.99562525638099431, 0.99576741446765982, 0.99590722941741172, 0.99604470090125197, 0.99617982859569687,
+  0.996312612182778, 0.99644305135004263, 0.99657114579055484, 0.99669689520289606, 0.99682029929116567, 0.99694135776498216, 0.99706007033948296, 0.99717643673532619,
+  0.99729045667869021, 0.9974021299012753, 0.99751145614030345, 0.99761843513851955, 0.99772306664419164, 0.99782535041111164, 0.997925286198596, 0.99802287377148624,
+  0.99811811290014918, 0.99821100336047819, 0.99830154493389289, 0.99838973740734016, 0.99847558057329477, 0.99855907422975931, 0.99864021818026527, 0.99871901223387294,
+  0.99879545620517241, 0.99886954991428356, 0.99894129318685687, 0.99901068585407338, 0.99907772775264536, 0.99914241872481691, 0.99920475861836389, 0.99926474728659442,
+  0.99932238458834954, 0.99937767038800285, 0.99943060455546173, 0.99948118696616695, 0.99952941750109314, 0.99957529604674922, 0.99961882249517864, 0.99965999674395922,
+  0.99969881869620425, 0.99973528826056168, 0.99976940535121528, 0.99980116988788426, 0.9998305817958234, 0.99985764100582386, 0.99988234745421256, 0.9999047010828529,
+  0.9999247018391445, 0.99994234967602391, 0.9999576445519639, 0.99997058643097414, 0.99998117528260111, 0.9999894110819284, 0.99999529380957619, 0.99999882345170188,
+  1,
+};
+
+const float hamming_1024_float[512] = {
+  0.08f, 0.0800086763f, 0.0800347049f, 0.0800780848f, 0.0801388144f, 0.0802168913f, 0.0803123127f, 0.0804250749f,
+  0.0805551737f, 0.0807026042f, 0.0808673608f, 0.0810494372f, 0.0812488268f, 0.0814655218f, 0.0816995141f, 0.0819507949f,
+  0.0822193548f, 0.0825051836f, 0.0828082705f, 0.083128604f, 0.0834661722f, 0.0838209622f, 0.0841929607f, 0.0845821536f,
+  0.0849885263f, 0.0854120634f, 0.085852749f, 0.0863105664f, 0.0867854984f, 0.087277527f, 0.0877866337f, 0.0883127993f,
+  0.0888560039f, 0.089416227f, 0.0899934476f, 0.0905876438f, 0.0911987932f, 0.0918268728f, 0.0924718588f, 0.093133727f,
+  0.0938124523f, 0.0945080092f, 0.0952203715f, 0.0959495122f, 0.0966954038f, 0.0974580183f, 0.0982373268f, 0.0990333f,
+  0.0998459077f, 0.100675119f, 0.101520904f, 0.102383229f, 0.103262063f, 0.104157371f, 0.105069121f, 0.105997278f,
+  0.106941807f, 0.107902672f, 0.108879837f, 0.109873265f, 0.110882919f, 0.11190876f, 0.112950751f, 0.114008851f,
+  0.115083021f, 0.11617322f, 0.117279407f, 0.11840154f, 0.119539577f, 0.120693476f, 0.121863192f, 0.123048681f,
+  0.124249899f, 0.1254668f, 0.126699339f, 0.127947469f, 0.129211143f, 0.130490313f, 0.131784931f, 0.133094948f,
+  0.134420314f, 0.135760981f, 0.137116896f, 0.13848801f, 0.13987427f, 0.141275624f, 0.142692019f, 0.144123401f,
+  0.145569717f, 0.147030913f, 0.148506932f, 0.14999772f, 0.15150322f, 0.153023375f, 0.154558128f, 0.156107421f,
+  0.157671196f, 0.159249393f, 0.160841954f, 0.162448817f, 0.164069923f, 0.16570521f, 0.167354617f, 0.169018081f,
+  0.170695539f, 0.172386929f, 0.174092186f, 0.175811247f, 0.177544046f, 0.179290517f, 0.181050596f, 0.182824216f,
+  0.184611309f, 0.186411809f, 0.188225647f, 0.190052755f, 0.191893064f, 0.193746505f, 0.195613007f, 0.197492501f,
+  0.199384916f, 0.201290179f, 0.20320822f, 0.205138965f, 0.207082343f, 0.209038279f, 0.2110067f, 0.212987531f,
+  0.214980699f, 0.216986127f, 0.21900374f, 0.221033463f, 0.223075217f, 0.225128927f, 0.227194515f, 0.229271903f,
+  0.231361013f, 0.233461765f, 0.235574081f, 0.237697881f, 0.239833085f, 0.241979612f, 0.244137381f, 0.246306311f,
+  0.24848632f, 0.250677325f, 0.252879245f, 0.255091996f, 0.257315495f, 0.259549657f, 0.261794399f, 0.264049635f,
+  0.266315282f, 0.268591252f, 0.270877461f, 0.273173822f, 0.275480248f, 0.277796653f, 0.280122949f, 0.282459049f,
+  0.284804863f, 0.287160305f, 0.289525284f, 0.291899712f, 0.294283499f, 0.296676555f, 0.299078791f, 0.301490114f,
+  0.303910435f, 0.306339662f, 0.308777703f, 0.311224467f, 0.31367986f, 0.316143792f, 0.318616167f, 0.321096894f,
+  0.323585879f, 0.326083028f, 0.328588246f, 0.331101439f, 0.333622513f, 0.336151371f, 0.33868792f, 0.341232063f,
+  0.343783704f, 0.346342746f, 0.348909094f, 0.351482651f, 0.354063319f, 0.356651001f, 0.3592456f, 0.361847017f,
+  0.364455155f, 0.367069914f, 0.369691198f, 0.372318905f, 0.374952939f, 0.377593198f, 0.380239584f, 0.382891996f,
+  0.385550336f, 0.388214501f, 0.390884392f, 0.393559908f, 0.396240949f, 0.398927413f, 0.401619198f, 0.404316203f,
+  0.407018327f, 0.409725467f, 0.412437522f, 0.415154388f, 0.417875965f, 0.420602148f, 0.423332835f, 0.426067923f,
+  0.428807309f, 0.43155089f, 0.434298562f, 0.437050221f, 0.439805763f, 0.442565086f, 0.445328083f, 0.448094652f,
+  0.450864688f, 0.453638087f, 0.456414743f, 0.459194553f, 0.461977411f, 0.464763211f, 0.467551851f, 0.470343223f,
+  0.473137222f, 0.475933744f, 0.478732683f, 0.481533933f, 0.484337389f, 0.487142944f, 0.489950493f, 0.49275993f,
+  0.49557115f, 0.498384045f, 0.50119851f, 0.504014439f, 0.506831725f, 0.509650263f, 0.512469945f, 0.515290666f,
+  0.518112319f, 0.520934798f, 0.523757996f, 0.526581806f, 0.529406123f, 0.53223084f, 0.535055849f, 0.537881045f,
+  0.540706321f, 0.54353157f, 0.546356686f, 0.549181563f, 0.552006093f, 0.55483017f, 0.557653687f, 0.560476539f,
+  0.563298618f, 0.566119818f, 0.568940033f, 0.571759157f, 0.574577082f, 0.577393703f, 0.580208913f, 0.583022606f,
+  0.585834677f, 0.588645018f, 0.591453525f, 0.59426009f, 0.597064609f, 0.599866975f, 0.602667082f, 0.605464826f,
+  0.6082601f, 0.611052799f, 0.613842818f, 0.616630051f, 0.619414393f, 0.62219574f, 0.624973986f, 0.627749027f,
+  0.630520757f, 0.633289073f, 0.636053869f, 0.638815042f, 0.641572488f, 0.644326101f, 0.64707578f, 0.649821419f,
+  0.652562915f, 0.655300165f, 0.658033066f, 0.660761514f, 0.663485406f, 0.666204641f, 0.668919114f, 0.671628724f,
+  0.674333369f, 0.677032946f, 0.679727354f, 0.682416491f, 0.685100256f, 0.687778547f, 0.690451263f, 0.693118304f,
+  0.695779569f, 0.698434958f, 0.701084369f, 0.703727704f, 0.706364863f, 0.708995746f, 0.711620254f, 0.714238288f,
+  0.716849749f, 0.719454539f, 0.722052559f, 0.724643711f, 0.727227899f, 0.729805023f, 0.732374987f, 0.734937695f,
+  0.737493049f, 0.740040952f, 0.74258131f, 0.745114026f, 0.747639004f, 0.750156149f, 0.752665367f, 0.755166562f,
+  0.75765964f, 0.760144508f, 0.762621071f, 0.765089236f, 0.76754891f, 0.77f, 0.772442414f, 0.77487606f,
+  0.777300845f, 0.779716679f, 0.782123469f, 0.784521126f, 0.786909559f, 0.789288678f, 0.791658393f, 0.794018614f,
+  0.796369253f, 0.798710221f, 0.80104143f, 0.803362792f, 0.805674218f, 0.807975623f, 0.810266919f, 0.812548019f,
+  0.814818838f, 0.81707929f, 0.81932929f, 0.821568752f, 0.823797593f, 0.826015729f, 0.828223074f, 0.830419548f,
+  0.832605065f, 0.834779545f, 0.836942905f, 0.839095063f, 0.841235938f, 0.84336545f, 0.845483518f, 0.847590062f,
+  0.849685003f, 0.851768261f, 0.853839759f, 0.855899418f, 0.85794716f, 0.859982908f, 0.862006585f, 0.864018115f,
+  0.866017423f, 0.868004432f, 0.869979067f, 0.871941255f, 0.873890921f, 0.875827992f, 0.877752394f, 0.879664055f,
+  0.881562902f, 0.883448865f, 0.885321873f, 0.887181853f, 0.889028737f, 0.890862454f, 0.892682936f, 0.894490113f,
+  0.896283918f, 0.898064283f, 0.89983114f, 0.901584424f, 0.903324067f, 0.905050005f, 0.906762172f, 0.908460504f,
+  0.910144936f, 0.911815405f, 0.913471848f, 0.915114203f, 0.916742407f, 0.918356399f, 0.919956119f, 0.921541505f,
+  0.923112498f, 0.92466904f, 0.92621107f, 0.927738531f, 0.929251366f, 0.930749517f, 0.932232927f, 0.933701542f,
+  0.935155304f, 0.936594161f, 0.938018056f, 0.939426937f, 0.94082075f, 0.942199444f, 0.943562965f, 0.944911262f,
+  0.946244285f, 0.947561983f, 0.948864307f, 0.950151207f, 0.951422634f, 0.952678542f, 0.953918882f, 0.955143608f,
+  0.956352674f, 0.957546033f, 0.958723641f, 0.959885454f, 0.961031427f, 0.962161518f, 0.963275683f, 0.964373881f,
+  0.965456071f, 0.966522211f, 0.967572261f, 0.968606182f, 0.969623934f, 0.97062548f, 0.971610781f, 0.972579801f,
+  0.973532502f, 0.974468849f, 0.975388807f, 0.976292341f, 0.977179416f, 0.978049999f, 0.978904058f, 0.97974156f,
+  0.980562474f, 0.981366768f, 0.982154413f, 0.982925378f, 0.983679634f, 0.984417154f, 0.985137909f, 0.985841872f,
+  0.986529016f, 0.987199316f, 0.987852746f, 0.988489282f, 0.989108899f, 0.989711575f, 0.990297286f, 0.990866011f,
+  0.991417727f, 0.991952415f, 0.992470053f, 0.992970623f, 0.993454106f, 0.993920483f, 0.994369736f, 0.99480185f,
+  0.995216807f, 0.995614591f, 0.995995189f, 0.996358585f, 0.996704766f, 0.997033718f, 0.99734543f, 0.997639889f,
+  0.997917084f, 0.998177006f, 0.998419644f, 0.998644988f, 0.998853032f, 0.999043766f, 0.999217183f, 0.999373277f,
+  0.999512042f, 0.999633474f, 0.999737566f, 0.999824315f, 0.999893719f, 0.999945774f, 0.999980478f, 0.999997831f,
+};
+
+const float hamming_2048_float[1024] = {
+  0.08f, 0.080002167f, 0.0800086678f, 0.0800195025f, 0.080034671f, 0.0800541731f, 0.0800780085f, 0.0801061772f,
+  0.0801386788f, 0.080175513f, 0.0802166795f, 0.0802621779f, 0.0803120077f, 0.0803661685f, 0.0804246598f, 0.080487481f,
+  0.0805546315f, 0.0806261108f, 0.0807019181f, 0.0807820527f, 0.0808665138f, 0.0809553007f, 0.0810484125f, 0.0811458484f,
+  0.0812476074f, 0.0813536886f, 0.081464091f, 0.0815788135f, 0.081697855f, 0.0818212145f, 0.0819488908f, 0.0820808826f,
+  0.0822171887f, 0.0823578079f, 0.0825027387f, 0.08265198f, 0.0828055301f, 0.0829633878f, 0.0831255514f, 0.0832920196f,
+  0.0834627906f, 0.083637863f, 0.083817235f, 0.084000905f, 0.0841888712f, 0.0843811319f, 0.0845776852f, 0.0847785293f,
+  0.0849836623f, 0.0851930823f, 0.0854067873f, 0.0856247752f, 0.0858470441f, 0.0860735919f, 0.0863044163f, 0.0865395153f,
+  0.0867788866f, 0.087022528f, 0.0872704371f, 0.0875226116f, 0.0877790492f, 0.0880397474f, 0.0883047038f, 0.0885739159f,
+  0.0888473812f, 0.089125097f, 0.0894070607f, 0.0896932698f, 0.0899837214f, 0.090278413f, 0.0905773416f, 0.0908805045f,
+  0.0911878988f, 0.0914995216f, 0.09181537f, 0.092135441f, 0.0924597316f, 0.0927882387f, 0.0931209593f, 0.0934578902f,
+  0.0937990282f, 0.0941443701f, 0.0944939127f, 0.0948476527f, 0.0952055867f, 0.0955677113f, 0.0959340233f, 0.096304519f,
+  0.096679195f, 0.0970580478f, 0.0974410739f, 0.0978282695f, 0.0982196311f, 0.098615155f, 0.0990148374f, 0.0994186745f,
+  0.0998266627f, 0.100238798f, 0.100655077f, 0.101075494f, 0.101500048f, 0.101928732f, 0.102361544f, 0.102798479f,
+  0.103239533f, 0.103684703f, 0.104133983f, 0.104587369f, 0.105044858f, 0.105506445f, 0.105972125f, 0.106441895f,
+  0.106915749f, 0.107393684f, 0.107875695f, 0.108361777f, 0.108851925f, 0.109346136f, 0.109844404f, 0.110346725f,
+  0.110853094f, 0.111363506f, 0.111877957f, 0.112396441f, 0.112918954f, 0.113445491f, 0.113976046f, 0.114510615f,
+  0.115049194f, 0.115591775f, 0.116138356f, 0.11668893f, 0.117243492f, 0.117802037f, 0.11836456f, 0.118931055f,
+  0.119501518f, 0.120075942f, 0.120654322f, 0.121236654f, 0.121822931f, 0.122413148f, 0.123007299f, 0.123605379f,
+  0.124207382f, 0.124813302f, 0.125423134f, 0.126036872f, 0.12665451f, 0.127276043f, 0.127901464f, 0.128530768f,
+  0.129163948f, 0.129801f, 0.130441915f, 0.13108669f, 0.131735317f, 0.132387791f, 0.133044105f, 0.133704253f,
+  0.134368229f, 0.135036027f, 0.13570764f, 0.136383063f, 0.137062288f, 0.137745309f, 0.13843212f, 0.139122715f,
+  0.139817086f, 0.140515228f, 0.141217134f, 0.141922797f, 0.14263221f, 0.143345367f, 0.144062261f, 0.144782886f,
+  0.145507234f, 0.146235299f, 0.146967074f, 0.147702552f, 0.148441726f, 0.149184589f, 0.149931134f, 0.150681354f,
+  0.151435242f, 0.152192791f, 0.152953994f, 0.153718843f, 0.154487332f, 0.155259453f, 0.156035199f, 0.156814562f,
+  0.157597535f, 0.158384112f, 0.159174283f, 0.159968043f, 0.160765383f, 0.161566297f, 0.162370775f, 0.163178812f,
+  0.163990399f, 0.164805528f, 0.165624192f, 0.166446384f, 0.167272095f, 0.168101318f, 0.168934044f, 0.169770267f,
+  0.170609978f, 0.171453169f, 0.172299832f, 0.173149959f, 0.174003543f, 0.174860576f, 0.175721048f, 0.176584952f,
+  0.177452281f, 0.178323025f, 0.179197177f, 0.180074728f, 0.18095567f, 0.181839995f, 0.182727694f, 0.183618759f,
+  0.184513182f, 0.185410955f, 0.186312068f, 0.187216513f, 0.188124282f, 0.189035367f, 0.189949758f, 0.190867447f,
+  0.191788425f, 0.192712684f, 0.193640216f, 0.19457101f, 0.195505059f, 0.196442353f, 0.197382885f, 0.198326644f,
+  0.199273623f, 0.200223811f, 0.201177201f, 0.202133784f, 0.203093549f, 0.204056489f, 0.205022593f, 0.205991854f,
+  0.206964262f, 0.207939807f, 0.208918481f, 0.209900274f, 0.210885177f, 0.211873181f, 0.212864277f, 0.213858454f,
+  0.214855705f, 0.215856019f, 0.216859386f, 0.217865799f, 0.218875246f, 0.219887718f, 0.220903207f, 0.221921702f,
+  0.222943194f, 0.223967673f, 0.22499513f, 0.226025554f, 0.227058937f, 0.228095268f, 0.229134537f, 0.230176736f,
+  0.231221853f, 0.23226988f, 0.233320806f, 0.234374621f, 0.235431316f, 0.23649088f, 0.237553304f, 0.238618578f,
+  0.239686691f, 0.240757633f, 0.241831395f, 0.242907965f, 0.243987335f, 0.245069494f, 0.246154432f, 0.247242138f,
+  0.248332602f, 0.249425815f, 0.250521764f, 0.251620442f, 0.252721836f, 0.253825937f, 0.254932734f, 0.256042217f,
+  0.257154375f, 0.258269198f, 0.259386676f, 0.260506797f, 0.261629551f, 0.262754928f, 0.263882918f, 0.265013509f,
+  0.26614669f, 0.267282452f, 0.268420783f, 0.269561673f, 0.27070511f, 0.271851085f, 0.272999587f, 0.274150604f,
+  0.275304125f, 0.276460141f, 0.277618639f, 0.27877961f, 0.279943041f, 0.281108923f, 0.282277244f, 0.283447993f,
+  0.284621159f, 0.285796731f, 0.286974699f, 0.28815505f, 0.289337774f, 0.290522859f, 0.291710295f, 0.292900071f,
+  0.294092174f, 0.295286594f, 0.29648332f, 0.29768234f, 0.298883643f, 0.300087218f, 0.301293053f, 0.302501137f,
+  0.303711459f, 0.304924007f, 0.30613877f, 0.307355736f, 0.308574894f, 0.309796233f, 0.31101974f, 0.312245405f,
+  0.313473215f, 0.31470316f, 0.315935227f, 0.317169405f, 0.318405683f, 0.319644049f, 0.32088449f, 0.322126997f,
+  0.323371555f, 0.324618155f, 0.325866784f, 0.327117431f, 0.328370083f, 0.329624729f, 0.330881357f, 0.332139955f,
+  0.333400512f, 0.334663015f, 0.335927453f, 0.337193814f, 0.338462085f, 0.339732255f, 0.341004312f, 0.342278244f,
+  0.343554038f, 0.344831684f, 0.346111168f, 0.347392479f, 0.348675605f, 0.349960533f, 0.351247252f, 0.352535749f,
+  0.353826012f, 0.355118029f, 0.356411788f, 0.357707277f, 0.359004484f, 0.360303395f, 0.361604f, 0.362906285f,
+  0.364210239f, 0.365515849f, 0.366823103f, 0.368131989f, 0.369442494f, 0.370754606f, 0.372068312f, 0.373383601f,
+  0.374700459f, 0.376018875f, 0.377338836f, 0.378660329f, 0.379983342f, 0.381307863f, 0.382633879f, 0.383961378f,
+  0.385290347f, 0.386620773f, 0.387952645f, 0.389285949f, 0.390620673f, 0.391956804f, 0.39329433f, 0.394633239f,
+  0.395973517f, 0.397315152f, 0.398658131f, 0.400002442f, 0.401348072f, 0.402695008f, 0.404043238f, 0.405392749f,
+  0.406743528f, 0.408095562f, 0.409448839f, 0.410803347f, 0.412159071f, 0.413516f, 0.414874121f, 0.41623342f,
+  0.417593886f, 0.418955505f, 0.420318264f, 0.421682151f, 0.423047152f, 0.424413256f, 0.425780448f, 0.427148717f,
+  0.428518049f, 0.429888431f, 0.431259851f, 0.432632295f, 0.43400575f, 0.435380205f, 0.436755645f, 0.438132057f,
+  0.43950943f, 0.440887749f, 0.442267002f, 0.443647176f, 0.445028258f, 0.446410234f, 0.447793092f, 0.449176819f,
+  0.450561402f, 0.451946827f, 0.453333082f, 0.454720154f, 0.456108029f, 0.457496694f, 0.458886136f, 0.460276343f,
+  0.461667301f, 0.463058997f, 0.464451418f, 0.465844551f, 0.467238382f, 0.468632899f, 0.470028088f, 0.471423937f,
+  0.472820431f, 0.474217559f, 0.475615306f, 0.47701366f, 0.478412607f, 0.479812135f, 0.48121223f, 0.482612878f,
+  0.484014067f, 0.485415784f, 0.486818015f, 0.488220747f, 0.489623967f, 0.491027661f, 0.492431817f, 0.493836421f,
+  0.49524146f, 0.496646921f, 0.49805279f, 0.499459054f, 0.5008657f, 0.502272715f, 0.503680086f, 0.505087799f,
+  0.50649584f, 0.507904197f, 0.509312857f, 0.510721806f, 0.51213103f, 0.513540517f, 0.514950254f, 0.516360226f,
+  0.517770421f, 0.519180826f, 0.520591427f, 0.52200221f, 0.523413164f, 0.524824273f, 0.526235526f, 0.527646908f,
+  0.529058406f, 0.530470008f, 0.531881699f, 0.533293467f, 0.534705298f, 0.536117179f, 0.537529097f, 0.538941037f,
+  0.540352988f, 0.541764936f, 0.543176867f, 0.544588767f, 0.546000625f, 0.547412426f, 0.548824158f, 0.550235806f,
+  0.551647357f, 0.553058799f, 0.554470118f, 0.555881301f, 0.557292334f, 0.558703204f, 0.560113898f, 0.561524402f,
+  0.562934704f, 0.564344789f, 0.565754645f, 0.567164259f, 0.568573616f, 0.569982705f, 0.57139151f, 0.572800021f,
+  0.574208222f, 0.5756161f, 0.577023644f, 0.578430838f, 0.57983767f, 0.581244127f, 0.582650196f, 0.584055862f,
+  0.585461114f, 0.586865937f, 0.588270318f, 0.589674245f, 0.591077704f, 0.592480682f, 0.593883165f, 0.59528514f,
+  0.596686595f, 0.598087515f, 0.599487888f, 0.600887701f, 0.60228694f, 0.603685593f, 0.605083645f, 0.606481084f,
+  0.607877897f, 0.60927407f, 0.61066959f, 0.612064445f, 0.613458621f, 0.614852104f, 0.616244883f, 0.617636943f,
+  0.619028271f, 0.620418855f, 0.621808682f, 0.623197737f, 0.624586009f, 0.625973484f, 0.627360149f, 0.62874599f,
+  0.630130996f, 0.631515152f, 0.632898447f, 0.634280866f, 0.635662396f, 0.637043026f, 0.638422741f, 0.639801529f,
+  0.641179376f, 0.64255627f, 0.643932198f, 0.645307147f, 0.646681104f, 0.648054055f, 0.649425989f, 0.650796891f,
+  0.65216675f, 0.653535552f, 0.654903284f, 0.656269933f, 0.657635488f, 0.658999933f, 0.660363258f, 0.661725449f,
+  0.663086493f, 0.664446377f, 0.665805088f, 0.667162615f, 0.668518943f, 0.669874061f, 0.671227954f, 0.672580612f,
+  0.67393202f, 0.675282167f, 0.676631039f, 0.677978623f, 0.679324908f, 0.68066988f, 0.682013526f, 0.683355835f,
+  0.684696793f, 0.686036388f, 0.687374607f, 0.688711437f, 0.690046866f, 0.691380882f, 0.692713471f, 0.694044622f,
+  0.695374321f, 0.696702557f, 0.698029315f, 0.699354586f, 0.700678354f, 0.702000609f, 0.703321338f, 0.704640527f,
+  0.705958166f, 0.707274241f, 0.70858874f, 0.709901651f, 0.711212961f, 0.712522658f, 0.713830729f, 0.715137163f,
+  0.716441946f, 0.717745067f, 0.719046514f, 0.720346274f, 0.721644334f, 0.722940683f, 0.724235309f, 0.725528199f,
+  0.72681934f, 0.728108722f, 0.729396331f, 0.730682156f, 0.731966185f, 0.733248405f, 0.734528804f, 0.73580737f,
+  0.737084092f, 0.738358956f, 0.739631952f, 0.740903067f, 0.742172289f, 0.743439607f, 0.744705007f, 0.745968479f,
+  0.747230011f, 0.74848959f, 0.749747205f, 0.751002843f, 0.752256494f, 0.753508145f, 0.754757784f, 0.7560054f,
+  0.75725098f, 0.758494514f, 0.75973599f, 0.760975395f, 0.762212718f, 0.763447947f, 0.764681072f, 0.765912079f,
+  0.767140958f, 0.768367697f, 0.769592285f, 0.770814709f, 0.772034959f, 0.773253022f, 0.774468888f, 0.775682545f,
+  0.776893981f, 0.778103186f, 0.779310147f, 0.780514853f, 0.781717294f, 0.782917457f, 0.784115331f, 0.785310905f,
+  0.786504169f, 0.787695109f, 0.788883716f, 0.790069979f, 0.791253885f, 0.792435424f, 0.793614584f, 0.794791355f,
+  0.795965726f, 0.797137685f, 0.798307221f, 0.799474324f, 0.800638982f, 0.801801184f, 0.80296092f, 0.804118179f,
+  0.805272949f, 0.806425219f, 0.80757498f, 0.808722219f, 0.809866927f, 0.811009092f, 0.812148704f, 0.813285751f,
+  0.814420224f, 0.815552112f, 0.816681403f, 0.817808088f, 0.818932155f, 0.820053594f, 0.821172395f, 0.822288546f,
+  0.823402038f, 0.82451286f, 0.825621001f, 0.826726452f, 0.827829201f, 0.828929238f, 0.830026553f, 0.831121135f,
+  0.832212975f, 0.833302061f, 0.834388384f, 0.835471934f, 0.836552699f, 0.837630671f, 0.838705838f, 0.839778192f,
+  0.840847721f, 0.841914415f, 0.842978265f, 0.84403926f, 0.845097391f, 0.846152647f, 0.847205019f, 0.848254497f,
+  0.84930107f, 0.850344729f, 0.851385465f, 0.852423266f, 0.853458124f, 0.854490029f, 0.855518971f, 0.85654494f,
+  0.857567926f, 0.858587921f, 0.859604914f, 0.860618896f, 0.861629857f, 0.862637788f, 0.863642679f, 0.864644521f,
+  0.865643304f, 0.86663902f, 0.867631657f, 0.868621208f, 0.869607663f, 0.870591012f, 0.871571247f, 0.872548358f,
+  0.873522335f, 0.874493171f, 0.875460855f, 0.876425378f, 0.877386732f, 0.878344906f, 0.879299894f, 0.880251684f,
+  0.881200269f, 0.882145639f, 0.883087785f, 0.8840267f, 0.884962372f, 0.885894795f, 0.886823959f, 0.887749855f,
+  0.888672475f, 0.88959181f, 0.890507851f, 0.89142059f, 0.892330018f, 0.893236126f, 0.894138906f, 0.89503835f,
+  0.895934449f, 0.896827194f, 0.897716577f, 0.898602591f, 0.899485225f, 0.900364473f, 0.901240325f, 0.902112774f,
+  0.902981811f, 0.903847429f, 0.904709618f, 0.905568371f, 0.906423681f, 0.907275537f, 0.908123934f, 0.908968862f,
+  0.909810314f, 0.910648281f, 0.911482757f, 0.912313732f, 0.9131412f, 0.913965153f, 0.914785581f, 0.915602479f,
+  0.916415838f, 0.917225651f, 0.91803191f, 0.918834606f, 0.919633734f, 0.920429285f, 0.921221252f, 0.922009627f,
+  0.922794403f, 0.923575572f, 0.924353127f, 0.925127062f, 0.925897367f, 0.926664037f, 0.927427064f, 0.928186441f,
+  0.92894216f, 0.929694216f, 0.930442599f, 0.931187304f, 0.931928323f, 0.93266565f, 0.933399277f, 0.934129198f,
+  0.934855405f, 0.935577893f, 0.936296653f, 0.937011679f, 0.937722965f, 0.938430504f, 0.939134289f, 0.939834314f,
+  0.940530571f, 0.941223055f, 0.941911759f, 0.942596676f, 0.9432778f, 0.943955125f, 0.944628643f, 0.945298349f,
+  0.945964237f, 0.9466263f, 0.947284532f, 0.947938927f, 0.948589478f, 0.949236179f, 0.949879025f, 0.95051801f,
+  0.951153126f, 0.951784369f, 0.952411732f, 0.95303521f, 0.953654796f, 0.954270485f, 0.954882271f, 0.955490148f,
+  0.95609411f, 0.956694152f, 0.957290268f, 0.957882453f, 0.958470701f, 0.959055006f, 0.959635362f, 0.960211765f,
+  0.96078421f, 0.961352689f, 0.961917199f, 0.962477734f, 0.963034288f, 0.963586856f, 0.964135434f, 0.964680016f,
+  0.965220597f, 0.965757171f, 0.966289734f, 0.966818281f, 0.967342806f, 0.967863305f, 0.968379773f, 0.968892205f,
+  0.969400596f, 0.969904942f, 0.970405237f, 0.970901477f, 0.971393657f, 0.971881773f, 0.97236582f, 0.972845793f,
+  0.973321688f, 0.973793501f, 0.974261226f, 0.974724861f, 0.975184399f, 0.975639837f, 0.976091171f, 0.976538396f,
+  0.976981509f, 0.977420504f, 0.977855378f, 0.978286127f, 0.978712746f, 0.979135232f, 0.979553581f, 0.979967788f,
+  0.98037785f, 0.980783763f, 0.981185524f, 0.981583127f, 0.98197657f, 0.982365849f, 0.982750961f, 0.983131901f,
+  0.983508665f, 0.983881252f, 0.984249656f, 0.984613875f, 0.984973905f, 0.985329742f, 0.985681384f, 0.986028826f,
+  0.986372067f, 0.986711102f, 0.987045928f, 0.987376542f, 0.987702941f, 0.988025122f, 0.988343082f, 0.988656818f,
+  0.988966327f, 0.989271606f, 0.989572652f, 0.989869463f, 0.990162035f, 0.990450365f, 0.990734452f, 0.991014292f,
+  0.991289883f, 0.991561222f, 0.991828307f, 0.992091134f, 0.992349702f, 0.992604009f, 0.992854051f, 0.993099826f,
+  0.993341333f, 0.993578568f, 0.99381153f, 0.994040217f, 0.994264625f, 0.994484754f, 0.994700601f, 0.994912164f,
+  0.99511944f, 0.995322429f, 0.995521128f, 0.995715535f, 0.995905649f, 0.996091467f, 0.996272988f, 0.996450211f,
+  0.996623133f, 0.996791753f, 0.996956069f, 0.997116079f, 0.997271784f, 0.997423179f, 0.997570266f, 0.997713041f,
+  0.997851504f, 0.997985653f, 0.998115487f, 0.998241005f, 0.998362206f, 0.998479088f, 0.99859165f, 0.998699892f,
+  0.998803812f, 0.99890341f, 0.998998684f, 0.999089633f, 0.999176258f, 0.999258556f, 0.999336527f, 0.99941017f,
+  0.999479485f, 0.999544471f, 0.999605127f, 0.999661453f, 0.999713449f, 0.999761113f, 0.999804445f, 0.999843446f,
+  0.999878114f, 0.999908449f, 0.999934451f, 0.99995612f, 0.999973455f, 0.999986457f, 0.999995124f, 0.999999458f,
+};
+
+const float sine_4096_float[1025] = {
+  0.0f, 0.00153398019f, 0.00306795676f, 0.00460192612f, 0.00613588465f, 0.00766982874f, 0.00920375478f, 0.0107376592f,
+  0.0122715383f, 0.0138053885f, 0.0153392063f, 0.0168729879f, 0.0184067299f, 0.0199404286f, 0.0214740803f, 0.0230076815f,
+  0.0245412285f, 0.0260747178f, 0.0276081458f, 0.0291415088f, 0.0306748032f, 0.0322080254f, 0.0337411719f, 0.0352742389f,
+  0.0368072229f, 0.0383401204f, 0.0398729276f, 0.041405641f, 0.0429382569f, 0.0444707719f, 0.0460031821f, 0.0475354842f,
+  0.0490676743f, 0.050599749f, 0.0521317047f, 0.0536635377f, 0.0551952443f, 0.0567268212f, 0.0582582645f, 0.0597895707f,
+  0.0613207363f, 0.0628517576f, 0.0643826309f, 0.0659133528f, 0.0674439196f, 0.0689743276f, 0.0705045734f, 0.0720346532f,
+  0.0735645636f, 0.0750943008f, 0.0766238614f, 0.0781532416f, 0.079682438f, 0.0812114468f, 0.0827402645f, 0.0842688876f,
+  0.0857973123f, 0.0873255352f, 0.0888535526f, 0.0903813609f, 0.0919089565f, 0.0934363358f, 0.0949634953f, 0.0964904314f,
+  0.0980171403f, 0.0995436187f, 0.101069863f, 0.102595869f, 0.104121634f, 0.105647154f, 0.107172425f, 0.108697444f,
+  0.110222207f, 0.111746711f, 0.113270952f, 0.114794927f, 0.116318631f, 0.117842062f, 0.119365215f, 0.120888087f,
+  0.122410675f, 0.123932975f, 0.125454983f, 0.126976696f, 0.128498111f, 0.130019223f, 0.131540029f, 0.133060525f,
+  0.134580709f, 0.136100575f, 0.137620122f, 0.139139344f, 0.140658239f, 0.142176804f, 0.143695033f, 0.145212925f,
+  0.146730474f, 0.148247679f, 0.149764535f, 0.151281038f, 0.152797185f, 0.154312973f, 0.155828398f, 0.157343456f,
+  0.158858143f, 0.160372457f, 0.161886394f, 0.163399949f, 0.16491312f, 0.166425904f, 0.167938295f, 0.169450291f,
+  0.170961889f, 0.172473084f, 0.173983873f, 0.175494253f, 0.17700422f, 0.178513771f, 0.180022901f, 0.181531608f,
+  0.183039888f, 0.184547737f, 0.186055152f, 0.187562129f, 0.189068664f, 0.190574755f, 0.192080397f, 0.193585587f,
+  0.195090322f, 0.196594598f, 0.198098411f, 0.199601758f, 0.201104635f, 0.202607039f, 0.204108966f, 0.205610413f,
+  0.207111376f, 0.208611852f, 0.210111837f, 0.211611327f, 0.21311032f, 0.214608811f, 0.216106797f, 0.217604275f,
+  0.21910124f, 0.22059769f, 0.222093621f, 0.223589029f, 0.225083911f, 0.226578264f, 0.228072083f, 0.229565366f,
+  0.231058108f, 0.232550307f, 0.234041959f, 0.235533059f, 0.237023606f, 0.238513595f, 0.240003022f, 0.241491885f,
+  0.24298018f, 0.244467903f, 0.24595505f, 0.247441619f, 0.248927606f, 0.250413007f, 0.251897818f, 0.253382037f,
+  0.25486566f, 0.256348682f, 0.257831102f, 0.259312915f, 0.260794118f, 0.262274707f, 0.263754679f, 0.26523403f,
+  0.266712757f, 0.268190857f, 0.269668326f, 0.27114516f, 0.272621355f, 0.27409691f, 0.275571819f, 0.27704608f,
+  0.278519689f, 0.279992643f, 0.281464938f, 0.28293657f, 0.284407537f, 0.285877835f, 0.28734746f, 0.288816408f,
+  0.290284677f, 0.291752263f, 0.293219163f, 0.294685372f, 0.296150888f, 0.297615707f, 0.299079826f, 0.300543241f,
+  0.302005949f, 0.303467947f, 0.30492923f, 0.306389795f, 0.30784964f, 0.30930876f, 0.310767153f, 0.312224814f,
+  0.31368174f, 0.315137929f, 0.316593376f, 0.318048077f, 0.319502031f, 0.320955232f, 0.322407679f, 0.323859367f,
+  0.325310292f, 0.326760452f, 0.328209844f, 0.329658463f, 0.331106306f, 0.33255337f, 0.333999651f, 0.335445147f,
+  0.336889853f, 0.338333767f, 0.339776884f, 0.341219202f, 0.342660717f, 0.344101426f, 0.345541325f, 0.346980411f,
+  0.34841868f, 0.34985613f, 0.351292756f, 0.352728556f, 0.354163525f, 0.355597662f, 0.357030961f, 0.358463421f,
+  0.359895037f, 0.361325806f, 0.362755724f, 0.36418479f, 0.365612998f, 0.367040346f, 0.36846683f, 0.369892447f,
+  0.371317194f, 0.372741067f, 0.374164063f, 0.375586178f, 0.37700741f, 0.378427755f, 0.379847209f, 0.381265769f,
+  0.382683432f, 0.384100195f, 0.385516054f, 0.386931006f, 0.388345047f, 0.389758174f, 0.391170384f, 0.392581674f,
+  0.39399204f, 0.395401479f, 0.396809987f, 0.398217562f, 0.3996242f, 0.401029897f, 0.402434651f, 0.403838458f,
+  0.405241314f, 0.406643217f, 0.408044163f, 0.409444149f, 0.410843171f, 0.412241227f, 0.413638312f, 0.415034424f,
+  0.41642956f, 0.417823716f, 0.419216888f, 0.420609074f, 0.422000271f, 0.423390474f, 0.424779681f, 0.426167889f,
+  0.427555093f, 0.428941292f, 0.430326481f, 0.431710658f, 0.433093819f, 0.434475961f, 0.43585708f, 0.437237174f,
+  0.438616239f, 0.439994271f, 0.441371269f, 0.442747228f, 0.444122145f, 0.445496017f, 0.44686884f, 0.448240612f,
+  0.44961133f, 0.450980989f, 0.452349587f, 0.453717121f, 0.455083587f, 0.456448982f, 0.457813304f, 0.459176548f,
+  0.460538711f, 0.461899791f, 0.463259784f, 0.464618686f, 0.465976496f, 0.467333209f, 0.468688822f, 0.470043332f,
+  0.471396737f, 0.472749032f, 0.474100215f, 0.475450282f, 0.47679923f, 0.478147056f, 0.479493758f, 0.480839331f,
+  0.482183772f, 0.483527079f, 0.484869248f, 0.486210276f, 0.48755016f, 0.488888897f, 0.490226483f, 0.491562916f,
+  0.492898192f, 0.494232309f, 0.495565262f, 0.496897049f, 0.498227667f, 0.499557113f, 0.500885383f, 0.502212474f,
+  0.503538384f, 0.504863109f, 0.506186645f, 0.507508991f, 0.508830143f, 0.510150097f, 0.51146885f, 0.512786401f,
+  0.514102744f, 0.515417878f, 0.516731799f, 0.518044504f, 0.51935599f, 0.520666254f, 0.521975293f, 0.523283103f,
+  0.524589683f, 0.525895027f, 0.527199135f, 0.528502002f, 0.529803625f, 0.531104001f, 0.532403128f, 0.533701002f,
+  0.53499762f, 0.536292979f, 0.537587076f, 0.538879909f, 0.540171473f, 0.541461766f, 0.542750785f, 0.544038527f,
+  0.545324988f, 0.546610167f, 0.547894059f, 0.549176662f, 0.550457973f, 0.551737988f, 0.553016706f, 0.554294121f,
+  0.555570233f, 0.556845037f, 0.558118531f, 0.559390712f, 0.560661576f, 0.561931121f, 0.563199344f, 0.564466242f,
+  0.565731811f, 0.566996049f, 0.568258953f, 0.569520519f, 0.570780746f, 0.572039629f, 0.573297167f, 0.574553355f,
+  0.575808191f, 0.577061673f, 0.578313796f, 0.579564559f, 0.580813958f, 0.58206199f, 0.583308653f, 0.584553943f,
+  0.585797857f, 0.587040394f, 0.588281548f, 0.589521319f, 0.590759702f, 0.591996695f, 0.593232295f, 0.594466499f,
+  0.595699304f, 0.596930708f, 0.598160707f, 0.599389298f, 0.600616479f, 0.601842247f, 0.603066599f, 0.604289531f,
+  0.605511041f, 0.606731127f, 0.607949785f, 0.609167012f, 0.610382806f, 0.611597164f, 0.612810082f, 0.614021559f,
+  0.615231591f, 0.616440175f, 0.617647308f, 0.618852988f, 0.620057212f, 0.621259977f, 0.622461279f, 0.623661118f,
+  0.624859488f, 0.626056388f, 0.627251815f, 0.628445767f, 0.629638239f, 0.63082923f, 0.632018736f, 0.633206755f,
+  0.634393284f, 0.63557832f, 0.636761861f, 0.637943904f, 0.639124445f, 0.640303482f, 0.641481013f, 0.642657034f,
+  0.643831543f, 0.645004537f, 0.646176013f, 0.647345969f, 0.648514401f, 0.649681307f, 0.650846685f, 0.652010531f,
+  0.653172843f, 0.654333618f, 0.655492853f, 0.656650546f, 0.657806693f, 0.658961293f, 0.660114342f, 0.661265838f,
+  0.662415778f, 0.663564159f, 0.664710978f, 0.665856234f, 0.666999922f, 0.668142041f, 0.669282588f, 0.67042156f,
+  0.671558955f, 0.672694769f, 0.673829f, 0.674961646f, 0.676092704f, 0.67722217f, 0.678350043f, 0.67947632f,
+  0.680600998f, 0.681724074f, 0.682845546f, 0.683965412f, 0.685083668f, 0.686200312f, 0.687315341f, 0.688428753f,
+  0.689540545f, 0.690650714f, 0.691759258f, 0.692866175f, 0.693971461f, 0.695075114f, 0.696177131f, 0.697277511f,
+  0.698376249f, 0.699473345f, 0.700568794f, 0.701662595f, 0.702754744f, 0.703845241f, 0.70493408f, 0.706021261f,
+  0.707106781f, 0.708190637f, 0.709272826f, 0.710353347f, 0.711432196f, 0.712509371f, 0.713584869f, 0.714658688f,
+  0.715730825f, 0.716801279f, 0.717870045f, 0.718937122f, 0.720002508f, 0.721066199f, 0.722128194f, 0.723188489f,
+  0.724247083f, 0.725303972f, 0.726359155f, 0.727412629f, 0.72846439f, 0.729514438f, 0.730562769f, 0.731609381f,
+  0.732654272f, 0.733697438f, 0.734738878f, 0.735778589f, 0.736816569f, 0.737852815f, 0.738887324f, 0.739920095f,
+  0.740951125f, 0.741980412f, 0.743007952f, 0.744033744f, 0.745057785f, 0.746080074f, 0.747100606f, 0.74811938f,
+  0.749136395f, 0.750151646f, 0.751165132f, 0.75217685f, 0.753186799f, 0.754194975f, 0.755201377f, 0.756206001f,
+  0.757208847f, 0.75820991f, 0.759209189f, 0.760206682f, 0.761202385f, 0.762196298f, 0.763188417f, 0.764178741f,
+  0.765167266f, 0.76615399f, 0.767138912f, 0.768122029f, 0.769103338f, 0.770082837f, 0.771060524f, 0.772036397f,
+  0.773010453f, 0.773982691f, 0.774953107f, 0.775921699f, 0.776888466f, 0.777853404f, 0.778816512f, 0.779777788f,
+  0.780737229f, 0.781694832f, 0.782650596f, 0.783604519f, 0.784556597f, 0.78550683f, 0.786455214f, 0.787401747f,
+  0.788346428f, 0.789289253f, 0.790230221f, 0.79116933f, 0.792106577f, 0.79304196f, 0.793975478f, 0.794907126f,
+  0.795836905f, 0.79676481f, 0.797690841f, 0.798614995f, 0.799537269f, 0.800457662f, 0.801376172f, 0.802292796f,
+  0.803207531f, 0.804120377f, 0.805031331f, 0.805940391f, 0.806847554f, 0.807752818f, 0.808656182f, 0.809557642f,
+  0.810457198f, 0.811354847f, 0.812250587f, 0.813144415f, 0.81403633f, 0.814926329f, 0.815814411f, 0.816700573f,
+  0.817584813f, 0.81846713f, 0.81934752f, 0.820225983f, 0.821102515f, 0.821977115f, 0.822849781f, 0.823720511f,
+  0.824589303f, 0.825456154f, 0.826321063f, 0.827184027f, 0.828045045f, 0.828904115f, 0.829761234f, 0.8306164f,
+  0.831469612f, 0.832320868f, 0.833170165f, 0.834017501f, 0.834862875f, 0.835706284f, 0.836547727f, 0.837387202f,
+  0.838224706f, 0.839060237f, 0.839893794f, 0.840725375f, 0.841554977f, 0.8423826f, 0.84320824f, 0.844031895f,
+  0.844853565f, 0.845673247f, 0.846490939f, 0.847306639f, 0.848120345f, 0.848932055f, 0.849741768f, 0.850549481f,
+  0.851355193f, 0.852158902f, 0.852960605f, 0.853760301f, 0.854557988f, 0.855353665f, 0.856147328f, 0.856938977f,
+  0.85772861f, 0.858516224f, 0.859301818f, 0.86008539f, 0.860866939f, 0.861646461f, 0.862423956f, 0.863199422f,
+  0.863972856f, 0.864744258f, 0.865513624f, 0.866280954f, 0.867046246f, 0.867809497f, 0.868570706f, 0.869329871f,
+  0.870086991f, 0.870842063f, 0.871595087f, 0.872346059f, 0.873094978f, 0.873841843f, 0.874586652f, 0.875329403f,
+  0.876070094f, 0.876808724f, 0.87754529f, 0.878279792f, 0.879012226f, 0.879742593f, 0.880470889f, 0.881197113f,
+  0.881921264f, 0.88264334f, 0.883363339f, 0.884081259f, 0.884797098f, 0.885510856f, 0.88622253f, 0.886932119f,
+  0.88763962f, 0.888345033f, 0.889048356f, 0.889749586f, 0.890448723f, 0.891145765f, 0.891840709f, 0.892533555f,
+  0.893224301f, 0.893912945f, 0.894599486f, 0.895283921f, 0.89596625f, 0.89664647f, 0.897324581f, 0.89800058f,
+  0.898674466f, 0.899346237f, 0.900015892f, 0.900683429f, 0.901348847f, 0.902012144f, 0.902673318f, 0.903332368f,
+  0.903989293f, 0.904644091f, 0.905296759f, 0.905947298f, 0.906595705f, 0.907241978f, 0.907886116f, 0.908528119f,
+  0.909167983f, 0.909805708f, 0.910441292f, 0.911074734f, 0.911706032f, 0.912335185f, 0.91296219f, 0.913587048f,
+  0.914209756f, 0.914830312f, 0.915448716f, 0.916064966f, 0.91667906f, 0.917290997f, 0.917900776f, 0.918508394f,
+  0.919113852f, 0.919717146f, 0.920318277f, 0.920917242f, 0.921514039f, 0.922108669f, 0.922701128f, 0.923291417f,
+  0.923879533f, 0.924465474f, 0.925049241f, 0.925630831f, 0.926210242f, 0.926787474f, 0.927362526f, 0.927935395f,
+  0.92850608f, 0.929074581f, 0.929640896f, 0.930205023f, 0.930766961f, 0.931326709f, 0.931884266f, 0.932439629f,
+  0.932992799f, 0.933543773f, 0.93409255f, 0.93463913f, 0.93518351f, 0.935725689f, 0.936265667f, 0.936803442f,
+  0.937339012f, 0.937872376f, 0.938403534f, 0.938932484f, 0.939459224f, 0.939983753f, 0.940506071f, 0.941026175f,
+  0.941544065f, 0.94205974f, 0.942573198f, 0.943084437f, 0.943593458f, 0.944100258f, 0.944604837f, 0.945107193f,
+  0.945607325f, 0.946105232f, 0.946600913f, 0.947094366f, 0.947585591f, 0.948074586f, 0.94856135f, 0.949045882f,
+  0.949528181f, 0.950008245f, 0.950486074f, 0.950961666f, 0.951435021f, 0.951906137f, 0.952375013f, 0.952841648f,
+  0.95330604f, 0.95376819f, 0.954228095f, 0.954685755f, 0.955141168f, 0.955594334f, 0.956045251f, 0.956493919f,
+  0.956940336f, 0.957384501f, 0.957826413f, 0.958266071f, 0.958703475f, 0.959138622f, 0.959571513f, 0.960002146f,
+  0.960430519f, 0.960856633f, 0.961280486f, 0.961702077f, 0.962121404f, 0.962538468f, 0.962953267f, 0.9633658f,
+  0.963776066f, 0.964184064f, 0.964589793f, 0.964993253f, 0.965394442f, 0.965793359f, 0.966190003f, 0.966584374f,
+  0.966976471f, 0.967366292f, 0.967753837f, 0.968139105f, 0.968522094f, 0.968902805f, 0.969281235f, 0.969657385f,
+  0.970031253f, 0.970402839f, 0.970772141f, 0.971139158f, 0.971503891f, 0.971866337f, 0.972226497f, 0.972584369f,
+  0.972939952f, 0.973293246f, 0.97364425f, 0.973992962f, 0.974339383f, 0.974683511f, 0.975025345f, 0.975364885f,
+  0.97570213f, 0.976037079f, 0.976369731f, 0.976700086f, 0.977028143f, 0.9773539f, 0.977677358f, 0.977998515f,
+  0.978317371f, 0.978633924f, 0.978948175f, 0.979260123f, 0.979569766f, 0.979877104f, 0.980182136f, 0.980484862f,
+  0.98078528f, 0.981083391f, 0.981379193f, 0.981672686f, 0.981963869f, 0.982252741f, 0.982539302f, 0.982823551f,
+  0.983105487f, 0.98338511f, 0.983662419f, 0.983937413f, 0.984210092f, 0.984480455f, 0.984748502f, 0.985014231f,
+  0.985277642f, 0.985538735f, 0.985797509f, 0.986053963f, 0.986308097f, 0.98655991f, 0.986809402f, 0.987056571f,
+  0.987301418f, 0.987543942f, 0.987784142f, 0.988022017f, 0.988257568f, 0.988490793f, 0.988721692f, 0.988950265f,
+  0.98917651f, 0.989400428f, 0.989622017f, 0.989841278f, 0.99005821f, 0.990272812f, 0.990485084f, 0.990695025f,
+  0.990902635f, 0.991107914f, 0.99131086f, 0.991511473f, 0.991709754f, 0.9919057f, 0.992099313f, 0.992290591f,
+  0.992479535f, 0.992666142f, 0.992850414f, 0.99303235f, 0.993211949f, 0.993389211f, 0.993564136f, 0.993736722f,
+  0.99390697f, 0.994074879f, 0.994240449f, 0.99440368f, 0.994564571f, 0.994723121f, 0.994879331f, 0.995033199f,
+  0.995184727f, 0.995333912f, 0.995480755f, 0.995625256f, 0.995767414f, 0.995907229f, 0.996044701f, 0.996179829f,
+  0.996312612f, 0.996443051f, 0.996571146f, 0.996696895f, 0.996820299f, 0.996941358f, 0.99706007f, 0.997176437f,
+  0.997290457f, 0.99740213f, 0.997511456f, 0.997618435f, 0.997723067f, 0.99782535f, 0.997925286f, 0.998022874f,
+  0.998118113f, 0.998211003f, 0.998301545f, 0.998389737f, 0.998475581f, 0.998559074f, 0.998640218f, 0.998719012f,
+  0.998795456f, 0.99886955f, 0.998941293f, 0.999010686f, 0.999077728f, 0.999142419f, 0.999204759f, 0.999264747f,
+  0.999322385f, 0.99937767f, 0.999430605f, 0.999481187f, 0.999529418f, 0.999575296f, 0.999618822f, 0.999659997f,
+  0.999698819f, 0.999735288f, 0.999769405f, 0.99980117f, 0.999830582f, 0.999857641f, 0.999882347f, 0.999904701f,
+  0.999924702f, 0.99994235f, 0.999957645f, 0.999970586f, 0.999981175f, 0.999989411f, 0.999995294f, 0.999998823f,
+  1.0f,
+};
+
+const q15_t hamming_1024_q15[512] = {
+  2621, 2622, 2623, 2624, 2626, 2629, 2632, 2635,
+  2640, 2644, 2650, 2656, 2662, 2669, 2677, 2685,
+  2694, 2704, 2713, 2724, 2735, 2747, 2759, 2772,
+  2785, 2799, 2813, 2828, 2844, 2860, 2877, 2894,
+  2912, 2930, 2949, 2968, 2988, 3009, 3030, 3052,
+  3074, 3097, 3120, 3144, 3169, 3194, 3219, 3245,
+  3272, 3299, 3327, 3355, 3384, 3413, 3443, 3473,
+  3504, 3536, 3568, 3600, 3633, 3667, 3701, 3736,
+  3771, 3807, 3843, 3880, 3917, 3955, 3993, 4032,
+  4071, 4111, 4152, 4193, 4234, 4276, 4318, 4361,
+  4405, 4449, 4493, 4538, 4583, 4629, 4676, 4723,
+  4770, 4818, 4866, 4915, 4964, 5014, 5065, 5115,
+  5167, 5218, 5270, 5323, 5376, 5430, 5484, 5538,
+  5593, 5649, 5705, 5761, 5818, 5875, 5933, 5991,
+  6049, 6108, 6168, 6228, 6288, 6349, 6410, 6471,
+  6533, 6596, 6659, 6722, 6786, 6850, 6914, 6979,
+  7044, 7110, 7176, 7243, 7310, 7377, 7445, 7513,
+  7581, 7650, 7719, 7789, 7859, 7929, 8000, 8071,
+  8142, 8214, 8286, 8359, 8432, 8505, 8578, 8652,
+  8727, 8801, 8876, 8951, 9027, 9103, 9179, 9256,
+  9332, 9410, 9487, 9565, 9643, 9721, 9800, 9879,
+  9959, 10038, 10118, 10198, 10279, 10359, 10440, 10522,
+  10603, 10685, 10767, 10850, 10932, 11015, 11098, 11181,
+  11265, 11349, 11433, 11517, 11602, 11687, 11772, 11857,
+  11942, 12028, 12114, 12200, 12286, 12373, 12460, 12547,
+  12634, 12721, 12808, 12896, 12984, 13072, 13160, 13249,
+  13337, 13426, 13515, 13604, 13693, 13782, 13872, 13961,
+  14051, 14141, 14231, 14321, 14412, 14502, 14593, 14683,
+  14774, 14865, 14956, 15047, 15138, 15229, 15321, 15412,
+  15504, 15595, 15687, 15779, 15871, 15963, 16055, 16147,
+  16239, 16331, 16423, 16516, 16608, 16700, 16793, 16885,
+  16978, 17070, 17163, 17255, 17348, 17440, 17533, 17625,
+  17718, 17810, 17903, 17996, 18088, 18181, 18273, 18366,
+  18458, 18551, 18643, 18735, 18828, 18920, 19012, 19104,
+  19197, 19289, 19381, 19473, 19565, 19656, 19748, 19840,
+  19931, 20023, 20114, 20206, 20297, 20388, 20479, 20570,
+  20661, 20752, 20842, 20933, 21023, 21113, 21203, 21293,
+  21383, 21473, 21562, 21652, 21741, 21830, 21919, 22008,
+  22097, 22185, 22273, 22361, 22449, 22537, 22625, 22712,
+  22799, 22886, 22973, 23060, 23146, 23232, 23318, 23404,
+  23490, 23575, 23660, 23745, 23830, 23914, 23998, 24082,
+  24166, 24250, 24333, 24416, 24499, 24581, 24663, 24745,
+  24827, 24908, 24990, 25070, 25151, 25231, 25311, 25391,
+  25471, 25550, 25629, 25707, 25785, 25863, 25941, 26018,
+  26095, 26172, 26249, 26325, 26400, 26476, 26551, 26626,
+  26700, 26774, 26848, 26921, 26994, 27067, 27139, 27211,
+  27283, 27354, 27425, 27495, 27566, 27635, 27705, 27774,
+  27842, 27911, 27979, 28046, 28113, 28180, 28246, 28312,
+  28378, 28443, 28507, 28572, 28636, 28699, 28762, 28825,
+  28887, 28949, 29010, 29071, 29132, 29192, 29251, 29311,
+  29369, 29428, 29486, 29543, 29600, 29657, 29713, 29768,
+  29824, 29878, 29933, 29986, 30040, 30093, 30145, 30197,
+  30249, 30300, 30350, 30400, 30450, 30499, 30547, 30596,
+  30643, 30690, 30737, 30783, 30829, 30874, 30919, 30963,
+  31007, 31050, 31092, 31135, 31176, 31217, 31258, 31298,
+  31338, 31377, 31415, 31454, 31491, 31528, 31565, 31601,
+  31636, 31671, 31705, 31739, 31773, 31805, 31838, 31869,
+  31901, 31931, 31962, 31991, 32020, 32049, 32077, 32104,
+  32131, 32157, 32183, 32208, 32233, 32257, 32281, 32304,
+  32327, 32349, 32370, 32391, 32411, 32431, 32450, 32469,
+  32487, 32504, 32521, 32538, 32554, 32569, 32584, 32598,
+  32611, 32624, 32637, 32649, 32660, 32671, 32681, 32691,
+  32700, 32708, 32716, 32724, 32730, 32737, 32742, 32747,
+  32752, 32756, 32759, 32762, 32765, 32766, 32767, 32767,
+};
+
+const q15_t hamming_2048_q15[1024] = {
+  2621, 2622, 2622, 2622, 2623, 2623, 2624, 2625,
+  2626, 2627, 2629, 2630, 2632, 2633, 2635, 2637,
+  2640, 2642, 2644, 2647, 2650, 2653, 2656, 2659,
+  2662, 2666, 2669, 2673, 2677, 2681, 2685, 2690,
+  2694, 2699, 2703, 2708, 2713, 2719, 2724, 2729,
+  2735, 2741, 2747, 2753, 2759, 2765, 2771, 2778,
+  2785, 2792, 2799, 2806, 2813, 2820, 2828, 2836,
+  2844, 2852, 2860, 2868, 2876, 2885, 2894, 2902,
+  2911, 2920, 2930, 2939, 2949, 2958, 2968, 2978,
+  2988, 2998, 3009, 3019, 3030, 3040, 3051, 3062,
+  3074, 3085, 3096, 3108, 3120, 3132, 3144, 3156,
+  3168, 3180, 3193, 3206, 3218, 3231, 3245, 3258,
+  3271, 3285, 3298, 3312, 3326, 3340, 3354, 3369,
+  3383, 3398, 3412, 3427, 3442, 3457, 3472, 3488,
+  3503, 3519, 3535, 3551, 3567, 3583, 3599, 3616,
+  3632, 3649, 3666, 3683, 3700, 3717, 3735, 3752,
+  3770, 3788, 3806, 3824, 3842, 3860, 3879, 3897,
+  3916, 3935, 3954, 3973, 3992, 4011, 4031, 4050,
+  4070, 4090, 4110, 4130, 4150, 4171, 4191, 4212,
+  4232, 4253, 4274, 4295, 4317, 4338, 4360, 4381,
+  4403, 4425, 4447, 4469, 4491, 4514, 4536, 4559,
+  4582, 4604, 4627, 4651, 4674, 4697, 4721, 4744,
+  4768, 4792, 4816, 4840, 4864, 4888, 4913, 4938,
+  4962, 4987, 5012, 5037, 5062, 5088, 5113, 5138,
+  5164, 5190, 5216, 5242, 5268, 5294, 5321, 5347,
+  5374, 5400, 5427, 5454, 5481, 5508, 5536, 5563,
+  5591, 5618, 5646, 5674, 5702, 5730, 5758, 5786,
+  5815, 5843, 5872, 5901, 5930, 5959, 5988, 6017,
+  6046, 6076, 6105, 6135, 6164, 6194, 6224, 6254,
+  6285, 6315, 6345, 6376, 6406, 6437, 6468, 6499,
+  6530, 6561, 6592, 6624, 6655, 6687, 6718, 6750,
+  6782, 6814, 6846, 6878, 6910, 6943, 6975, 7008,
+  7040, 7073, 7106, 7139, 7172, 7205, 7239, 7272,
+  7305, 7339, 7373, 7406, 7440, 7474, 7508, 7542,
+  7577, 7611, 7645, 7680, 7715, 7749, 7784, 7819,
+  7854, 7889, 7924, 7960, 7995, 8030, 8066, 8102,
+  8137, 8173, 8209, 8245, 8281, 8317, 8354, 8390,
+  8426, 8463, 8500, 8536, 8573, 8610, 8647, 8684,
+  8721, 8758, 8796, 8833, 8870, 8908, 8946, 8983,
+  9021, 9059, 9097, 9135, 9173, 9211, 9250, 9288,
+  9326, 9365, 9404, 9442, 9481, 9520, 9559, 9598,
+  9637, 9676, 9715, 9754, 9794, 9833, 9873, 9912,
+  9952, 9992, 10032, 10071, 10111, 10151, 10191, 10232,
+  10272, 10312, 10353, 10393, 10434, 10474, 10515, 10555,
+  10596, 10637, 10678, 10719, 10760, 10801, 10842, 10884,
+  10925, 10966, 11008, 11049, 11091, 11132, 11174, 11216,
+  11258, 11299, 11341, 11383, 11425, 11468, 11510, 11552,
+  11594, 11637, 11679, 11721, 11764, 11806, 11849, 11892,
+  11934, 11977, 12020, 12063, 12106, 12149, 12192, 12235,
+  12278, 12321, 12365, 12408, 12451, 12495, 12538, 12582,
+  12625, 12669, 12712, 12756, 12800, 12844, 12887, 12931,
+  12975, 13019, 13063, 13107, 13151, 13196, 13240, 13284,
+  13328, 13372, 13417, 13461, 13506, 13550, 13595, 13639,
+  13684, 13728, 13773, 13818, 13862, 13907, 13952, 13997,
+  14042, 14087, 14132, 14176, 14222, 14267, 14312, 14357,
+  14402, 14447, 14492, 14537, 14583, 14628, 14673, 14719,
+  14764, 14809, 14855, 14900, 14946, 14991, 15037, 15082,
+  15128, 15174, 15219, 15265, 15310, 15356, 15402, 15448,
+  15493, 15539, 15585, 15631, 15677, 15722, 15768, 15814,
+  15860, 15906, 15952, 15998, 16044, 16090, 16136, 16182,
+  16228, 16274, 16320, 16366, 16412, 16458, 16505, 16551,
+  16597, 16643, 16689, 16735, 16782, 16828, 16874, 16920,
+  16966, 17013, 17059, 17105, 17151, 17197, 17244, 17290,
+  17336, 17382, 17429, 17475, 17521, 17567, 17614, 17660,
+  17706, 17753, 17799, 17845, 17891, 17938, 17984, 18030,
+  18076, 18123, 18169, 18215, 18261, 18308, 18354, 18400,
+  18446, 18492, 18539, 18585, 18631, 18677, 18723, 18770,
+  18816, 18862, 18908, 18954, 19000, 19046, 19092, 19138,
+  19184, 19230, 19276, 19322, 19368, 19414, 19460, 19506,
+  19552, 19598, 19644, 19690, 19736, 19782, 19827, 19873,
+  19919, 19965, 20010, 20056, 20102, 20147, 20193, 20239,
+  20284, 20330, 20375, 20421, 20466, 20512, 20557, 20603,
+  20648, 20693, 20739, 20784, 20829, 20875, 20920, 20965,
+  21010, 21055, 21100, 21145, 21190, 21235, 21280, 21325,
+  21370, 21415, 21460, 21505, 21549, 21594, 21639, 21683,
+  21728, 21773, 21817, 21862, 21906, 21950, 21995, 22039,
+  22083, 22128, 22172, 22216, 22260, 22304, 22348, 22392,
+  22436, 22480, 22524, 22568, 22611, 22655, 22699, 22742,
+  22786, 22830, 22873, 22916, 22960, 23003, 23046, 23090,
+  23133, 23176, 23219, 23262, 23305, 23348, 23391, 23434,
+  23476, 23519, 23562, 23604, 23647, 23689, 23732, 23774,
+  23816, 23859, 23901, 23943, 23985, 24027, 24069, 24111,
+  24153, 24195, 24236, 24278, 24320, 24361, 24402, 24444,
+  24485, 24527, 24568, 24609, 24650, 24691, 24732, 24773,
+  24814, 24854, 24895, 24936, 24976, 25017, 25057, 25097,
+  25138, 25178, 25218, 25258, 25298, 25338, 25378, 25418,
+  25457, 25497, 25536, 25576, 25615, 25655, 25694, 25733,
+  25772, 25811, 25850, 25889, 25928, 25967, 26005, 26044,
+  26082, 26121, 26159, 26197, 26235, 26273, 26311, 26349,
+  26387, 26425, 26463, 26500, 26538, 26575, 26612, 26650,
+  26687, 26724, 26761, 26798, 26835, 26872, 26908, 26945,
+  26981, 27018, 27054, 27090, 27126, 27162, 27198, 27234,
+  27270, 27306, 27341, 27377, 27412, 27447, 27483, 27518,
+  27553, 27588, 27623, 27657, 27692, 27727, 27761, 27796,
+  27830, 27864, 27898, 27932, 27966, 28000, 28034, 28067,
+  28101, 28134, 28168, 28201, 28234, 28267, 28300, 28333,
+  28365, 28398, 28431, 28463, 28495, 28528, 28560, 28592,
+  28624, 28655, 28687, 28719, 28750, 28782, 28813, 28844,
+  28875, 28906, 28937, 28968, 28998, 29029, 29059, 29090,
+  29120, 29150, 29180, 29210, 29240, 29270, 29299, 29329,
+  29358, 29387, 29416, 29445, 29474, 29503, 29532, 29560,
+  29589, 29617, 29646, 29674, 29702, 29730, 29757, 29785,
+  29813, 29840, 29867, 29895, 29922, 29949, 29976, 30002,
+  30029, 30056, 30082, 30108, 30135, 30161, 30187, 30212,
+  30238, 30264, 30289, 30315, 30340, 30365, 30390, 30415,
+  30440, 30464, 30489, 30513, 30537, 30562, 30586, 30610,
+  30633, 30657, 30681, 30704, 30727, 30750, 30774, 30796,
+  30819, 30842, 30865, 30887, 30909, 30932, 30954, 30976,
+  30997, 31019, 31041, 31062, 31083, 31105, 31126, 31147,
+  31167, 31188, 31209, 31229, 31249, 31270, 31290, 31310,
+  31329, 31349, 31368, 31388, 31407, 31426, 31445, 31464,
+  31483, 31502, 31520, 31538, 31557, 31575, 31593, 31611,
+  31628, 31646, 31663, 31681, 31698, 31715, 31732, 31749,
+  31765, 31782, 31798, 31814, 31831, 31847, 31862, 31878,
+  31894, 31909, 31925, 31940, 31955, 31970, 31985, 31999,
+  32014, 32028, 32042, 32056, 32070, 32084, 32098, 32112,
+  32125, 32138, 32151, 32165, 32177, 32190, 32203, 32215,
+  32228, 32240, 32252, 32264, 32276, 32287, 32299, 32310,
+  32321, 32333, 32344, 32354, 32365, 32376, 32386, 32396,
+  32406, 32416, 32426, 32436, 32446, 32455, 32464, 32474,
+  32483, 32491, 32500, 32509, 32517, 32526, 32534, 32542,
+  32550, 32558, 32565, 32573, 32580, 32587, 32594, 32601,
+  32608, 32615, 32621, 32628, 32634, 32640, 32646, 32652,
+  32657, 32663, 32668, 32673, 32679, 32684, 32688, 32693,
+  32698, 32702, 32706, 32710, 32714, 32718, 32722, 32725,
+  32729, 32732, 32735, 32738, 32741, 32744, 32746, 32749,
+  32751, 32753, 32755, 32757, 32759, 32760, 32762, 32763,
+  32764, 32765, 32766, 32767, 32767, 32767, 32767, 32767,
+};
+
+const q15_t sine_4096_q15[1025] = {
+  0, 50, 101, 151, 201, 251, 302, 352,
+  402, 452, 503, 553, 603, 653, 704, 754,
+  804, 854, 905, 955, 1005, 1055, 1106, 1156,
+  1206, 1256, 1307, 1357, 1407, 1457, 1507, 1558,
+  1608, 1658, 1708, 1758, 1809, 1859, 1909, 1959,
+  2009, 2060, 2110, 2160, 2210, 2260, 2310, 2360,
+  2411, 2461, 2511, 2561, 2611, 2661, 2711, 2761,
+  2811, 2861, 2912, 2962, 3012, 3062, 3112, 3162,
+  3212, 3262, 3312, 3362, 3412, 3462, 3512, 3562,
+  3612, 3662, 3712, 3762, 3812, 3861, 3911, 3961,
+  4011, 4061, 4111, 4161, 4211, 4260, 4310, 4360,
+  4410, 4460, 4510, 4559, 4609, 4659, 4709, 4758,
+  4808, 4858, 4907, 4957, 5007, 5057, 5106, 5156,
+  5205, 5255, 5305, 5354, 5404, 5453, 5503, 5553,
+  5602, 5652, 5701, 5751, 5800, 5850, 5899, 5948,
+  5998, 6047, 6097, 6146, 6195, 6245, 6294, 6343,
+  6393, 6442, 6491, 6541, 6590, 6639, 6688, 6737,
+  6787, 6836, 6885, 6934, 6983, 7032, 7081, 7130,
+  7180, 7229, 7278, 7327, 7376, 7425, 7473, 7522,
+  7571, 7620, 7669, 7718, 7767, 7816, 7864, 7913,
+  7962, 8011, 8059, 8108, 8157, 8206, 8254, 8303,
+  8351, 8400, 8449, 8497, 8546, 8594, 8643, 8691,
+  8740, 8788, 8836, 8885, 8933, 8982, 9030, 9078,
+  9127, 9175, 9223, 9271, 9319, 9368, 9416, 9464,
+  9512, 9560, 9608, 9656, 9704, 9752, 9800, 9848,
+  9896, 9944, 9992, 10040, 10088, 10135, 10183, 10231,
+  10279, 10326, 10374, 10422, 10469, 10517, 10565, 10612,
+  10660, 10707, 10755, 10802, 10850, 10897, 10945, 10992,
+  11039, 11087, 11134, 11181, 11228, 11276, 11323, 11370,
+  11417, 11464, 11511, 11558, 11605, 11652, 11699, 11746,
+  11793, 11840, 11887, 11934, 11980, 12027, 12074, 12121,
+  12167, 12214, 12261, 12307, 12354, 12400, 12447, 12493,
+  12540, 12586, 12633, 12679, 12725, 12772, 12818, 12864,
+  12910, 12957, 13003, 13049, 13095, 13141, 13187, 13233,
+  13279, 13325, 13371, 13417, 13463, 13508, 13554, 13600,
+  13646, 13691, 13737, 13783, 13828, 13874, 13919, 13965,
+  14010, 14056, 14101, 14146, 14192, 14237, 14282, 14327,
+  14373, 14418, 14463, 14508, 14553, 14598, 14643, 14688,
+  14733, 14778, 14823, 14867, 14912, 14957, 15002, 15046,
+  15091, 15136, 15180, 15225, 15269, 15314, 15358, 15402,
+  15447, 15491, 15535, 15580, 15624, 15668, 15712, 15756,
+  15800, 15844, 15888, 15932, 15976, 16020, 16064, 16108,
+  16151, 16195, 16239, 16282, 16326, 16369, 16413, 16456,
+  16500, 16543, 16587, 16630, 16673, 16717, 16760, 16803,
+  16846, 16889, 16932, 16975, 17018, 17061, 17104, 17147,
+  17190, 17233, 17275, 17318, 17361, 17403, 17446, 17488,
+  17531, 17573, 17616, 17658, 17700, 17743, 17785, 17827,
+  17869, 17911, 17953, 17995, 18037, 18079, 18121, 18163,
+  18205, 18247, 18288, 18330, 18372, 18413, 18455, 18496,
+  18538, 18579, 18621, 18662, 18703, 18745, 18786, 18827,
+  18868, 18909, 18950, 18991, 19032, 19073, 19114, 19155,
+  19195, 19236, 19277, 19317, 19358, 19399, 19439, 19479,
+  19520, 19560, 19601, 19641, 19681, 19721, 19761, 19801,
+  19841, 19881, 19921, 19961, 20001, 20041, 20081, 20120,
+  20160, 20200, 20239, 20279, 20318, 20357, 20397, 20436,
+  20475, 20515, 20554, 20593, 20632, 20671, 20710, 20749,
+  20788, 20827, 20865, 20904, 20943, 20981, 21020, 21059,
+  21097, 21136, 21174, 21212, 21251, 21289, 21327, 21365,
+  21403, 21441, 21479, 21517, 21555, 21593, 21631, 21668,
+  21706, 21744, 21781, 21819, 21856, 21894, 21931, 21968,
+  22006, 22043, 22080, 22117, 22154, 22191, 22228, 22265,
+  22302, 22339, 22375, 22412, 22449, 22485, 22522, 22558,
+  22595, 22631, 22668, 22704, 22740, 22776, 22812, 22848,
+  22884, 22920, 22956, 22992, 23028, 23064, 23099, 23135,
+  23170, 23206, 23241, 23277, 23312, 23348, 23383, 23418,
+  23453, 23488, 23523, 23558, 23593, 23628, 23663, 23697,
+  23732, 23767, 23801, 23836, 23870, 23905, 23939, 23973,
+  24008, 24042, 24076, 24110, 24144, 24178, 24212, 24246,
+  24279, 24313, 24347, 24380, 24414, 24448, 24481, 24514,
+  24548, 24581, 24614, 24647, 24680, 24713, 24746, 24779,
+  24812, 24845, 24878, 24910, 24943, 24976, 25008, 25041,
+  25073, 25105, 25138, 25170, 25202, 25234, 25266, 25298,
+  25330, 25362, 25394, 25425, 25457, 25489, 25520, 25552,
+  25583, 25615, 25646, 25677, 25708, 25739, 25771, 25802,
+  25833, 25863, 25894, 25925, 25956, 25986, 26017, 26048,
+  26078, 26108, 26139, 26169, 26199, 26229, 26259, 26290,
+  26320, 26349, 26379, 26409, 26439, 26468, 26498, 26528,
+  26557, 26586, 26616, 26645, 26674, 26704, 26733, 26762,
+  26791, 26820, 26848, 26877, 26906, 26935, 26963, 26992,
+  27020, 27049, 27077, 27105, 27133, 27162, 27190, 27218,
+  27246, 27273, 27301, 27329, 27357, 27384, 27412, 27440,
+  27467, 27494, 27522, 27549, 27576, 27603, 27630, 27657,
+  27684, 27711, 27738, 27765, 27791, 27818, 27844, 27871,
+  27897, 27924, 27950, 27976, 28002, 28028, 28054, 28080,
+  28106, 28132, 28158, 28183, 28209, 28234, 28260, 28285,
+  28311, 28336, 28361, 28386, 28411, 28436, 28461, 28486,
+  28511, 28536, 28560, 28585, 28610, 28634, 28658, 28683,
+  28707, 28731, 28755, 28779, 28803, 28827, 28851, 28875,
+  28899, 28922, 28946, 28970, 28993, 29016, 29040, 29063,
+  29086, 29109, 29132, 29155, 29178, 29201, 29224, 29247,
+  29269, 29292, 29314, 29337, 29359, 29381, 29404, 29426,
+  29448, 29470, 29492, 29514, 29535, 29557, 29579, 29600,
+  29622, 29643, 29665, 29686, 29707, 29729, 29750, 29771,
+  29792, 29813, 29833, 29854, 29875, 29895, 29916, 29936,
+  29957, 29977, 29997, 30018, 30038, 30058, 30078, 30098,
+  30118, 30137, 30157, 30177, 30196, 30216, 30235, 30254,
+  30274, 30293, 30312, 30331, 30350, 30369, 30388, 30407,
+  30425, 30444, 30462, 30481, 30499, 30518, 30536, 30554,
+  30572, 30590, 30608, 30626, 30644, 30662, 30680, 30697,
+  30715, 30732, 30750, 30767, 30784, 30801, 30819, 30836,
+  30853, 30869, 30886, 30903, 30920, 30936, 30953, 30969,
+  30986, 31002, 31018, 31034, 31050, 31067, 31082, 31098,
+  31114, 31130, 31146, 31161, 31177, 31192, 31207, 31223,
+  31238, 31253, 31268, 31283, 31298, 31313, 31328, 31342,
+  31357, 31372, 31386, 31400, 31415, 31429, 31443, 31457,
+  31471, 31485, 31499, 31513, 31527, 31540, 31554, 31568,
+  31581, 31594, 31608, 31621, 31634, 31647, 31660, 31673,
+  31686, 31699, 31711, 31724, 31737, 31749, 31761, 31774,
+  31786, 31798, 31810, 31822, 31834, 31846, 31858, 31870,
+  31881, 31893, 31904, 31916, 31927, 31938, 31950, 31961,
+  31972, 31983, 31994, 32005, 32015, 32026, 32037, 32047,
+  32058, 32068, 32078, 32088, 32099, 32109, 32119, 32129,
+  32138, 32148, 32158, 32167, 32177, 32186, 32196, 32205,
+  32214, 32224, 32233, 32242, 32251, 32259, 32268, 32277,
+  32286, 32294, 32303, 32311, 32319, 32328, 32336, 32344,
+  32352, 32360, 32368, 32376, 32383, 32391, 32398, 32406,
+  32413, 32421, 32428, 32435, 32442, 32449, 32456, 32463,
+  32470, 32477, 32483, 32490, 32496, 32503, 32509, 32515,
+  32522, 32528, 32534, 32540, 32546, 32551, 32557, 32563,
+  32568, 32574, 32579, 32585, 32590, 32595, 32600, 32605,
+  32610, 32615, 32620, 32625, 32629, 32634, 32638, 32643,
+  32647, 32651, 32656, 32660, 32664, 32668, 32672, 32675,
+  32679, 32683, 32686, 32690, 32693, 32697, 32700, 32703,
+  32706, 32709, 32712, 32715, 32718, 32721, 32723, 32726,
+  32729, 32731, 32733, 32736, 32738, 32740, 32742, 32744,
+  32746, 32748, 32749, 32751, 32753, 32754, 32756, 32757,
+  32758, 32759, 32760, 32761, 32762, 32763, 32764, 32765,
+  32766, 32766, 32767, 32767, 32767, 32767, 32767, 32767,
+  32767,
+};
+
+const q31_t hamming_1024_q31[512] = {
+  171798692, 171817324, 171873220, 171966378, 172096793, 172264462, 172469378, 172711533,
+  172990918, 173307523, 173661335, 174052341, 174480527, 174945876, 175448371, 175987992,
+  176564720, 177178533, 177829407, 178517318, 179242240, 180004146, 180803006, 181638792,
+  182511470, 183421009, 184367375, 185350530, 186370439, 187427062, 188520360, 189650292,
+  190816815, 192019885, 193259457, 194535484, 195847917, 197196708, 198581805, 200003156,
+  201460707, 202954404, 204484191, 206050008, 207651799, 209289501, 210963053, 212672392,
+  214417454, 216198173, 218014481, 219866310, 221753591, 223676251, 225634219, 227627421,
+  229655781, 231719223, 233817669, 235951040, 238119255, 240322233, 242559890, 244832143,
+  247138905, 249480090, 251855608, 254265371, 256709288, 259187266, 261699211, 264245030,
+  266824626, 269437902, 272084759, 274765098, 277478816, 280225813, 283005983, 285819224,
+  288665427, 291544486, 294456293, 297400737, 300377707, 303387092, 306428777, 309502647,
+  312608588, 315746481, 318916209, 322117651, 325350687, 328615195, 331911053, 335238134,
+  338596315, 341985468, 345405465, 348856178, 352337477, 355849229, 359391303, 362963564,
+  366565879, 370198111, 373860123, 377551778, 381272935, 385023454, 388803195, 392612014,
+  396449767, 400316311, 404211499, 408135183, 412087217, 416067451, 420075735, 424111917,
+  428175846, 432267368, 436386329, 440532573, 444705944, 448906285, 453133437, 457387241,
+  461667535, 465974160, 470306951, 474665747, 479050382, 483460690, 487896507, 492357663,
+  496843992, 501355324, 505891488, 510452313, 515037628, 519647259, 524281033, 528938774,
+  533620308, 538325457, 543054044, 547805890, 552580817, 557378644, 562199191, 567042274,
+  571907712, 576795322, 581704918, 586636315, 591589328, 596563770, 601559453, 606576188,
+  611613787, 616672059, 621750813, 626849859, 631969002, 637108052, 642266812, 647445090,
+  652642689, 657859414, 663095068, 668349453, 673622371, 678913623, 684223009, 689550330,
+  694895384, 700257970, 705637885, 711034926, 716448891, 721879573, 727326770, 732790275,
+  738269882, 743765384, 749276575, 754803245, 760345188, 765902193, 771474051, 777060552,
+  782661485, 788276639, 793905802, 799548761, 805205305, 810875218, 816558289, 822254301,
+  827963041, 833684293, 839417840, 845163468, 850920959, 856690095, 862470660, 868262435,
+  874065201, 879878741, 885702834, 891537261, 897381801, 903236235, 909100341, 914973898,
+  920856685, 926748479, 932649059, 938558202, 944475685, 950401284, 956334777, 962275939,
+  968224546, 974180374, 980143198, 986112793, 992088935, 998071397, 1004059954, 1010054380,
+  1016054448, 1022059934, 1028070609, 1034086247, 1040106622, 1046131506, 1052160672, 1058193893,
+  1064230940, 1070271587, 1076315604, 1082362766, 1088412842, 1094465605, 1100520827, 1106578279,
+  1112637733, 1118698960, 1124761731, 1130825818, 1136890992, 1142957025, 1149023687, 1155090749,
+  1161157983, 1167225159, 1173292050, 1179358426, 1185424057, 1191488717, 1197552174, 1203614202,
+  1209674571, 1215733053, 1221789418, 1227843439, 1233894888, 1239943535, 1245989153, 1252031514,
+  1258070389, 1264105551, 1270136773, 1276163826, 1282186484, 1288204519, 1294217705, 1300225813,
+  1306228618, 1312225894, 1318217414, 1324202951, 1330182281, 1336155178, 1342121416, 1348080770,
+  1354033015, 1359977928, 1365915283, 1371844857, 1377766426, 1383679767, 1389584656, 1395480871,
+  1401368190, 1407246389, 1413115249, 1418974546, 1424824061, 1430663572, 1436492859, 1442311703,
+  1448119883, 1453917181, 1459703379, 1465478256, 1471241597, 1476993183, 1482732798, 1488460225,
+  1494175247, 1499877650, 1505567219, 1511243738, 1516906993, 1522556771, 1528192859, 1533815044,
+  1539423114, 1545016857, 1550596063, 1556160521, 1561710021, 1567244353, 1572763310, 1578266682,
+  1583754263, 1589225844, 1594681221, 1600120186, 1605542535, 1610948064, 1616336567, 1621707843,
+  1627061688, 1632397901, 1637716279, 1643016624, 1648298734, 1653562410, 1658807454, 1664033668,
+  1669240854, 1674428817, 1679597361, 1684746290, 1689875411, 1694984529, 1700073453, 1705141990,
+  1710189949, 1715217140, 1720223373, 1725208459, 1730172209, 1735114438, 1740034958, 1744933584,
+  1749810131, 1754664414, 1759496252, 1764305461, 1769091861, 1773855270, 1778595509, 1783312399,
+  1788005763, 1792675422, 1797321202, 1801942926, 1806540421, 1811113513, 1815662029, 1820185798,
+  1824684649, 1829158413, 1833606920, 1838030004, 1842427496, 1846799232, 1851145046, 1855464774,
+  1859758254, 1864025323, 1868265821, 1872479587, 1876666463, 1880826290, 1884958912, 1889064173,
+  1893141918, 1897191992, 1901214245, 1905208522, 1909174675, 1913112553, 1917022007, 1920902891,
+  1924755058, 1928578362, 1932372660, 1936137808, 1939873664, 1943580087, 1947256937, 1950904077,
+  1954521367, 1958108672, 1961665857, 1965192786, 1968689328, 1972155350, 1975590721, 1978995313,
+  1982368996, 1985711642, 1989023127, 1992303326, 1995552113, 1998769368, 2001954968, 2005108793,
+  2008230724, 2011320645, 2014378437, 2017403986, 2020397177, 2023357898, 2026286038, 2029181484,
+  2032044129, 2034873864, 2037670583, 2040434179, 2043164550, 2045861591, 2048525201, 2051155280,
+  2053751728, 2056314448, 2058843342, 2061338316, 2063799275, 2066226126, 2068618778, 2070977140,
+  2073301125, 2075590643, 2077845608, 2080065937, 2082251543, 2084402347, 2086518265, 2088599219,
+  2090645130, 2092655920, 2094631514, 2096571837, 2098476817, 2100346380, 2102180458, 2103978980,
+  2105741878, 2107469087, 2109160541, 2110816176, 2112435930, 2114019741, 2115567550, 2117079299,
+  2118554930, 2119994388, 2121397619, 2122764569, 2124095188, 2125389424, 2126647229, 2127868555,
+  2129053357, 2130201590, 2131313211, 2132388177, 2133426448, 2134427984, 2135392749, 2136320706,
+  2137211819, 2138066055, 2138883382, 2139663768, 2140407186, 2141113606, 2141783002, 2142415348,
+  2143010621, 2143568798, 2144089859, 2144573783, 2145020552, 2145430150, 2145802561, 2146137771,
+  2146435767, 2146696538, 2146920075, 2147106368, 2147255411, 2147367199, 2147441726, 2147478990,
+};
+
+const q31_t hamming_2048_q31[1024] = {
+  171798692, 171803345, 171817306, 171840573, 171873147, 171915028, 171966214, 172026706,
+  172096502, 172175603, 172264007, 172361714, 172468723, 172585033, 172710642, 172845549,
+  172989754, 173143255, 173306049, 173478137, 173659516, 173850184, 174050141, 174259383,
+  174477908, 174705716, 174942803, 175189168, 175444808, 175709720, 175983903, 176267353,
+  176560068, 176862046, 177173282, 177493775, 177823522, 178162519, 178510762, 178868250,
+  179234978, 179610943, 179996142, 180390570, 180794224, 181207101, 181629196, 182060505,
+  182501025, 182950751, 183409679, 183877805, 184355124, 184841631, 185337323, 185842194,
+  186356240, 186879456, 187411837, 187953377, 188504073, 189063918, 189632908, 190211036,
+  190798298, 191394688, 192000201, 192614830, 193238570, 193871416, 194513360, 195164397,
+  195824521, 196493726, 197172006, 197859353, 198555762, 199261225, 199975737, 200699291,
+  201431879, 202173495, 202924132, 203683783, 204452441, 205230097, 206016746, 206812380,
+  207616990, 208430571, 209253113, 210084609, 210925052, 211774433, 212632744, 213499978,
+  214376126, 215261180, 216155131, 217057971, 217969692, 218890286, 219819742, 220758053,
+  221705210, 222661204, 223626025, 224599665, 225582115, 226573365, 227573406, 228582229,
+  229599824, 230626181, 231661291, 232705144, 233757730, 234819039, 235889062, 236967788,
+  238055207, 239151309, 240256083, 241369519, 242491607, 243622336, 244761695, 245909674,
+  247066262, 248231447, 249405220, 250587568, 251778481, 252977948, 254185956, 255402496,
+  256627555, 257861122, 259103184, 260353732, 261612752, 262880233, 264156163, 265440530,
+  266733321, 268034525, 269344130, 270662122, 271988490, 273323221, 274666303, 276017722,
+  277377467, 278745524, 280121880, 281506523, 282899440, 284300616, 285710040, 287127697,
+  288553575, 289987660, 291429939, 292880397, 294339022, 295805799, 297280715, 298763755,
+  300254907, 301754155, 303261486, 304776885, 306300339, 307831832, 309371351, 310918880,
+  312474406, 314037914, 315609388, 317188815, 318776179, 320371465, 321974658, 323585743,
+  325204706, 326831530, 328466201, 330108702, 331759019, 333417136, 335083037, 336756707,
+  338438130, 340127290, 341824171, 343528757, 345241032, 346960980, 348688585, 350423830,
+  352166700, 353917177, 355675245, 357440888, 359214089, 360994831, 362783098, 364578872,
+  366382137, 368192876, 370011072, 371836707, 373669764, 375510227, 377358077, 379213298,
+  381075871, 382945780, 384823006, 386707533, 388599342, 390498415, 392404735, 394318283,
+  396239042, 398166993, 400102119, 402044401, 403993820, 405950359, 407913999, 409884721,
+  411862507, 413847338, 415839196, 417838062, 419843917, 421856742, 423876517, 425903225,
+  427936846, 429977361, 432024750, 434078995, 436140075, 438207972, 440282666, 442364138,
+  444452367, 446547335, 448649021, 450757406, 452872470, 454994192, 457122554, 459257534,
+  461399113, 463547270, 465701986, 467863240, 470031011, 472205280, 474386025, 476573227,
+  478766864, 480966916, 483173362, 485386182, 487605354, 489830858, 492062672, 494300776,
+  496545149, 498795769, 501052615, 503315667, 505584902, 507860299, 510141837, 512429494,
+  514723249, 517023080, 519328966, 521640884, 523958813, 526282732, 528612617, 530948448,
+  533290203, 535637858, 537991393, 540350784, 542716010, 545087049, 547463878, 549846474,
+  552234816, 554628880, 557028644, 559434086, 561845183, 564261912, 566684251, 569112176,
+  571545665, 573984694, 576429242, 578879284, 581334798, 583795760, 586262148, 588733938,
+  591211107, 593693631, 596181488, 598674653, 601173103, 603676815, 606185765, 608699930,
+  611219285, 613743807, 616273473, 618808257, 621348138, 623893090, 626443089, 628998112,
+  631558135, 634123132, 636693082, 639267958, 641847736, 644432394, 647021905, 649616246,
+  652215392, 654819319, 657428003, 660041418, 662659539, 665282344, 667909806, 670541900,
+  673178603, 675819889, 678465734, 681116112, 683770998, 686430368, 689094196, 691762458,
+  694435127, 697112180, 699793590, 702479333, 705169383, 707863715, 710562304, 713265123,
+  715972148, 718683353, 721398713, 724118201, 726841793, 729569462, 732301184, 735036931,
+  737776680, 740520402, 743268074, 746019668, 748775159, 751534522, 754297729, 757064755,
+  759835575, 762610161, 765388487, 768170529, 770956258, 773745650, 776538677, 779335313,
+  782135533, 784939310, 787746616, 790557427, 793371715, 796189454, 799010617, 801835177,
+  804663109, 807494385, 810328979, 813166865, 816008014, 818852401, 821699999, 824550781,
+  827404720, 830261789, 833121961, 835985210, 838851507, 841720828, 844593143, 847468427,
+  850346652, 853227791, 856111817, 858998703, 861888421, 864780945, 867676247, 870574299,
+  873475075, 876378547, 879284687, 882193470, 885104866, 888018848, 890935390, 893854464,
+  896776041, 899700095, 902626599, 905555523, 908486842, 911420527, 914356550, 917294885,
+  920235503, 923178376, 926123477, 929070778, 932020252, 934971870, 937925605, 940881429,
+  943839314, 946799232, 949761155, 952725056, 955690907, 958658678, 961628344, 964599875,
+  967573243, 970548422, 973525381, 976504094, 979484533, 982466669, 985450474, 988435921,
+  991422980, 994411625, 997401826, 1000393555, 1003386785, 1006381487, 1009377634, 1012375195,
+  1015374145, 1018374453, 1021376093, 1024379035, 1027383251, 1030388714, 1033395394, 1036403264,
+  1039412295, 1042422459, 1045433727, 1048446071, 1051459462, 1054473873, 1057489275, 1060505639,
+  1063522937, 1066541141, 1069560222, 1072580152, 1075600902, 1078622443, 1081644748, 1084667788,
+  1087691534, 1090715959, 1093741032, 1096766726, 1099793013, 1102819864, 1105847250, 1108875142,
+  1111903514, 1114932334, 1117961576, 1120991211, 1124021210, 1127051545, 1130082186, 1133113106,
+  1136144276, 1139175668, 1142207252, 1145239000, 1148270884, 1151302876, 1154334945, 1157367065,
+  1160399206, 1163431340, 1166463439, 1169495473, 1172527414, 1175559234, 1178590904, 1181622395,
+  1184653679, 1187684728, 1190715512, 1193746004, 1196776174, 1199805995, 1202835437, 1205864472,
+  1208893071, 1211921207, 1214948850, 1217975972, 1221002544, 1224028538, 1227053925, 1230078678,
+  1233102766, 1236126163, 1239148839, 1242170766, 1245191915, 1248212259, 1251231767, 1254250413,
+  1257268168, 1260285003, 1263300889, 1266315799, 1269329704, 1272342575, 1275354385, 1278365104,
+  1281374705, 1284383159, 1287390438, 1290396513, 1293401356, 1296404939, 1299407233, 1302408211,
+  1305407843, 1308406102, 1311402959, 1314398387, 1317392357, 1320384840, 1323375809, 1326365235,
+  1329353091, 1332339347, 1335323976, 1338306951, 1341288241, 1344267821, 1347245661, 1350221733,
+  1353196010, 1356168463, 1359139065, 1362107787, 1365074602, 1368039481, 1371002396, 1373963321,
+  1376922226, 1379879083, 1382833866, 1385786546, 1388737096, 1391685487, 1394631691, 1397575682,
+  1400517431, 1403456911, 1406394093, 1409328951, 1412261456, 1415191581, 1418119299, 1421044581,
+  1423967400, 1426887729, 1429805540, 1432720806, 1435633499, 1438543591, 1441451056, 1444355866,
+  1447257993, 1450157411, 1453054091, 1455948007, 1458839131, 1461727437, 1464612896, 1467495482,
+  1470375167, 1473251925, 1476125728, 1478996550, 1481864362, 1484729139, 1487590853, 1490449477,
+  1493304984, 1496157348, 1499006541, 1501852537, 1504695308, 1507534829, 1510371072, 1513204010,
+  1516033618, 1518859867, 1521682732, 1524502187, 1527318203, 1530130756, 1532939818, 1535745363,
+  1538547364, 1541345796, 1544140631, 1546931843, 1549719407, 1552503296, 1555283483, 1558059943,
+  1560832649, 1563601575, 1566366695, 1569127983, 1571885413, 1574638959, 1577388595, 1580134295,
+  1582876034, 1585613785, 1588347523, 1591077222, 1593802855, 1596524399, 1599241826, 1601955111,
+  1604664230, 1607369155, 1610069862, 1612766325, 1615458520, 1618146419, 1620829999, 1623509234,
+  1626184098, 1628854567, 1631520615, 1634182217, 1636839348, 1639491983, 1642140098, 1644783666,
+  1647422664, 1650057066, 1652686847, 1655311983, 1657932449, 1660548221, 1663159273, 1665765581,
+  1668367121, 1670963868, 1673555797, 1676142884, 1678725105, 1681302436, 1683874851, 1686442328,
+  1689004841, 1691562367, 1694114881, 1696662360, 1699204779, 1701742114, 1704274343, 1706801439,
+  1709323381, 1711840144, 1714351704, 1716858038, 1719359122, 1721854933, 1724345446, 1726830640,
+  1729310489, 1731784971, 1734254063, 1736717741, 1739175982, 1741628763, 1744076061, 1746517852,
+  1748954115, 1751384824, 1753809959, 1756229496, 1758643412, 1761051684, 1763454290, 1765851207,
+  1768242413, 1770627885, 1773007600, 1775381536, 1777749672, 1780111983, 1782468449, 1784819047,
+  1787163754, 1789502550, 1791835411, 1794162316, 1796483242, 1798798169, 1801107074, 1803409935,
+  1805706730, 1807997439, 1810282040, 1812560510, 1814832828, 1817098974, 1819358926, 1821612661,
+  1823860160, 1826101401, 1828336363, 1830565025, 1832787366, 1835003364, 1837213000, 1839416252,
+  1841613099, 1843803521, 1845987497, 1848165006, 1850336029, 1852500544, 1854658531, 1856809970,
+  1858954841, 1861093123, 1863224797, 1865349841, 1867468237, 1869579963, 1871685001, 1873783331,
+  1875874932, 1877959785, 1880037870, 1882109168, 1884173659, 1886231324, 1888282143, 1890326098,
+  1892363168, 1894393335, 1896416579, 1898432882, 1900442224, 1902444586, 1904439950, 1906428297,
+  1908409609, 1910383865, 1912351048, 1914311140, 1916264122, 1918209974, 1920148680, 1922080221,
+  1924004578, 1925921734, 1927831671, 1929734369, 1931629813, 1933517982, 1935398861, 1937272431,
+  1939138674, 1940997574, 1942849111, 1944693270, 1946530032, 1948359380, 1950181298, 1951995767,
+  1953802771, 1955602293, 1957394316, 1959178822, 1960955796, 1962725220, 1964487078, 1966241352,
+  1967988028, 1969727087, 1971458514, 1973182293, 1974898406, 1976606839, 1978307574, 1980000597,
+  1981685890, 1983363438, 1985033226, 1986695237, 1988349456, 1989995867, 1991634455, 1993265204,
+  1994888100, 1996503125, 1998110267, 1999709508, 2001300835, 2002884232, 2004459685, 2006027177,
+  2007586696, 2009138226, 2010681752, 2012217259, 2013744735, 2015264163, 2016775530, 2018278821,
+  2019774023, 2021261120, 2022740100, 2024210949, 2025673651, 2027128194, 2028574564, 2030012748,
+  2031442731, 2032864500, 2034278043, 2035683344, 2037080392, 2038469174, 2039849675, 2041221883,
+  2042585786, 2043941369, 2045288621, 2046627529, 2047958081, 2049280262, 2050594062, 2051899468,
+  2053196467, 2054485048, 2055765198, 2057036905, 2058300157, 2059554942, 2060801249, 2062039065,
+  2063268379, 2064489180, 2065701455, 2066905194, 2068100386, 2069287018, 2070465079, 2071634560,
+  2072795448, 2073947732, 2075091403, 2076226448, 2077352858, 2078470621, 2079579728, 2080680167,
+  2081771929, 2082855002, 2083929378, 2084995045, 2086051995, 2087100215, 2088139698, 2089170433,
+  2090192410, 2091205620, 2092210053, 2093205700, 2094192551, 2095170597, 2096139829, 2097100238,
+  2098051814, 2098994549, 2099928434, 2100853460, 2101769618, 2102676900, 2103575297, 2104464800,
+  2105345402, 2106217094, 2107079868, 2107933715, 2108778628, 2109614598, 2110441618, 2111259680,
+  2112068777, 2112868900, 2113660042, 2114442196, 2115215354, 2115979509, 2116734654, 2117480781,
+  2118217884, 2118945956, 2119664989, 2120374978, 2121075915, 2121767794, 2122450608, 2123124351,
+  2123789016, 2124444598, 2125091089, 2125728485, 2126356778, 2126975964, 2127586035, 2128186987,
+  2128778814, 2129361510, 2129935070, 2130499488, 2131054759, 2131600878, 2132137839, 2132665638,
+  2133184270, 2133693729, 2134194011, 2134685111, 2135167025, 2135639748, 2136103275, 2136557602,
+  2137002726, 2137438641, 2137865344, 2138282830, 2138691096, 2139090138, 2139479952, 2139860534,
+  2140231881, 2140593989, 2140946855, 2141290476, 2141624848, 2141949968, 2142265833, 2142572441,
+  2142869787, 2143157870, 2143436687, 2143706235, 2143966511, 2144217514, 2144459240, 2144691688,
+  2144914855, 2145128739, 2145333338, 2145528651, 2145714675, 2145891408, 2146058850, 2146216998,
+  2146365850, 2146505407, 2146635665, 2146756624, 2146868284, 2146970642, 2147063697, 2147147450,
+  2147221899, 2147287043, 2147342882, 2147389416, 2147426643, 2147454564, 2147473178, 2147482485,
+};
+
+const q31_t sine_4096_q31[1025] = {
+  0, 3294197, 6588387, 9882561, 13176712, 16470832, 19764913, 23058947,
+  26352928, 29646846, 32940695, 36234466, 39528151, 42821744, 46115236, 49408620,
+  52701887, 55995030, 59288042, 62580914, 65873638, 69166208, 72458615, 75750851,
+  79042909, 82334782, 85626460, 88917937, 92209205, 95500255, 98791081, 102081675,
+  105372028, 108662134, 111951983, 115241570, 118530885, 121819921, 125108670, 128397125,
+  131685278, 134973122, 138260647, 141547847, 144834714, 148121241, 151407418, 154693240,
+  157978697, 161263783, 164548489, 167832808, 171116733, 174400254, 177683365, 180966058,
+  184248325, 187530159, 190811551, 194092495, 197372981, 200653003, 203932553, 207211624,
+  210490206, 213768293, 217045878, 220322951, 223599506, 226875535, 230151030, 233425984,
+  236700388, 239974235, 243247518, 246520228, 249792358, 253063900, 256334847, 259605191,
+  262874923, 266144038, 269412525, 272680379, 275947592, 279214155, 282480061, 285745302,
+  289009871, 292273760, 295536961, 298799466, 302061269, 305322361, 308582734, 311842381,
+  315101295, 318359466, 321616889, 324873555, 328129457, 331384586, 334638936, 337892498,
+  341145265, 344397230, 347648383, 350898719, 354148230, 357396906, 360644742, 363891730,
+  367137861, 370383128, 373627523, 376871039, 380113669, 383355404, 386596237, 389836160,
+  393075166, 396313247, 399550396, 402786604, 406021865, 409256170, 412489512, 415721883,
+  418953276, 422183684, 425413098, 428641511, 431868915, 435095303, 438320667, 441545000,
+  444768294, 447990541, 451211734, 454431865, 457650927, 460868912, 464085813, 467301622,
+  470516330, 473729932, 476942419, 480153784, 483364019, 486573117, 489781069, 492987869,
+  496193509, 499397982, 502601279, 505803394, 509004318, 512204045, 515402566, 518599875,
+  521795963, 524990824, 528184449, 531376831, 534567963, 537757837, 540946445, 544133781,
+  547319836, 550504604, 553688076, 556870245, 560051104, 563230645, 566408860, 569585743,
+  572761285, 575935480, 579108320, 582279796, 585449903, 588618632, 591785976, 594951927,
+  598116479, 601279623, 604441352, 607601658, 610760536, 613917975, 617073971, 620228514,
+  623381598, 626533215, 629683357, 632832018, 635979190, 639124865, 642269036, 645411696,
+  648552838, 651692453, 654830535, 657967075, 661102068, 664235505, 667367379, 670497682,
+  673626408, 676753549, 679879097, 683003045, 686125387, 689246113, 692365218, 695482694,
+  698598533, 701712728, 704825272, 707936158, 711045377, 714152924, 717258790, 720362968,
+  723465451, 726566232, 729665303, 732762657, 735858287, 738952186, 742044345, 745134758,
+  748223418, 751310318, 754395449, 757478806, 760560380, 763640164, 766718151, 769794334,
+  772868706, 775941259, 779011986, 782080880, 785147934, 788213141, 791276492, 794337982,
+  797397602, 800455346, 803511207, 806565177, 809617249, 812667415, 815715670, 818762005,
+  821806413, 824848888, 827889422, 830928007, 833964638, 836999305, 840032004, 843062726,
+  846091463, 849118210, 852142959, 855165703, 858186435, 861205147, 864221832, 867236484,
+  870249095, 873259659, 876268167, 879274614, 882278992, 885281293, 888281512, 891279640,
+  894275671, 897269597, 900261413, 903251110, 906238681, 909224120, 912207419, 915188572,
+  918167572, 921144411, 924119082, 927091579, 930061894, 933030021, 935995952, 938959681,
+  941921200, 944880503, 947837582, 950792431, 953745043, 956695411, 959643527, 962589385,
+  965532978, 968474300, 971413342, 974350098, 977284562, 980216726, 983146583, 986074127,
+  988999351, 991922248, 994842810, 997761031, 1000676905, 1003590424, 1006501581, 1009410370,
+  1012316784, 1015220816, 1018122458, 1021021705, 1023918550, 1026812985, 1029705004, 1032594600,
+  1035481766, 1038366495, 1041248781, 1044128617, 1047005996, 1049880912, 1052753357, 1055623324,
+  1058490808, 1061355801, 1064218296, 1067078288, 1069935768, 1072790730, 1075643169, 1078493076,
+  1081340445, 1084185270, 1087027544, 1089867259, 1092704411, 1095538991, 1098370993, 1101200410,
+  1104027237, 1106851465, 1109673089, 1112492101, 1115308496, 1118122267, 1120933406, 1123741908,
+  1126547765, 1129350972, 1132151521, 1134949406, 1137744621, 1140537158, 1143327011, 1146114174,
+  1148898640, 1151680403, 1154459456, 1157235792, 1160009405, 1162780288, 1165548435, 1168313840,
+  1171076495, 1173836395, 1176593533, 1179347902, 1182099496, 1184848308, 1187594332, 1190337562,
+  1193077991, 1195815612, 1198550419, 1201282407, 1204011567, 1206737894, 1209461382, 1212182024,
+  1214899813, 1217614743, 1220326809, 1223036002, 1225742318, 1228445750, 1231146291, 1233843935,
+  1236538675, 1239230506, 1241919421, 1244605414, 1247288478, 1249968606, 1252645794, 1255320034,
+  1257991320, 1260659646, 1263325005, 1265987392, 1268646800, 1271303222, 1273956653, 1276607086,
+  1279254516, 1281898935, 1284540337, 1287178717, 1289814068, 1292446384, 1295075659, 1297701886,
+  1300325060, 1302945174, 1305562222, 1308176198, 1310787095, 1313394909, 1315999631, 1318601257,
+  1321199781, 1323795195, 1326387494, 1328976672, 1331562723, 1334145641, 1336725419, 1339302052,
+  1341875533, 1344445857, 1347013017, 1349577007, 1352137822, 1354695455, 1357249901, 1359801152,
+  1362349204, 1364894050, 1367435685, 1369974101, 1372509294, 1375041258, 1377569986, 1380095472,
+  1382617710, 1385136696, 1387652422, 1390164882, 1392674072, 1395179984, 1397682613, 1400181954,
+  1402678000, 1405170745, 1407660183, 1410146309, 1412629117, 1415108601, 1417584755, 1420057574,
+  1422527051, 1424993180, 1427455956, 1429915374, 1432371426, 1434824109, 1437273414, 1439719338,
+  1442161874, 1444601017, 1447036760, 1449469098, 1451898025, 1454323536, 1456745625, 1459164286,
+  1461579514, 1463991302, 1466399645, 1468804538, 1471205974, 1473603949, 1475998456, 1478389489,
+  1480777044, 1483161115, 1485541696, 1487918781, 1490292364, 1492662441, 1495029006, 1497392053,
+  1499751576, 1502107570, 1504460029, 1506808949, 1509154322, 1511496145, 1513834411, 1516169114,
+  1518500250, 1520827813, 1523151797, 1525472197, 1527789007, 1530102222, 1532411837, 1534717846,
+  1537020244, 1539319024, 1541614183, 1543905714, 1546193612, 1548477872, 1550758488, 1553035455,
+  1555308768, 1557578421, 1559844408, 1562106725, 1564365367, 1566620327, 1568871601, 1571119183,
+  1573363068, 1575603251, 1577839726, 1580072489, 1582301533, 1584526854, 1586748447, 1588966306,
+  1591180426, 1593390801, 1595597428, 1597800299, 1599999411, 1602194758, 1604386335, 1606574136,
+  1608758157, 1610938393, 1613114838, 1615287487, 1617456335, 1619621377, 1621782608, 1623940023,
+  1626093616, 1628243383, 1630389319, 1632531418, 1634669676, 1636804087, 1638934646, 1641061349,
+  1643184191, 1645303166, 1647418269, 1649529496, 1651636841, 1653740300, 1655839867, 1657935539,
+  1660027308, 1662115172, 1664199124, 1666279161, 1668355276, 1670427466, 1672495725, 1674560049,
+  1676620432, 1678676870, 1680729357, 1682777890, 1684822463, 1686863072, 1688899711, 1690932376,
+  1692961062, 1694985765, 1697006479, 1699023199, 1701035922, 1703044642, 1705049355, 1707050055,
+  1709046739, 1711039401, 1713028037, 1715012642, 1716993211, 1718969740, 1720942225, 1722910659,
+  1724875040, 1726835361, 1728791620, 1730743810, 1732691928, 1734635968, 1736575927, 1738511799,
+  1740443581, 1742371267, 1744294853, 1746214334, 1748129707, 1750040966, 1751948107, 1753851126,
+  1755750017, 1757644777, 1759535401, 1761421885, 1763304224, 1765182414, 1767056450, 1768926328,
+  1770792044, 1772653593, 1774510970, 1776364172, 1778213194, 1780058032, 1781898681, 1783735137,
+  1785567396, 1787395453, 1789219305, 1791038946, 1792854372, 1794665580, 1796472565, 1798275323,
+  1800073849, 1801868139, 1803658189, 1805443995, 1807225553, 1809002858, 1810775906, 1812544694,
+  1814309216, 1816069469, 1817825449, 1819577151, 1821324572, 1823067707, 1824806552, 1826541103,
+  1828271356, 1829997307, 1831718951, 1833436286, 1835149306, 1836858008, 1838562388, 1840262441,
+  1841958164, 1843649553, 1845336604, 1847019312, 1848697674, 1850371686, 1852041343, 1853706643,
+  1855367581, 1857024153, 1858676355, 1860324183, 1861967634, 1863606704, 1865241388, 1866871683,
+  1868497586, 1870119091, 1871736196, 1873348897, 1874957189, 1876561070, 1878160535, 1879755580,
+  1881346202, 1882932397, 1884514161, 1886091491, 1887664383, 1889232832, 1890796837, 1892356392,
+  1893911494, 1895462140, 1897008325, 1898550047, 1900087301, 1901620084, 1903148392, 1904672222,
+  1906191570, 1907706433, 1909216806, 1910722688, 1912224073, 1913720958, 1915213340, 1916701216,
+  1918184581, 1919663432, 1921137767, 1922607581, 1924072871, 1925533633, 1926989864, 1928441561,
+  1929888720, 1931331338, 1932769411, 1934202936, 1935631910, 1937056329, 1938476190, 1939891490,
+  1941302225, 1942708392, 1944109987, 1945507008, 1946899451, 1948287312, 1949670589, 1951049279,
+  1952423377, 1953792881, 1955157788, 1956518093, 1957873796, 1959224890, 1960571375, 1961913246,
+  1963250501, 1964583136, 1965911148, 1967234535, 1968553292, 1969867417, 1971176906, 1972481757,
+  1973781967, 1975077532, 1976368450, 1977654717, 1978936331, 1980213288, 1981485585, 1982753220,
+  1984016189, 1985274489, 1986528118, 1987777073, 1989021350, 1990260946, 1991495860, 1992726087,
+  1993951625, 1995172471, 1996388622, 1997600076, 1998806829, 2000008879, 2001206222, 2002398857,
+  2003586779, 2004769987, 2005948478, 2007122248, 2008291295, 2009455617, 2010615210, 2011770073,
+  2012920201, 2014065592, 2015206245, 2016342155, 2017473321, 2018599739, 2019721407, 2020838323,
+  2021950484, 2023057887, 2024160529, 2025258408, 2026351522, 2027439867, 2028523442, 2029602243,
+  2030676269, 2031745516, 2032809982, 2033869665, 2034924562, 2035974670, 2037019988, 2038060512,
+  2039096241, 2040127172, 2041153301, 2042174628, 2043191150, 2044202863, 2045209767, 2046211857,
+  2047209133, 2048201592, 2049189231, 2050172048, 2051150040, 2052123207, 2053091544, 2054055050,
+  2055013723, 2055967560, 2056916560, 2057860719, 2058800036, 2059734508, 2060664133, 2061588910,
+  2062508835, 2063423908, 2064334124, 2065239484, 2066139983, 2067035621, 2067926394, 2068812302,
+  2069693342, 2070569511, 2071440808, 2072307231, 2073168777, 2074025446, 2074877233, 2075724139,
+  2076566160, 2077403294, 2078235540, 2079062896, 2079885360, 2080702930, 2081515603, 2082323379,
+  2083126254, 2083924228, 2084717298, 2085505463, 2086288720, 2087067068, 2087840505, 2088609029,
+  2089372638, 2090131331, 2090885105, 2091633960, 2092377892, 2093116901, 2093850985, 2094580142,
+  2095304370, 2096023667, 2096738032, 2097447464, 2098151960, 2098851519, 2099546139, 2100235819,
+  2100920556, 2101600350, 2102275199, 2102945101, 2103610054, 2104270057, 2104925109, 2105575208,
+  2106220352, 2106860540, 2107495770, 2108126041, 2108751352, 2109371700, 2109987085, 2110597505,
+  2111202959, 2111803444, 2112398960, 2112989506, 2113575080, 2114155680, 2114731305, 2115301954,
+  2115867626, 2116428319, 2116984031, 2117534762, 2118080511, 2118621275, 2119157054, 2119687847,
+  2120213651, 2120734467, 2121250292, 2121761126, 2122266967, 2122767814, 2123263666, 2123754522,
+  2124240380, 2124721240, 2125197100, 2125667960, 2126133817, 2126594672, 2127050522, 2127501367,
+  2127947206, 2128388038, 2128823862, 2129254676, 2129680480, 2130101272, 2130517052, 2130927819,
+  2131333572, 2131734309, 2132130030, 2132520734, 2132906420, 2133287087, 2133662734, 2134033361,
+  2134398966, 2134759548, 2135115107, 2135465642, 2135811153, 2136151637, 2136487095, 2136817525,
+  2137142927, 2137463301, 2137778644, 2138088958, 2138394240, 2138694490, 2138989708, 2139279892,
+  2139565043, 2139845159, 2140120240, 2140390284, 2140655293, 2140915264, 2141170197, 2141420092,
+  2141664948, 2141904764, 2142139541, 2142369276, 2142593971, 2142813624, 2143028234, 2143237802,
+  2143442326, 2143641807, 2143836244, 2144025635, 2144209982, 2144389283, 2144563539, 2144732748,
+  2144896910, 2145056025, 2145210092, 2145359112, 2145503083, 2145642006, 2145775880, 2145904705,
+  2146028480, 2146147205, 2146260881, 2146369505, 2146473080, 2146571603, 2146665076, 2146753497,
+  2146836866, 2146915184, 2146988450, 2147056664, 2147119825, 2147177934, 2147230991, 2147278995,
+  2147321946, 2147359845, 2147392690, 2147420483, 2147443222, 2147460908, 2147473542, 2147481121,
+  2147483647,
+};
+
+/**
+ * @brief return the const table holding the first half of a window, or NULL
+ */
+const void* find_const_window_table(int sample_type, FFTWindow window_type, int length)
+{
+  if (window_type != FFTWindow::Hamming) return NULL;
+
+  switch (sample_type) {
+    case SAMPLE_DOUBLE:
+      if (length == 1024) return hamming_1024_double;
+      if (length == 2048) return hamming_2048_double;
+      break;
+    case SAMPLE_FLOAT:
+      if (length == 1024) return hamming_1024_float;
+      if (length == 2048) return hamming_2048_float;
+      break;
+    case SAMPLE_Q15:
+      if (length == 1024) return hamming_1024_q15;
+      if (length == 2048) return hamming_2048_q15;
+      break;
+    case SAMPLE_Q31:
+      if (length == 1024) return hamming_1024_q31;
+      if (length == 2048) return hamming_2048_q31;
+      break;
+  }
+  return NULL;
+}
+
+/**
+ * @brief return the const quarter wave sine table (period CONST_SINE_PERIOD)
+ */
+const void* find_const_sine_table(int sample_type)
+{
+  switch (sample_type) {
+    case SAMPLE_DOUBLE: return sine_4096_double;
+    case SAMPLE_FLOAT: return sine_4096_float;
+    case SAMPLE_Q15: return sine_4096_q15;
+    case SAMPLE_Q31: return sine_4096_q31;
+  }
+  return NULL;
+}
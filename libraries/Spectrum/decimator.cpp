@@ -0,0 +1,119 @@
+/**
+ * decimator.cpp
+ * 
+ * C module performing polyphase FIR decimation of a sample stream
+ * 
+ * Author: Vincent Lacasse (lacasse4@yahoo.com)
+ * Date: 2026-10-18
+ * Target system: Arduino Due
+ * 
+ */
+
+/*
+ * Decimation by 'factor' keeps one output of a low pass filter out of 
+ * 'factor'.  The outputs that are dropped are never computed: the filter is 
+ * split in 'factor' phases and every input is only multiplied by the 
+ * DECIMATOR_TAPS/factor coefficients of its phase.  Each product is 
+ * accumulated in the partial sum of the output it belongs to (transposed 
+ * polyphase form), so no input history is kept.
+ *
+ * Input x[n], with n = q*factor + phase, contributes to the outputs 
+ * y[q + j], j in [0, DECIMATOR_TAPS/factor), with the coefficient 
+ * h[j*factor + factor-1 - phase].  y[q] is complete after the input of 
+ * phase factor-1.
+ *
+ * Coefficients are Q15 integers with unity DC gain: outputs have the scale 
+ * of the inputs.  Products are accumulated in 32 bits (12 bit ADC samples 
+ * cannot overflow).
+ */
+
+#include <stddef.h>
+#include "decimator.h"
+
+/*
+ * Low pass filters, generated by extras/gen_decimator.py
+ */
+// factor 2: passband 0-900 Hz, stopband from 1100 Hz (at 4000 Hz)
+static const int16_t lowpass_2[DECIMATOR_TAPS] = {
+  -4, -7, 9, 13, -17, -22, 28, 35, -43, -52, 63, 75,
+  -89, -105, 122, 142, -164, -190, 218, 250, -286, -326, 373, 426,
+  -487, -559, 644, 748, -876, -1041, 1261, 1573, -2056, -2913, 4895, 14746,
+  14746, 4895, -2913, -2056, 1573, 1261, -1041, -876, 748, 644, -559, -487,
+  426, 373, -326, -286, 250, 218, -190, -164, 142, 122, -105, -89,
+  75, 63, -52, -43, 35, 28, -22, -17, 13, 9, -7, -4,
+};
+
+// factor 4: passband 0-400 Hz, stopband from 600 Hz (at 4000 Hz)
+static const int16_t lowpass_4[DECIMATOR_TAPS] = {
+  2, 9, 12, 7, -9, -29, -37, -19, 23, 68, 82, 41,
+  -48, -137, -160, -77, 89, 248, 284, 135, -154, -426, -486, -230,
+  263, 730, 842, 405, -474, -1359, -1647, -851, 1112, 3805, 6393, 7977,
+  7977, 6393, 3805, 1112, -851, -1647, -1359, -474, 405, 842, 730, 263,
+  -230, -486, -426, -154, 135, 284, 248, 89, -77, -160, -137, -48,
+  41, 82, 68, 23, -19, -37, -29, -9, 7, 12, 9, 2,
+};
+
+/**
+ * @brief set the decimation factor and clear the filter state
+ * @param factor 1 (no decimation), 2 or 4
+ * @returns 1 if OK, 0 if factor is not supported
+ */
+int init_decimator(decimator_t* decimator, int factor)
+{
+  switch (factor) {
+    case 1: decimator->coefficients = NULL;      break;
+    case 2: decimator->coefficients = lowpass_2; break;
+    case 4: decimator->coefficients = lowpass_4; break;
+    default: return 0;
+  }
+
+  decimator->factor = factor;
+  reset_decimator(decimator);
+  return 1;
+}
+
+/**
+ * @brief clear the filter state
+ */
+void reset_decimator(decimator_t* decimator)
+{
+  decimator->phase = 0;
+  decimator->slot = 0;
+  for (int i = 0; i < DECIMATOR_SLOTS; i++) {
+    decimator->sum[i] = 0;
+  }
+}
+
+/**
+ * @brief feed one input sample to the decimator
+ * @param output set to the next output sample when one is ready
+ * @returns 1 if an output is ready, 0 otherwise
+ */
+int decimate(decimator_t* decimator, int sample, int* output)
+{
+  int factor = decimator->factor;
+
+  if (factor == 1) {
+    *output = sample;
+    return 1;
+  }
+
+  int slots = DECIMATOR_TAPS / factor;
+  const int16_t* h = decimator->coefficients + (factor - 1 - decimator->phase);
+  int slot = decimator->slot;
+
+  for (int j = 0; j < slots; j++) {
+    decimator->sum[slot] += (int32_t) h[j * factor] * sample;
+    if (++slot == slots) slot = 0;
+  }
+
+  if (++decimator->phase < factor) return 0;
+
+  // the current output is complete, its accumulator is reused for a future output
+  slot = decimator->slot;
+  *output = (decimator->sum[slot] + (1 << 14)) >> 15;
+  decimator->sum[slot] = 0;
+  decimator->slot = slot + 1 == slots ? 0 : slot + 1;
+  decimator->phase = 0;
+  return 1;
+}
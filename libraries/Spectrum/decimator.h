@@ -0,0 +1,32 @@
+/**
+ * decimator.h
+ * 
+ * C module performing polyphase FIR decimation of a sample stream
+ * 
+ * Author: Vincent Lacasse (lacasse4@yahoo.com)
+ * Date: 2026-10-18
+ * Target system: Arduino Due
+ * 
+ */
+
+#ifndef _DECIMATOR_H
+#define _DECIMATOR_H
+
+#include <stdint.h>
+
+#define DECIMATOR_TAPS    72                      // low pass filter length
+#define DECIMATOR_SLOTS   (DECIMATOR_TAPS / 2)    // pending outputs (smallest factor)
+
+typedef struct decimator {
+    int factor;                     // 1 (no decimation), 2 or 4
+    int phase;                      // index of the input within the current output
+    int slot;                       // accumulator of the current output
+    const int16_t* coefficients;    // Q15 low pass filter
+    int32_t sum[DECIMATOR_SLOTS];   // partial sums of the next DECIMATOR_TAPS/factor outputs
+} decimator_t;
+
+int init_decimator(decimator_t* decimator, int factor);
+void reset_decimator(decimator_t* decimator);
+int decimate(decimator_t* decimator, int sample, int* output);
+
+#endif
@@ -0,0 +1,118 @@
+/**
+ * due_adc.cpp
+ *
+ * Acquisition backend for the Arduino Due: timer triggered ADC conversions,
+ * transferred to the acquisition's blocks by the ADC's DMA (PDC)
+ *
+ * Author: Vincent Lacasse (lacasse4@yahoo.com)
+ * Date: 2026-10-18
+ * Target system: Arduino Due
+ *
+ */
+
+/*
+ * TC0 channel 0 runs in waveform mode at the sampling frequency and its
+ * TIOA0 output triggers the ADC (hardware trigger 1): conversions are
+ * started by the timer, without jitter, and no code runs per sample.
+ * The PDC writes every conversion result to the block being filled and
+ * switches by itself to the next block (RNPR/RNCR) at the end of a block.
+ * The ADC interrupt (ENDRX, once per block) then completes the block and
+ * gives the PDC the block after.  Samples are the raw 12 bit conversion
+ * results (analogRead() returns 10 bits by default).
+ *
+ * With several channels, each trigger converts every channel, in the
+ * order given to set_acquisition_channels(): the ADC's user sequence
+ * (ADC_SEQR1/2) maps sequence slot i to the i-th channel, so the PDC
+ * writes the channels interleaved.  The ADC needs about 1 us per
+ * conversion: channels * sampling frequency must stay under 1 MHz.
+ *
+ * TC0 channel 0 is DueTimer's Timer0: do not use both.  The ADC's other
+ * users (analogRead()) must not run during the acquisition.
+ */
+
+#if defined(ARDUINO_ARCH_SAM)
+
+#include <Arduino.h>
+#include "acquisition.h"
+
+#define ADC_TC          TC0
+#define ADC_TC_CHANNEL  0
+#define ADC_TC_ID       ID_TC0
+#define ADC_TC_CLOCK    (VARIANT_MCK / 2)   // TIMER_CLOCK1
+
+// only one ADC: the running acquisition, for the interrupt handler
+static acquisition_t* active = NULL;
+
+static int start_due_adc(acquisition_t* acquisition)
+{
+  int count = get_channel_count(acquisition);
+  uint32_t rc = (uint32_t) (ADC_TC_CLOCK / get_acquisition_frequency(acquisition) + 0.5);
+  uint32_t sequence[2] = { 0, 0 };
+
+  if (rc < 2) return 0;
+  for (int i = 0; i < count; i++) {
+    int channel = get_channel_at(acquisition, i);
+    if (channel < A0 || channel > A11) return 0;
+    sequence[i / 8] |= g_APinDescription[channel].ulADCChannelNumber << (4 * (i % 8));
+  }
+  active = acquisition;
+
+  // timer: TIOA0 is cleared on RA and set on RC, once per sampling period
+  pmc_enable_periph_clk(ADC_TC_ID);
+  TC_Configure(ADC_TC, ADC_TC_CHANNEL, TC_CMR_WAVE | TC_CMR_WAVSEL_UP_RC | TC_CMR_TCCLKS_TIMER_CLOCK1 |
+                                       TC_CMR_ACPA_CLEAR | TC_CMR_ACPC_SET);
+  TC_SetRC(ADC_TC, ADC_TC_CHANNEL, rc);
+  TC_SetRA(ADC_TC, ADC_TC_CHANNEL, rc / 2);
+
+  // ADC: the channels' sequence, converted on each TIOA0 rising edge
+  pmc_enable_periph_clk(ID_ADC);
+  ADC->ADC_MR = (ADC->ADC_MR & ~(ADC_MR_TRGSEL_Msk | ADC_MR_FREERUN)) | ADC_MR_TRGEN_EN | ADC_MR_TRGSEL_ADC_TRIG1 |
+                ADC_MR_USEQ;
+  ADC->ADC_SEQR1 = sequence[0];
+  ADC->ADC_SEQR2 = sequence[1];
+  ADC->ADC_CHDR = 0xFFFF;
+  ADC->ADC_CHER = (1 << count) - 1;      // sequence slots 0 to count-1
+
+  // PDC: the block being filled, then the next one
+  ADC->ADC_PTCR = ADC_PTCR_RXTDIS;
+  ADC->ADC_RPR = (uint32_t) get_filling_block(acquisition);
+  ADC->ADC_RCR = get_block_size(acquisition);
+  ADC->ADC_RNPR = (uint32_t) get_next_block(acquisition);
+  ADC->ADC_RNCR = get_block_size(acquisition);
+  ADC->ADC_PTCR = ADC_PTCR_RXTEN;
+
+  ADC->ADC_IDR = 0xFFFFFFFF;
+  ADC->ADC_IER = ADC_IER_ENDRX;
+  NVIC_ClearPendingIRQ(ADC_IRQn);
+  NVIC_SetPriority(ADC_IRQn, 0);
+  NVIC_EnableIRQ(ADC_IRQn);
+
+  TC_Start(ADC_TC, ADC_TC_CHANNEL);
+  return 1;
+}
+
+static void stop_due_adc(acquisition_t* acquisition)
+{
+  TC_Stop(ADC_TC, ADC_TC_CHANNEL);
+  NVIC_DisableIRQ(ADC_IRQn);
+  ADC->ADC_IDR = 0xFFFFFFFF;
+  ADC->ADC_PTCR = ADC_PTCR_RXTDIS;
+  ADC->ADC_MR &= ~(ADC_MR_TRGEN_EN | ADC_MR_USEQ);    // back to software triggers (analogRead())
+  active = NULL;
+}
+
+/**
+ * @brief end of a block: the PDC already fills the next one, give it the block after
+ */
+void ADC_Handler(void)
+{
+  if ((ADC->ADC_ISR & ADC_ISR_ENDRX) == 0 || active == NULL) return;
+
+  complete_block(active);
+  ADC->ADC_RNPR = (uint32_t) get_next_block(active);
+  ADC->ADC_RNCR = get_block_size(active);     // clears ENDRX
+}
+
+const acquisition_backend_t due_adc_backend = { "due_adc", start_due_adc, stop_due_adc, NULL };
+
+#endif
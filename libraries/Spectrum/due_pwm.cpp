@@ -0,0 +1,101 @@
+/**
+ * due_pwm.cpp
+ *
+ * Strobe backend for the Arduino Due: PWM channels 0 to 2 (PWMH0 to
+ * PWMH2, Due pins 35, 37 and 39) as synchronous channels
+ *
+ * Author: Vincent Lacasse (lacasse4@yahoo.com)
+ * Date: 2026-10-18
+ * Target system: Arduino Due
+ *
+ */
+
+/*
+ * The three channels are synchronous (PWM_SCM): they share channel 0's
+ * counter and period, so the red, green and blue LEDs flash together.
+ * Period and duties are written to the update registers (CPRDUPD,
+ * CDTYUPD), then unlocked all at once (PWM_SCUC.UPDULOCK): the hardware
+ * applies them together at the end of channel 0's period.  Its end of
+ * period interrupt (PWM_ISR1.CHID0) asks the strobe for the next values.
+ *
+ * The clock is MCK/64 (1.3125 MHz): 16 bit periods reach 20 Hz.
+ *
+ * pwm_lib's set_period_and_duty() writes the same update registers, but
+ * channel by channel, and its period in 1e-8 s is truncated to counts:
+ * do not use pwm_lib on these channels.
+ */
+
+#if defined(ARDUINO_ARCH_SAM)
+
+#include <Arduino.h>
+#include "strobe.h"
+
+#define STROBE_CHANNELS  3
+#define STROBE_PINS      (PIO_PC3B_PWMH0 | PIO_PC5B_PWMH1 | PIO_PC7B_PWMH2)
+
+// only one strobe: the running one, for the interrupt handler
+static strobe_t* active = NULL;
+
+static int start_due_pwm(strobe_t* strobe, uint32_t period, uint32_t duty)
+{
+  if (active != NULL) return 0;
+
+  pmc_enable_periph_clk(ID_PWM);
+  PWM->PWM_DIS = PWM_DIS_CHID0 | PWM_DIS_CHID1 | PWM_DIS_CHID2;
+  while (PWM->PWM_SR & (PWM_SR_CHID0 | PWM_SR_CHID1 | PWM_SR_CHID2)) { }
+
+  PIO_Configure(PIOC, PIO_PERIPH_B, STROBE_PINS, PIO_DEFAULT);
+
+  // left aligned, high for 'duty' counts, manual update of the synchronous channels
+  PWM->PWM_SCM = PWM_SCM_SYNC0 | PWM_SCM_SYNC1 | PWM_SCM_SYNC2 | PWM_SCM_UPDM_MODE0;
+  for (int channel = 0; channel < STROBE_CHANNELS; channel++) {
+    PWM->PWM_CH_NUM[channel].PWM_CMR = PWM_CMR_CPRE_MCK_DIV_64 | PWM_CMR_CPOL;
+    PWM->PWM_CH_NUM[channel].PWM_CPRD = period;
+    PWM->PWM_CH_NUM[channel].PWM_CDTY = duty;
+  }
+  active = strobe;
+
+  PWM->PWM_IDR1 = 0xFFFFFFFF;
+  PWM->PWM_ISR1;
+  PWM->PWM_IER1 = PWM_IER1_CHID0;
+  NVIC_ClearPendingIRQ(PWM_IRQn);
+  NVIC_SetPriority(PWM_IRQn, 1);
+  NVIC_EnableIRQ(PWM_IRQn);
+
+  PWM->PWM_ENA = PWM_ENA_CHID0;           // enables the synchronous channels
+  return 1;
+}
+
+static void stop_due_pwm(strobe_t* strobe)
+{
+  NVIC_DisableIRQ(PWM_IRQn);
+  PWM->PWM_IDR1 = PWM_IDR1_CHID0;
+  PWM->PWM_DIS = PWM_DIS_CHID0;
+  while (PWM->PWM_SR & PWM_SR_CHID0) { }
+  PWM->PWM_SCM = 0;
+  active = NULL;
+}
+
+static void update_due_pwm(strobe_t* strobe, uint32_t period, uint32_t duty)
+{
+  PWM->PWM_CH_NUM[0].PWM_CPRDUPD = period;
+  for (int channel = 0; channel < STROBE_CHANNELS; channel++) {
+    PWM->PWM_CH_NUM[channel].PWM_CDTYUPD = duty;
+  }
+  PWM->PWM_SCUC = PWM_SCUC_UPDULOCK;
+}
+
+/**
+ * @brief end of channel 0's period: the values written last are applied, give the next ones
+ */
+void PWM_Handler(void)
+{
+  if ((PWM->PWM_ISR1 & PWM_ISR1_CHID0) == 0 || active == NULL) return;
+
+  strobe_period_elapsed(active);
+}
+
+const strobe_backend_t due_pwm_backend = { "due_pwm", VARIANT_MCK / 64.0, 0xFFFF,
+                                           start_due_pwm, stop_due_pwm, update_due_pwm };
+
+#endif
@@ -0,0 +1,87 @@
+#!/usr/bin/env python3
+"""
+gen_decimator.py
+
+Designs the low pass filters of the decimator (decimator.cpp) and prints
+their Q15 coefficients as C arrays, with the frequency response on stderr.
+
+    python3 extras/gen_decimator.py
+
+Kaiser windowed sinc, DECIMATOR_TAPS taps, about 55 dB of stopband
+attenuation.  Frequencies are given for a 4000 Hz input.  The stopband
+starts where its aliases land above the passband, once decimated:
+
+    factor 2: passband 0-900 Hz, stopband from 1100 Hz (2000 Hz output)
+    factor 4: passband 0-400 Hz, stopband from 600 Hz  (1000 Hz output)
+
+Author: Vincent Lacasse (lacasse4@yahoo.com)
+Date: 2026-10-18
+"""
+
+import math
+import sys
+
+TAPS = 72               # must match DECIMATOR_TAPS in decimator.h
+BETA = 5.65             # Kaiser window shape (about 60 dB)
+FREQUENCY = 4000.0      # input sampling frequency of the design (Hz)
+
+FILTERS = [
+    # factor, passband edge, stopband edge (Hz)
+    (2, 900.0, 1100.0),
+    (4, 400.0, 600.0),
+]
+
+
+def bessel_i0(x):
+    total = 1.0
+    term = 1.0
+    k = 1
+    while term > 1e-12 * total:
+        term *= (x / (2 * k)) ** 2
+        total += term
+        k += 1
+    return total
+
+
+def design(cutoff):
+    """Q15 coefficients of a low pass filter, cutoff relative to the sampling frequency"""
+    values = []
+    for n in range(TAPS):
+        m = n - (TAPS - 1) / 2.0
+        sinc = 2 * cutoff if m == 0 else math.sin(2 * math.pi * cutoff * m) / (math.pi * m)
+        window = bessel_i0(BETA * math.sqrt(1 - (2.0 * n / (TAPS - 1) - 1) ** 2)) / bessel_i0(BETA)
+        values.append(sinc * window)
+
+    # unity DC gain, exactly
+    total = sum(values)
+    coefficients = [int(math.floor(v / total * 32768 + 0.5)) for v in values]
+    coefficients[TAPS // 2] += 32768 - sum(coefficients)
+    return coefficients
+
+
+def response_db(coefficients, frequency):
+    w = 2 * math.pi * frequency / FREQUENCY
+    re = sum(c * math.cos(w * n) for n, c in enumerate(coefficients))
+    im = sum(c * math.sin(w * n) for n, c in enumerate(coefficients))
+    return 20 * math.log10(max(1e-12, math.hypot(re, im) / 32768.0))
+
+
+def main():
+    for factor, passband, stopband in FILTERS:
+        coefficients = design((passband + stopband) / 2.0 / FREQUENCY)
+
+        ripple = max(abs(response_db(coefficients, f)) for f in range(0, int(passband) + 1, 5))
+        attenuation = max(response_db(coefficients, f) for f in range(int(stopband), int(FREQUENCY / 2) + 1, 5))
+        sys.stderr.write("factor %d: passband ripple %.3f dB, stopband %.1f dB\n" % (factor, ripple, attenuation))
+
+        print("// factor %d: passband 0-%.0f Hz, stopband from %.0f Hz (at %.0f Hz)"
+              % (factor, passband, stopband, FREQUENCY))
+        print("static const int16_t lowpass_%d[DECIMATOR_TAPS] = {" % factor)
+        for i in range(0, TAPS, 12):
+            print("  " + ", ".join("%d" % c for c in coefficients[i:i + 12]) + ",")
+        print("};")
+        print()
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,117 @@
+#!/usr/bin/env python3
+"""
+gen_tables.py
+
+Generates const_tables.cpp: const (flash) window and sine tables for the
+Spectrum library, so that the most used tables cost no RAM on the Due.
+
+    python3 extras/gen_tables.py > const_tables.cpp
+
+Values are computed exactly as tables.cpp computes them at run time.
+
+Author: Vincent Lacasse (lacasse4@yahoo.com)
+Date: 2026-10-18
+"""
+
+import math
+
+WINDOW_LENGTHS = [1024, 2048]   # Hamming windows (first half kept)
+SINE_PERIOD = 4096              # must match CONST_SINE_PERIOD in tables.h
+
+TYPES = [
+    # sample type, C type, suffix, formatter
+    ("SAMPLE_DOUBLE", "double", "double", lambda v: "%.17g" % v),
+    ("SAMPLE_FLOAT", "float", "float", lambda v: float_literal(v)),
+    ("SAMPLE_Q15", "q15_t", "q15", lambda v: "%d" % fixed(v, 15)),
+    ("SAMPLE_Q31", "q31_t", "q31", lambda v: "%d" % fixed(v, 31)),
+]
+
+
+def float_literal(value):
+    """C float literal: 0 must be written 0.0f, not 0f"""
+    text = "%.9g" % value
+    if "." not in text and "e" not in text:
+        text += ".0"
+    return text + "f"
+
+
+def fixed(value, frac):
+    """same as fixed_math::coefficient() in fft_core.h"""
+    scaled = math.floor(value * (1 << frac) + 0.5)
+    largest = (1 << frac) - 1
+    return max(-largest, min(largest, scaled))
+
+
+def hamming(index, length):
+    """same as window_weight() in window.cpp"""
+    twoPi = 6.28318531   # arduinoFFT constant
+    return 0.54 - (0.46 * math.cos(twoPi * (index / (length - 1.0))))
+
+
+def table(ctype, name, values, fmt):
+    lines = ["const %s %s[%d] = {" % (ctype, name, len(values))]
+    for i in range(0, len(values), 8):
+        lines.append("  " + ", ".join(fmt(v) for v in values[i:i + 8]) + ",")
+    lines.append("};")
+    return "\n".join(lines) + "\n"
+
+
+def main():
+    out = []
+    out.append("""/**
+ * const_tables.cpp
+ * 
+ * const (flash) window and sine tables of the Spectrum library
+ * Generated by extras/gen_tables.py, do not edit.
+ * 
+ * Author: Vincent Lacasse (lacasse4@yahoo.com)
+ * Date: 2026-10-18
+ * Target system: Arduino Due
+ * 
+ */
+
+#include <stddef.h>
+#include "tables.h"
+#include "spectrum.h"
+#include "fixed_fft.h"
+""")
+    for _, ctype, suffix, fmt in TYPES:
+        for length in WINDOW_LENGTHS:
+            values = [hamming(i, length) for i in range(length // 2)]
+            out.append(table(ctype, "hamming_%d_%s" % (length, suffix), values, fmt))
+        values = [math.sin(2.0 * math.pi * m / SINE_PERIOD) for m in range(SINE_PERIOD // 4 + 1)]
+        out.append(table(ctype, "sine_%d_%s" % (SINE_PERIOD, suffix), values, fmt))
+
+    out.append("""/**
+ * @brief return the const table holding the first half of a window, or NULL
+ */
+const void* find_const_window_table(int sample_type, FFTWindow window_type, int length)
+{
+  if (window_type != FFTWindow::Hamming) return NULL;
+
+  switch (sample_type) {""")
+    for stype, _, suffix, _ in TYPES:
+        out.append("    case %s:" % stype)
+        for length in WINDOW_LENGTHS:
+            out.append("      if (length == %d) return hamming_%d_%s;" % (length, length, suffix))
+        out.append("      break;")
+    out.append("""  }
+  return NULL;
+}
+
+/**
+ * @brief return the const quarter wave sine table (period CONST_SINE_PERIOD)
+ */
+const void* find_const_sine_table(int sample_type)
+{
+  switch (sample_type) {""")
+    for stype, _, suffix, _ in TYPES:
+        out.append("    case %s: return sine_%d_%s;" % (stype, SINE_PERIOD, suffix))
+    out.append("""  }
+  return NULL;
+}""")
+    print("\n".join(out))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,75 @@
+/**
+ * Arduino.h
+ *
+ * Minimal Arduino core shim used to build the Spectrum library on a
+ * Linux host. Only what Spectrum and arduinoFFT actually use is provided.
+ *
+ * Author: Vincent Lacasse (lacasse4@yahoo.com)
+ * Date: 2026-10-18
+ * Target system: Linux (host)
+ *
+ */
+
+#ifndef _HOST_ARDUINO_H
+#define _HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#ifndef sq
+#define sq(x) ((x)*(x))
+#endif
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+/**
+ * @brief microseconds elapsed since an arbitrary origin (monotonic clock)
+ */
+inline unsigned long micros()
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (unsigned long)(ts.tv_sec * 1000000UL + ts.tv_nsec / 1000);
+}
+
+/**
+ * @brief milliseconds elapsed since an arbitrary origin (monotonic clock)
+ */
+inline unsigned long millis()
+{
+  return micros() / 1000;
+}
+
+/**
+ * @brief analog input source
+ * @details the host has no ADC.  analogRead() returns the value produced by
+ * @details the function registered with set_analog_source(), or 0 if none.
+ */
+typedef int (*analog_source_t)(int channel);
+
+inline analog_source_t* analog_source()
+{
+  static analog_source_t source = NULL;
+  return &source;
+}
+
+inline void set_analog_source(analog_source_t source)
+{
+  *analog_source() = source;
+}
+
+inline int analogRead(int channel)
+{
+  analog_source_t source = *analog_source();
+  return source ? source(channel) : 0;
+}
+
+inline void noInterrupts() {}
+inline void interrupts() {}
+
+#endif
@@ -0,0 +1,253 @@
+/**
+ * bank_bench.cpp
+ *
+ * Host benchmark of the channel bank (channel_bank.h): 1 to 8 channels,
+ * each playing a Due/DAC recording, are interleaved as the Due's ADC
+ * would write them and acquired through the mock backend.
+ *
+ * Every channel count is run twice over the same samples:
+ *   separate  one signal per channel, own tables, compute_spectrum()
+ *   bank      a channel bank, shared tables, compute_bank_spectra()
+ * and the time per frame (all channels) and the pitches are compared.
+ *
+ * Author: Vincent Lacasse (lacasse4@yahoo.com)
+ * Date: 2026-10-18
+ * Target system: Linux (host)
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+#include <spectrum.h>
+#include <channel_bank.h>
+#include "dac_data.h"
+#include "heap.h"
+#include "mock_adc.h"
+
+#define SAMPLING_FREQUENCY  4000.0  // Hz
+#define SIGNAL_LENGTH       1024
+#define HOP                 256
+#define ADC_RESOLUTION      10
+#define MIN_FREQUENCY       40      // Hz
+#define MAX_FREQUENCY       900     // Hz
+#define CORRECT_CENTS       50.0
+
+typedef struct run {
+  long long spectrum_ns;       // compute_spectrum() or compute_bank_spectra(), all channels
+  long long frame_ns;          // the whole frame, all channels
+  int frames;
+  int correct;                 // channel frames within CORRECT_CENTS of the recording's pitch
+  double* pitch;               // frames * channels fundamental frequencies
+  size_t heap;                 // heap used by the signals
+} run_t;
+
+
+static int sample_type = SAMPLE_DOUBLE;
+static int twiddle_table = 0;
+static int real_fft = REAL_FFT_DISABLED;
+
+static long long now_ns()
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+/**
+ * @brief interleave the recordings (channel c plays recording c), resampled to the tuner
+ * @returns the number of samples per channel
+ */
+static long interleave(uint16_t** samples, int channels)
+{
+  double step = DAC_SAMPLING_FREQ / SAMPLING_FREQUENCY;
+  long length = (long) ((recordings[0].length - 1) / step);
+
+  for (int c = 1; c < channels; c++) {
+    long other = (long) ((recordings[c % DAC_RECORDINGS].length - 1) / step);
+    if (other < length) length = other;
+  }
+  length -= length % HOP;
+
+  *samples = (uint16_t*) malloc(length * channels * sizeof(uint16_t));
+  for (long i = 0; i < length; i++) {
+    for (int c = 0; c < channels; c++) {
+      (*samples)[i * channels + c] = resample_recording(&recordings[c % DAC_RECORDINGS], i * step, ADC_RESOLUTION);
+    }
+  }
+  return length;
+}
+
+static void score(run_t* run, int channel, peak_t* fundamental)
+{
+  const recording_t* rec = &recordings[channel % DAC_RECORDINGS];
+  double frequency = fundamental->index == -1 ? 0.0 : fundamental->frequency;
+
+  if (frequency > 0.0 && fabs(1200.0 * log2(frequency / rec->frequency)) < CORRECT_CENTS) {
+    run->correct++;
+  }
+}
+
+/**
+ * @brief one signal per channel, each with its own tables
+ */
+static void run_separate(const uint16_t* samples, long length, int channels, run_t* run)
+{
+  signal_t* signal[BANK_MAX_CHANNELS];
+  mock_adc_t* mock = create_mock_adc(samples, length * channels, MOCK_IMMEDIATE);
+  acquisition_t* acquisition = create_acquisition(&mock_adc_backend, mock, 0, SAMPLING_FREQUENCY,
+                                                  HOP * channels, ACQUISITION_MIN_DEPTH);
+  int pins[BANK_MAX_CHANNELS] = { 0 };
+  size_t heap = heap_in_use();
+
+  for (int c = 0; c < channels; c++) {
+    signal[c] = create_signal(SIGNAL_LENGTH, SAMPLING_FREQUENCY, ZERO_PADDING_ENABLED, sample_type, real_fft);
+    enable_twiddle_table(signal[c], twiddle_table);
+    enable_streaming(signal[c], HOP);
+  }
+  run->heap = heap_in_use() - heap;
+  set_acquisition_channels(acquisition, pins, channels);
+  start_acquisition(acquisition);
+
+  const uint16_t* block;
+  while ((block = get_block(acquisition)) != NULL) {
+    long long start = now_ns();
+    for (int i = 0; i < HOP * channels; i++) {
+      add_sample(signal[i % channels], block[i]);
+    }
+    release_block(acquisition);
+    if (!is_buffer_full(signal[0])) continue;
+
+    long long spectrum_ns = 0;
+    for (int c = 0; c < channels; c++) {
+      load_latest_frame(signal[c]);
+      remove_bias(signal[c]);
+      long long begin = now_ns();
+      compute_spectrum(signal[c]);
+      spectrum_ns += now_ns() - begin;
+      compute_peak_list(signal[c], MIN_FREQUENCY, MAX_FREQUENCY);
+    }
+    for (int c = 0; c < channels; c++) {
+      peak_t fundamental = find_fundamental_frequency(get_peak_list(signal[c]));
+      run->pitch[run->frames * channels + c] = fundamental.index == -1 ? 0.0 : fundamental.frequency;
+      score(run, c, &fundamental);
+    }
+    run->frame_ns += now_ns() - start;
+    run->spectrum_ns += spectrum_ns;
+    run->frames++;
+  }
+
+  for (int c = 0; c < channels; c++) delete_signal(signal[c]);
+  delete_acquisition(acquisition);
+  delete_mock_adc(mock);
+}
+
+/**
+ * @brief a channel bank: shared tables, batched FFT
+ */
+static void run_bank(const uint16_t* samples, long length, int channels, run_t* run)
+{
+  mock_adc_t* mock = create_mock_adc(samples, length * channels, MOCK_IMMEDIATE);
+  acquisition_t* acquisition = create_acquisition(&mock_adc_backend, mock, 0, SAMPLING_FREQUENCY,
+                                                  HOP * channels, ACQUISITION_MIN_DEPTH);
+  int pins[BANK_MAX_CHANNELS] = { 0 };
+  size_t heap = heap_in_use();
+
+  channel_bank_t* bank = create_channel_bank(channels, SIGNAL_LENGTH, SAMPLING_FREQUENCY,
+                                             ZERO_PADDING_ENABLED, sample_type, real_fft);
+  enable_bank_twiddle_table(bank, twiddle_table);
+  enable_bank_streaming(bank, HOP);
+  run->heap = heap_in_use() - heap;
+  set_acquisition_channels(acquisition, pins, channels);
+  start_acquisition(acquisition);
+
+  while (1) {
+    long long start = now_ns();
+    if (!acquire_bank_block(acquisition, bank)) break;
+    if (!is_bank_full(bank)) continue;
+
+    load_latest_frames(bank);
+    remove_bank_bias(bank);
+    long long begin = now_ns();
+    compute_bank_spectra(bank);
+    run->spectrum_ns += now_ns() - begin;
+    compute_bank_peak_lists(bank, MIN_FREQUENCY, MAX_FREQUENCY);
+
+    for (int c = 0; c < channels; c++) {
+      peak_t fundamental = find_fundamental_frequency(get_bank_peak_list(bank, c));
+      run->pitch[run->frames * channels + c] = fundamental.index == -1 ? 0.0 : fundamental.frequency;
+      score(run, c, &fundamental);
+    }
+    run->frame_ns += now_ns() - start;
+    run->frames++;
+  }
+
+  delete_channel_bank(bank);
+  delete_acquisition(acquisition);
+  delete_mock_adc(mock);
+}
+
+static void usage(const char* name)
+{
+  fprintf(stderr, "usage: %s [-t double|float|q15|q31] [-w] [-r]\n", name);
+  exit(1);
+}
+
+int main(int argc, char* argv[])
+{
+  int opt;
+
+  while ((opt = getopt(argc, argv, "t:wr")) != -1) {
+    switch (opt) {
+      case 't':
+        for (sample_type = SAMPLE_Q31; sample_type > SAMPLE_DOUBLE; sample_type--) {
+          if (strcmp(optarg, sample_type_name[sample_type]) == 0) break;
+        }
+        break;
+      case 'w': twiddle_table = 1; break;
+      case 'r': real_fft = REAL_FFT_ENABLED; break;
+      default: usage(argv[0]);
+    }
+  }
+
+  printf("Channel bank: %d %s samples at %.0f Hz per channel, hop %d, %s FFT, twiddle table %s\n\n",
+         SIGNAL_LENGTH, sample_type_name[sample_type], SAMPLING_FREQUENCY, HOP,
+         real_fft ? "real" : "complex", twiddle_table ? "on" : "off");
+  printf("%8s %6s | %12s %12s %9s | %12s %12s %9s | %7s %9s\n", "channels", "frames",
+         "separate fft", "frame us", "heap", "bank fft", "frame us", "heap", "speedup", "max diff");
+
+  for (int channels = 1; channels <= BANK_MAX_CHANNELS; channels++) {
+    uint16_t* samples;
+    long length = interleave(&samples, channels);
+    long frames = length / HOP;
+    run_t separate = { 0, 0, 0, 0, (double*) calloc(frames * channels, sizeof(double)), 0 };
+    run_t bank = { 0, 0, 0, 0, (double*) calloc(frames * channels, sizeof(double)), 0 };
+
+    run_separate(samples, length, channels, &separate);
+    run_bank(samples, length, channels, &bank);
+
+    double difference = 0.0;
+    for (long i = 0; i < separate.frames * channels; i++) {
+      double d = fabs(separate.pitch[i] - bank.pitch[i]);
+      if (d > difference) difference = d;
+    }
+
+    printf("%8d %6d | %12.1f %12.1f %9zu | %12.1f %12.1f %9zu | %6.2fx %8.3fHz\n",
+           channels, bank.frames,
+           separate.spectrum_ns * 1e-3 / separate.frames, separate.frame_ns * 1e-3 / separate.frames,
+           separate.heap,
+           bank.spectrum_ns * 1e-3 / bank.frames, bank.frame_ns * 1e-3 / bank.frames, bank.heap,
+           (double) separate.spectrum_ns / bank.spectrum_ns, difference);
+
+    if (separate.correct != bank.correct) {
+      printf("         correct frames differ: separate %d, bank %d\n", separate.correct, bank.correct);
+    }
+    free(separate.pitch);
+    free(bank.pitch);
+    free(samples);
+  }
+  return 0;
+}
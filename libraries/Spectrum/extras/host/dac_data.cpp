@@ -0,0 +1,42 @@
+/**
+ * dac_data.cpp
+ *
+ * Guitar string recordings used by the DAC sketch (Due/DAC), compiled
+ * once for the host tools.  Each array holds 100000 12 bit samples
+ * recorded at 10 kHz.
+ *
+ * Author: Vincent Lacasse (lacasse4@yahoo.com)
+ * Date: 2026-10-18
+ * Target system: Linux (host)
+ *
+ */
+
+#include <stdint.h>
+#include <math.h>
+#include "dac_data.h"
+
+#include "../../../../Due/DAC/E2.h"
+#include "../../../../Due/DAC/A2.h"
+#include "../../../../Due/DAC/D3.h"
+#include "../../../../Due/DAC/G3.h"
+#include "../../../../Due/DAC/B3.h"
+#include "../../../../Due/DAC/E4.h"
+
+const recording_t recordings[DAC_RECORDINGS] = {
+  { "E2",  82.41, data_e2, sizeof(data_e2) / sizeof(data_e2[0]) },
+  { "A2", 110.00, data_a2, sizeof(data_a2) / sizeof(data_a2[0]) },
+  { "D3", 146.83, data_d3, sizeof(data_d3) / sizeof(data_d3[0]) },
+  { "G3", 196.00, data_g3, sizeof(data_g3) / sizeof(data_g3[0]) },
+  { "B3", 246.94, data_b3, sizeof(data_b3) / sizeof(data_b3[0]) },
+  { "E4", 329.63, data_e4, sizeof(data_e4) / sizeof(data_e4[0]) },
+};
+
+const char* sample_type_name[4] = { "double", "float", "q15", "q31" };
+
+/**
+ * @brief the recording at (fractional) position 'at', scaled to an ADC of 'adc_bits'
+ */
+int resample_recording(const recording_t* rec, double at, int adc_bits)
+{
+  return (int) round(ldexp(interpolate(rec->data, at), adc_bits - DAC_RESOLUTION));
+}
@@ -0,0 +1,45 @@
+/**
+ * dac_data.h
+ *
+ * Guitar string recordings from Due/DAC, made available to the host tools
+ *
+ * Author: Vincent Lacasse (lacasse4@yahoo.com)
+ * Date: 2026-10-18
+ * Target system: Linux (host)
+ *
+ */
+
+#ifndef _DAC_DATA_H
+#define _DAC_DATA_H
+
+#include <stdint.h>
+
+#define DAC_RECORDINGS       6
+#define DAC_SAMPLING_FREQ    10000.0   // recordings sampling frequency (Hz)
+#define DAC_RESOLUTION       12        // recordings resolution (bits)
+
+typedef struct recording {
+  const char* note;       // note name (eg. "E2")
+  double frequency;       // expected fundamental frequency (Hz)
+  const uint16_t* data;   // samples
+  int length;             // number of samples
+} recording_t;
+
+extern const recording_t recordings[DAC_RECORDINGS];
+
+// names of the sample types, by SAMPLE_DOUBLE..SAMPLE_Q31 (spectrum.h)
+extern const char* sample_type_name[4];
+
+/**
+ * @brief data linearly interpolated at (fractional) position 'at'
+ */
+template <typename T>
+inline double interpolate(const T* data, double at)
+{
+  long k = (long) at;
+  return data[k] + (data[k+1] - data[k]) * (at - k);
+}
+
+int resample_recording(const recording_t* rec, double at, int adc_bits);
+
+#endif
@@ -0,0 +1,242 @@
+/**
+ * gate_bench.cpp
+ *
+ * Host benchmark of the pipeline gate (gate.h).  Every Due/DAC recording
+ * is played after silence (ADC noise), at 4 positions relative to the
+ * hop, and the tuner (1024 samples, hop 256, as AutoStrobe2) runs:
+ *   always   a frame every hop
+ *   gated    no frame while the gate is closed, a frame 'delay' samples
+ *            after an onset (schedule_frame())
+ * It reports the frames computed, the frames with a correct pitch after
+ * the pluck (the recordings start before it), the latency from the pluck
+ * to the first pitch (attack) and to the first correct pitch, and the
+ * pitches reported in silence.
+ *
+ * Author: Vincent Lacasse (lacasse4@yahoo.com)
+ * Date: 2026-10-18
+ * Target system: Linux (host)
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+#include <spectrum.h>
+#include <gate.h>
+#include "dac_data.h"
+
+#define SAMPLING_FREQUENCY  4000.0  // Hz
+#define SIGNAL_LENGTH       1024
+#define ADC_RESOLUTION      10
+#define MIN_FREQUENCY       40      // Hz
+#define MAX_FREQUENCY       900     // Hz
+#define CORRECT_CENTS       50.0
+#define SILENCE             4096    // samples of silence before a note
+#define PHASES              4       // note positions relative to the hop
+#define ATTACK_RATIO        0.5     // the pluck: first sample above this ratio of the peak amplitude
+
+typedef struct run {
+  int frames;                  // frames computed
+  int slots;                   // hops played
+  int silent_pitches;          // pitches reported before the note
+  int correct;                 // frames with a correct pitch
+  double attack_ms;            // sum of the latencies of the first pitches after the pluck
+  int attacks;                 // notes with a pitch
+  double latency_ms;           // sum of the latencies of the notes found
+  int found;                   // notes with a correct pitch
+  long long ns;                // processing time (gate and frames)
+} run_t;
+
+static int hop = 256;
+static int delay = SIGNAL_LENGTH / 4;
+static int noise = 2;
+
+static long long now_ns()
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+/**
+ * @brief silence (uniform noise of +/- 'noise' ADC units), then the recording
+ * @param attack set to the index of the pluck (the recordings start before it)
+ * @returns the number of samples
+ */
+static int compose(int** samples, const recording_t* rec, int silence, int* attack)
+{
+  double step = DAC_SAMPLING_FREQ / SAMPLING_FREQUENCY;
+  int length = (int) ((rec->length - 1) / step);
+  int bias = 1 << (ADC_RESOLUTION - 1);
+  unsigned int seed = 12345;
+
+  *samples = (int*) malloc((silence + length) * sizeof(int));
+  for (int i = 0; i < silence; i++) {
+    seed = seed * 1103515245 + 12345;
+    (*samples)[i] = bias + (int) ((seed >> 16) % (2 * noise + 1)) - noise;
+  }
+  for (int i = 0; i < length; i++) {
+    (*samples)[silence + i] = resample_recording(rec, i * step, ADC_RESOLUTION);
+  }
+
+  double mean = 0.0;
+  int peak = 0;
+  for (int i = silence; i < silence + length; i++) mean += (*samples)[i];
+  mean /= length;
+  for (int i = silence; i < silence + length; i++) {
+    if (fabs((*samples)[i] - mean) > peak) peak = (int) fabs((*samples)[i] - mean);
+  }
+  *attack = silence;
+  while (fabs((*samples)[*attack] - mean) < ATTACK_RATIO * peak) (*attack)++;
+
+  return silence + length;
+}
+
+static void play(const int* samples, int length, int silence, int attack, double expected, int gated,
+                 run_t* run)
+{
+  signal_t* signal = create_signal(SIGNAL_LENGTH, SAMPLING_FREQUENCY, ZERO_PADDING_ENABLED);
+  gate_t* gate = create_gate(ADC_RESOLUTION);
+  int found = 0;
+  int attacked = 0;
+
+  if (signal == NULL || gate == NULL || !enable_streaming(signal, hop)) {
+    fprintf(stderr, "out of memory\n");
+    exit(1);
+  }
+
+  for (int i = 0; i < length; i++) {
+    long long start = now_ns();
+    add_sample(signal, samples[i]);
+    if (gated) {
+      add_gate_sample(gate, samples[i]);
+      int onset = take_onset(gate);
+      if (onset >= 0) schedule_frame(signal, delay - onset);
+    }
+    if ((i + 1) % hop == 0) run->slots++;
+
+    if (!is_buffer_full(signal)) {
+      run->ns += now_ns() - start;
+      continue;
+    }
+    if (gated && !is_gate_open(gate)) {
+      schedule_frame(signal, hop);
+      run->ns += now_ns() - start;
+      continue;
+    }
+
+    load_latest_frame(signal);
+    remove_bias(signal);
+    compute_spectrum(signal);
+    compute_peak_list(signal, MIN_FREQUENCY, MAX_FREQUENCY);
+    peak_t pitch = find_fundamental_frequency(get_peak_list(signal));
+    run->ns += now_ns() - start;
+    run->frames++;
+
+    int sounding = pitch.index != -1 && pitch.frequency > 0.0;
+    int correct = sounding && fabs(1200.0 * log2(pitch.frequency / expected)) < CORRECT_CENTS;
+    double ms = 1000.0 * (i + 1 - attack) / SAMPLING_FREQUENCY;
+    if (i < silence) {
+      run->silent_pitches += sounding;
+    }
+    if (i < attack) continue;
+    run->correct += correct;
+    if (!attacked && sounding) {
+      attacked = 1;
+      run->attacks++;
+      run->attack_ms += ms;
+    }
+    if (!found && correct) {
+      found = 1;
+      run->found++;
+      run->latency_ms += ms;
+    }
+  }
+
+  delete_gate(gate);
+  delete_signal(signal);
+}
+
+static void print_run(const char* name, run_t* run)
+{
+  printf("  %-7s %6d %6d %6.1f%% %7d %7.0f %9.0f %6d/%d %7d %9.2f\n", name, run->frames, run->slots,
+         100.0 * run->frames / run->slots, run->correct,
+         run->attacks ? run->attack_ms / run->attacks : -1.0,
+         run->found ? run->latency_ms / run->found : -1.0,
+         run->found, PHASES, run->silent_pitches, run->ns * 1e-6);
+}
+
+static void usage(const char* name)
+{
+  fprintf(stderr, "usage: %s [-p hop] [-d onset_delay] [-n noise]\n", name);
+  exit(1);
+}
+
+int main(int argc, char* argv[])
+{
+  int opt;
+
+  while ((opt = getopt(argc, argv, "p:d:n:")) != -1) {
+    switch (opt) {
+      case 'p': hop = atoi(optarg); break;
+      case 'd': delay = atoi(optarg); break;
+      case 'n': noise = atoi(optarg); break;
+      default: usage(argv[0]);
+    }
+  }
+  if (hop <= 0 || hop > SIGNAL_LENGTH || delay < 0) usage(argv[0]);
+
+  printf("Gate: %d samples at %.0f Hz, hop %d, onset frame after %d samples, silence noise +/-%d\n",
+         SIGNAL_LENGTH, SAMPLING_FREQUENCY, hop, delay, noise);
+  printf("Every note is played %d times after %d to %d samples of silence\n\n", PHASES,
+         SILENCE, SILENCE + (PHASES - 1) * hop / PHASES);
+  printf("%-4s %-5s %6s %6s %7s %7s %7s %9s %8s %7s %9s\n", "note", "mode", "frames", "hops", "busy",
+         "correct", "attack", "latency", "found", "silent", "ms");
+
+  run_t total[2];
+  memset(total, 0, sizeof(total));
+
+  for (int r = 0; r < DAC_RECORDINGS; r++) {
+    run_t run[2];
+    memset(run, 0, sizeof(run));
+
+    for (int phase = 0; phase < PHASES; phase++) {
+      int silence = SILENCE + phase * hop / PHASES;
+      int* samples;
+      int attack;
+      int length = compose(&samples, &recordings[r], silence, &attack);
+
+      for (int gated = 0; gated < 2; gated++) {
+        play(samples, length, silence, attack, recordings[r].frequency, gated, &run[gated]);
+      }
+      free(samples);
+    }
+
+    printf("%s\n", recordings[r].note);
+    print_run("always", &run[0]);
+    print_run("gated", &run[1]);
+
+    for (int gated = 0; gated < 2; gated++) {
+      total[gated].frames += run[gated].frames;
+      total[gated].slots += run[gated].slots;
+      total[gated].silent_pitches += run[gated].silent_pitches;
+      total[gated].correct += run[gated].correct;
+      total[gated].attack_ms += run[gated].attack_ms;
+      total[gated].attacks += run[gated].attacks;
+      total[gated].latency_ms += run[gated].latency_ms;
+      total[gated].found += run[gated].found;
+      total[gated].ns += run[gated].ns;
+    }
+  }
+
+  printf("\n%-12s %8s %8s\n", "all", "always", "gated");
+  printf("%-12s %8d %8d\n", "frames", total[0].frames, total[1].frames);
+  printf("%-12s %8d %8d\n", "correct", total[0].correct, total[1].correct);
+  printf("%-12s %8.0f %8.0f\n", "attack ms", total[0].attack_ms / total[0].attacks,
+         total[1].attack_ms / total[1].attacks);
+  printf("%-12s %8.2f %8.2f\n", "time ms", total[0].ns * 1e-6, total[1].ns * 1e-6);
+  return 0;
+}
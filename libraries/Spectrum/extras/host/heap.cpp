@@ -0,0 +1,98 @@
+/**
+ * heap.cpp
+ *
+ * Heap usage accounting for the host tools (see heap.h)
+ *
+ * Author: Vincent Lacasse (lacasse4@yahoo.com)
+ * Date: 2026-10-18
+ * Target system: Linux (host)
+ *
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "heap.h"
+
+// every block is prefixed with its size; keeps 16 bytes alignment
+#define HEADER_SIZE 16
+
+extern "C" {
+void* __real_malloc(size_t size);
+void __real_free(void* ptr);
+void* __wrap_malloc(size_t size);
+void __wrap_free(void* ptr);
+void* __wrap_calloc(size_t n, size_t size);
+void* __wrap_realloc(void* ptr, size_t size);
+}
+
+static size_t in_use = 0;
+static size_t peak = 0;
+
+static void account(size_t size)
+{
+  size_t now = __atomic_add_fetch(&in_use, size, __ATOMIC_RELAXED);
+  size_t old = __atomic_load_n(&peak, __ATOMIC_RELAXED);
+  while (now > old &&
+         !__atomic_compare_exchange_n(&peak, &old, now, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+}
+
+void* __wrap_malloc(size_t size)
+{
+  char* block = (char*) __real_malloc(size + HEADER_SIZE);
+  if (block == NULL) return NULL;
+
+  *(size_t*) block = size;
+  account(size);
+  return block + HEADER_SIZE;
+}
+
+void __wrap_free(void* ptr)
+{
+  if (ptr == NULL) return;
+
+  char* block = (char*) ptr - HEADER_SIZE;
+  __atomic_sub_fetch(&in_use, *(size_t*) block, __ATOMIC_RELAXED);
+  __real_free(block);
+}
+
+void* __wrap_calloc(size_t n, size_t size)
+{
+  void* ptr = __wrap_malloc(n * size);
+  if (ptr != NULL) memset(ptr, 0, n * size);
+  return ptr;
+}
+
+void* __wrap_realloc(void* ptr, size_t size)
+{
+  void* resized = __wrap_malloc(size);
+  if (resized == NULL || ptr == NULL) return resized;
+
+  size_t old_size = *(size_t*) ((char*) ptr - HEADER_SIZE);
+  memcpy(resized, ptr, old_size < size ? old_size : size);
+  __wrap_free(ptr);
+  return resized;
+}
+
+/**
+ * @brief bytes currently allocated
+ */
+size_t heap_in_use()
+{
+  return __atomic_load_n(&in_use, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief highest number of bytes allocated since the last heap_reset_peak()
+ */
+size_t heap_peak()
+{
+  return __atomic_load_n(&peak, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief restart peak accounting from the current heap use
+ */
+void heap_reset_peak()
+{
+  __atomic_store_n(&peak, heap_in_use(), __ATOMIC_RELAXED);
+}
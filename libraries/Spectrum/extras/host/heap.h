@@ -0,0 +1,23 @@
+/**
+ * heap.h
+ *
+ * Heap usage accounting for the host tools.
+ * malloc(), calloc(), realloc() and free() are wrapped at link time
+ * (-Wl,--wrap=...) so every allocation made by the Spectrum library is seen.
+ *
+ * Author: Vincent Lacasse (lacasse4@yahoo.com)
+ * Date: 2026-10-18
+ * Target system: Linux (host)
+ *
+ */
+
+#ifndef _HEAP_H
+#define _HEAP_H
+
+#include <stddef.h>
+
+size_t heap_in_use();
+size_t heap_peak();
+void heap_reset_peak();
+
+#endif
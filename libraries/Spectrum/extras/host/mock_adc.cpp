@@ -0,0 +1,167 @@
+/**
+ * mock_adc.cpp
+ *
+ * Acquisition backend for the host: blocks are filled from an array of
+ * ADC values, or from a text file, instead of the Due's ADC (see mock_adc.h)
+ *
+ * Author: Vincent Lacasse (lacasse4@yahoo.com)
+ * Date: 2026-10-18
+ * Target system: Linux (host)
+ *
+ */
+
+/*
+ * The mock has no interrupt: blocks are completed when the loop polls the
+ * acquisition (get_block()).  MOCK_IMMEDIATE completes one block per poll,
+ * so a recording is replayed as fast as the loop can process it.
+ * MOCK_PACED completes every block whose last sample is due according to
+ * micros(): a loop slower than real time drops blocks as it would on the Due.
+ * The acquisition ends with the last complete block of the samples.
+ * With several channels, the samples are interleaved as the Due's ADC
+ * writes them (one sample of each channel per sampling period).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <Arduino.h>
+#include "mock_adc.h"
+
+struct mock_adc {
+    const uint16_t* samples;     // ADC values
+    uint16_t* buffer;            // samples loaded from a file (NULL for an array)
+    long length;                 // number of samples
+    long position;               // next sample to acquire
+    int pacing;                  // MOCK_IMMEDIATE or MOCK_PACED
+    unsigned long start_us;      // micros() at start (MOCK_PACED)
+};
+
+/**
+ * @brief create a mock ADC acquiring the values of an array
+ * @param samples ADC values, not copied: must outlive the mock
+ * @param pacing MOCK_IMMEDIATE or MOCK_PACED
+ */
+mock_adc_t* create_mock_adc(const uint16_t* samples, long length, int pacing)
+{
+  mock_adc_t* mock = (mock_adc_t*) malloc(sizeof(mock_adc_t));
+  if (mock == NULL) return NULL;
+
+  mock->samples = samples;
+  mock->buffer = NULL;
+  mock->length = length;
+  mock->position = 0;
+  mock->pacing = pacing;
+  mock->start_us = 0;
+  return mock;
+}
+
+/**
+ * @brief create a mock ADC acquiring the values of a text file
+ * @returns the mock, or NULL if the file cannot be read
+ * @details values are integers separated by spaces, commas or new lines
+ */
+mock_adc_t* load_mock_adc(const char* path, int pacing)
+{
+  FILE* file = fopen(path, "r");
+  long capacity = 4096;
+  long length = 0;
+  long value;
+  uint16_t* buffer = (uint16_t*) malloc(capacity * sizeof(uint16_t));
+
+  if (file == NULL || buffer == NULL) {
+    if (file != NULL) fclose(file);
+    free(buffer);
+    return NULL;
+  }
+
+  while (fscanf(file, " %ld ,", &value) == 1) {
+    if (length == capacity) {
+      capacity *= 2;
+      uint16_t* larger = (uint16_t*) realloc(buffer, capacity * sizeof(uint16_t));
+      if (larger == NULL) break;
+      buffer = larger;
+    }
+    buffer[length++] = (uint16_t) value;
+  }
+  fclose(file);
+
+  mock_adc_t* mock = create_mock_adc(buffer, length, pacing);
+  if (mock == NULL) {
+    free(buffer);
+    return NULL;
+  }
+  mock->buffer = buffer;
+  return mock;
+}
+
+/**
+ * @brief release mock resources
+ */
+void delete_mock_adc(mock_adc_t* mock)
+{
+  free(mock->buffer);
+  free(mock);
+}
+
+/**
+ * @brief getters
+ */
+long get_mock_length(mock_adc_t* mock)   { return mock->length; }
+long get_mock_position(mock_adc_t* mock) { return mock->position; }
+
+/**
+ * @brief return true once every complete block of the samples was acquired
+ */
+int is_mock_finished(mock_adc_t* mock)
+{
+  return mock->position >= mock->length;
+}
+
+static int start_mock_adc(acquisition_t* acquisition)
+{
+  mock_adc_t* mock = (mock_adc_t*) get_backend_context(acquisition);
+
+  if (mock == NULL) return 0;
+  mock->position = 0;
+  mock->start_us = micros();
+  return 1;
+}
+
+static void stop_mock_adc(acquisition_t* acquisition)
+{
+}
+
+/**
+ * @brief fill the block being filled with the next samples and complete it
+ * @returns 0 if not enough samples are left
+ */
+static int fill_block(acquisition_t* acquisition, mock_adc_t* mock)
+{
+  int size = get_block_size(acquisition);
+
+  if (mock->position + size > mock->length) {
+    mock->position = mock->length;
+    return 0;
+  }
+
+  memcpy(get_filling_block(acquisition), mock->samples + mock->position, size * sizeof(uint16_t));
+  mock->position += size;
+  complete_block(acquisition);
+  return 1;
+}
+
+static void poll_mock_adc(acquisition_t* acquisition)
+{
+  mock_adc_t* mock = (mock_adc_t*) get_backend_context(acquisition);
+
+  if (mock->pacing == MOCK_IMMEDIATE) {
+    fill_block(acquisition, mock);
+    return;
+  }
+
+  double elapsed = (micros() - mock->start_us) * 1e-6;
+  long due = (long) (elapsed * get_acquisition_frequency(acquisition)) * get_channel_count(acquisition);
+  while (mock->position + get_block_size(acquisition) <= due && fill_block(acquisition, mock));
+}
+
+const acquisition_backend_t mock_adc_backend = { "mock_adc", start_mock_adc, stop_mock_adc, poll_mock_adc };
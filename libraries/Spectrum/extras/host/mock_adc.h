@@ -0,0 +1,34 @@
+/**
+ * mock_adc.h
+ *
+ * Acquisition backend for the host: blocks are filled from an array of
+ * ADC values, or from a text file, instead of the Due's ADC
+ *
+ * Author: Vincent Lacasse (lacasse4@yahoo.com)
+ * Date: 2026-10-18
+ * Target system: Linux (host)
+ *
+ */
+
+#ifndef _MOCK_ADC_H
+#define _MOCK_ADC_H
+
+#include <stdint.h>
+#include "acquisition.h"
+
+#define MOCK_IMMEDIATE  0     // a block at every poll, as fast as the loop reads them
+#define MOCK_PACED      1     // blocks complete in real time, at the sampling frequency
+
+typedef struct mock_adc mock_adc_t;
+
+extern const acquisition_backend_t mock_adc_backend;
+
+mock_adc_t* create_mock_adc(const uint16_t* samples, long length, int pacing);
+mock_adc_t* load_mock_adc(const char* path, int pacing);
+void delete_mock_adc(mock_adc_t* mock);
+
+long get_mock_length(mock_adc_t* mock);
+long get_mock_position(mock_adc_t* mock);
+int is_mock_finished(mock_adc_t* mock);
+
+#endif
@@ -0,0 +1,252 @@
+/**
+ * multires_bench.cpp
+ *
+ * Host benchmark of the multi-resolution analysis (multires.h) against
+ * the single window tuner (1024 samples, hop 256, as AutoStrobe2).
+ *
+ * Notes are the Due/DAC guitar recordings (E2 to E4) and synthetic
+ * plucks above them (A4 to A5).  Both analyses get the same samples; their
+ * latest pitch is read every tick (the highest band's hop) and reported:
+ *   latency   time from the first sample to the first correct pitch
+ *   correct   ticks with a correct pitch, once both analyses are running
+ *   cost      processing time per second of audio
+ *
+ * Author: Vincent Lacasse (lacasse4@yahoo.com)
+ * Date: 2026-10-18
+ * Target system: Linux (host)
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+#include <spectrum.h>
+#include <multires.h>
+#include "dac_data.h"
+
+#define SAMPLING_FREQUENCY  4000.0  // Hz
+#define SIGNAL_LENGTH       1024
+#define HOP                 256
+#define ADC_RESOLUTION      10
+#define MIN_FREQUENCY       40      // Hz
+#define MAX_FREQUENCY       900     // Hz
+#define CORRECT_CENTS       50.0
+
+#define PLUCK_SECONDS       1.5     // synthetic notes
+#define PLUCK_DECAY         0.5     // amplitude time constant (s)
+#define PLUCK_AMPLITUDE     300.0   // ADC units
+#define PLUCK_HARMONICS     6
+
+typedef struct note {
+  const char* name;
+  double frequency;
+  int* samples;
+  int length;
+} note_t;
+
+typedef struct result {
+  double latency_ms;           // first correct pitch, -1 if none
+  int correct;                 // ticks with a correct pitch
+  int ticks;                   // ticks once both analyses run
+  long long ns;                // processing time
+  int band_ticks[MULTIRES_MAX_BANDS];
+} result_t;
+
+static int bands = MULTIRES_MAX_BANDS;
+static int sample_type = SAMPLE_DOUBLE;
+
+static long long now_ns()
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+static int is_correct(peak_t* pitch, double expected)
+{
+  return pitch->index != -1 && pitch->frequency > 0.0 &&
+         fabs(1200.0 * log2(pitch->frequency / expected)) < CORRECT_CENTS;
+}
+
+/**
+ * @brief a Due/DAC recording resampled to the tuner and scaled to the ADC resolution
+ */
+static void load_recording(note_t* note, const recording_t* rec)
+{
+  double step = DAC_SAMPLING_FREQ / SAMPLING_FREQUENCY;
+
+  note->name = rec->note;
+  note->frequency = rec->frequency;
+  note->length = (int) ((rec->length - 1) / step);
+  note->samples = (int*) malloc(note->length * sizeof(int));
+  for (int i = 0; i < note->length; i++) {
+    note->samples[i] = resample_recording(rec, i * step, ADC_RESOLUTION);
+  }
+}
+
+/**
+ * @brief a decaying tone of PLUCK_HARMONICS harmonics (1/k amplitudes)
+ */
+static void make_pluck(note_t* note, const char* name, double frequency)
+{
+  double bias = ldexp(1.0, ADC_RESOLUTION - 1);
+
+  note->name = name;
+  note->frequency = frequency;
+  note->length = (int) (PLUCK_SECONDS * SAMPLING_FREQUENCY);
+  note->samples = (int*) malloc(note->length * sizeof(int));
+  for (int i = 0; i < note->length; i++) {
+    double t = i / SAMPLING_FREQUENCY;
+    double value = 0.0;
+    for (int k = 1; k <= PLUCK_HARMONICS && k * frequency < SAMPLING_FREQUENCY / 2; k++) {
+      value += sin(2.0 * M_PI * k * frequency * t) / k;
+    }
+    note->samples[i] = (int) round(bias + PLUCK_AMPLITUDE * exp(-t / PLUCK_DECAY) * value);
+  }
+}
+
+/**
+ * @brief run both analyses over a note, reading their pitch every 'tick' samples
+ */
+static void run_note(note_t* note, int tick, result_t* single, result_t* multi)
+{
+  signal_t* signal = create_signal(SIGNAL_LENGTH, SAMPLING_FREQUENCY, ZERO_PADDING_ENABLED, sample_type);
+  multires_t* multires = create_multires(bands, SIGNAL_LENGTH, SAMPLING_FREQUENCY, MIN_FREQUENCY,
+                                         MAX_FREQUENCY, sample_type);
+  peak_t single_pitch;
+  peak_t multi_pitch;
+
+  if (signal == NULL || multires == NULL || !enable_streaming(signal, HOP)) {
+    fprintf(stderr, "out of memory\n");
+    exit(1);
+  }
+  memset(single, 0, sizeof(result_t));
+  memset(multi, 0, sizeof(result_t));
+  single->latency_ms = -1.0;
+  multi->latency_ms = -1.0;
+  erase_peak(&single_pitch);
+  erase_peak(&multi_pitch);
+
+  for (int i = 0; i < note->length; i++) {
+    long long start = now_ns();
+    add_sample(signal, note->samples[i]);
+    if (is_buffer_full(signal)) {
+      load_latest_frame(signal);
+      remove_bias(signal);
+      compute_spectrum(signal);
+      compute_peak_list(signal, MIN_FREQUENCY, MAX_FREQUENCY);
+      single_pitch = find_fundamental_frequency(get_peak_list(signal));
+    }
+    long long middle = now_ns();
+    add_multires_sample(multires, note->samples[i]);
+    if (update_multires(multires)) {
+      multi_pitch = get_multires_fundamental(multires);
+    }
+    long long stop = now_ns();
+    single->ns += middle - start;
+    multi->ns += stop - middle;
+
+    if ((i + 1) % tick != 0) continue;
+
+    double ms = 1000.0 * (i + 1) / SAMPLING_FREQUENCY;
+    if (single->latency_ms < 0.0 && is_correct(&single_pitch, note->frequency)) single->latency_ms = ms;
+    if (multi->latency_ms < 0.0 && is_correct(&multi_pitch, note->frequency)) multi->latency_ms = ms;
+
+    if (i + 1 >= SIGNAL_LENGTH) {
+      single->ticks++;
+      multi->ticks++;
+      single->correct += is_correct(&single_pitch, note->frequency);
+      multi->correct += is_correct(&multi_pitch, note->frequency);
+      if (get_multires_band(multires) >= 0) multi->band_ticks[get_multires_band(multires)]++;
+    }
+  }
+
+  delete_multires(multires);
+  delete_signal(signal);
+}
+
+static void usage(const char* name)
+{
+  fprintf(stderr, "usage: %s [-b bands] [-t double|float|q15|q31]\n", name);
+  exit(1);
+}
+
+int main(int argc, char* argv[])
+{
+  note_t notes[DAC_RECORDINGS + 4];
+  int count = 0;
+  int opt;
+
+  while ((opt = getopt(argc, argv, "b:t:")) != -1) {
+    switch (opt) {
+      case 'b': bands = atoi(optarg); break;
+      case 't':
+        for (sample_type = SAMPLE_Q31; sample_type > SAMPLE_DOUBLE; sample_type--) {
+          if (strcmp(optarg, sample_type_name[sample_type]) == 0) break;
+        }
+        break;
+      default: usage(argv[0]);
+    }
+  }
+
+  multires_t* layout = create_multires(bands, SIGNAL_LENGTH, SAMPLING_FREQUENCY, MIN_FREQUENCY,
+                                       MAX_FREQUENCY, sample_type);
+  if (layout == NULL) {
+    fprintf(stderr, "%d bands do not fit %d samples from %d to %d Hz\n", bands, SIGNAL_LENGTH,
+            MIN_FREQUENCY, MAX_FREQUENCY);
+    return 1;
+  }
+  int tick = get_length(get_band_signal(layout, bands - 1)) / MULTIRES_HOP_DIVIDER;
+
+  printf("Multi-resolution: %d bands, %s samples at %.0f Hz, pitch read every %d samples (%.0f ms)\n",
+         bands, sample_type_name[sample_type], SAMPLING_FREQUENCY, tick, 1000.0 * tick / SAMPLING_FREQUENCY);
+  for (int b = 0; b < bands; b++) {
+    signal_t* signal = get_band_signal(layout, b);
+    printf("  band %d: %4d samples (%3.0f ms), %5.1f - %5.1f Hz\n", b, get_length(signal),
+           1000.0 * get_length(signal) / SAMPLING_FREQUENCY,
+           get_band_low_frequency(layout, b), get_band_high_frequency(layout, b));
+  }
+  printf("Single: %d samples (%.0f ms), hop %d\n\n", SIGNAL_LENGTH,
+         1000.0 * SIGNAL_LENGTH / SAMPLING_FREQUENCY, HOP);
+  delete_multires(layout);
+
+  for (int r = 0; r < DAC_RECORDINGS; r++) {
+    load_recording(&notes[count++], &recordings[r]);
+  }
+  make_pluck(&notes[count++], "A4", 440.00);
+  make_pluck(&notes[count++], "C5", 523.25);
+  make_pluck(&notes[count++], "E5", 659.26);
+  make_pluck(&notes[count++], "A5", 880.00);
+
+  printf("%-4s %8s | %10s %8s | %10s %8s   %s\n", "note", "expected",
+         "single ms", "correct", "multi ms", "correct", "ticks per band");
+
+  long long single_ns = 0;
+  long long multi_ns = 0;
+  long samples = 0;
+
+  for (int n = 0; n < count; n++) {
+    result_t single;
+    result_t multi;
+
+    run_note(&notes[n], tick, &single, &multi);
+    single_ns += single.ns;
+    multi_ns += multi.ns;
+    samples += notes[n].length;
+
+    printf("%-4s %8.2f | %10.0f %7.1f%% | %10.0f %7.1f%%  ", notes[n].name, notes[n].frequency,
+           single.latency_ms, 100.0 * single.correct / single.ticks,
+           multi.latency_ms, 100.0 * multi.correct / multi.ticks);
+    for (int b = 0; b < bands; b++) printf(" %4d", multi.band_ticks[b]);
+    printf("\n");
+    free(notes[n].samples);
+  }
+
+  double seconds = samples / SAMPLING_FREQUENCY;
+  printf("\nCost per second of audio: single %.2f ms, multi-resolution %.2f ms (%.2fx)\n",
+         single_ns * 1e-6 / seconds, multi_ns * 1e-6 / seconds, (double) multi_ns / single_ns);
+  return 0;
+}
@@ -0,0 +1,267 @@
+/**
+ * queue_test.cpp
+ *
+ * Host test of the sample queue (sample_queue.h): one thread stands in for
+ * the acquisition interrupt handler, another for the main loop.
+ *
+ *   - sequence: paced producer, consumer with random stalls a hop shorter
+ *     than the queue: every sample must arrive once, in order, without
+ *     overrun unless the host kept the consumer away longer than the queue
+ *   - frames: a tone goes through load_frame() into a streaming signal:
+ *     every hop must give a frame and the right frequency (the loop polls
+ *     the queue: underruns are counted while it waits)
+ *   - overrun: a consumer stalled longer than the queue: the producer must
+ *     keep its pace and count the samples it drops
+ *
+ * Author: Vincent Lacasse (lacasse4@yahoo.com)
+ * Date: 2026-10-18
+ * Target system: Linux (host)
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include <pthread.h>
+#include <sched.h>
+#include "spectrum.h"
+#include "sample_queue.h"
+
+#define SAMPLING_FREQUENCY  4000.0
+#define SIGNAL_LENGTH       1024
+#define HOP                 256
+#define DEPTH               4
+#define SPEEDUP             20        // samples are produced 20 times faster than on the Due
+#define TONE_FREQUENCY      110.0
+#define SAMPLE_MASK         0xFFF     // 12 bit ADC values
+
+typedef struct producer {
+  sample_queue_t* queue;
+  long samples;                // samples to produce
+  int tone;                    // a tone if true, a counter otherwise
+  long long elapsed_ns;        // time taken to produce the samples
+  long pushed;                 // samples accepted by the queue
+  int done;
+} producer_t;
+
+static long long now_ns()
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+static int tone_sample(long i)
+{
+  return 2048 + (int) lround(1000.0 * sin(2.0 * M_PI * TONE_FREQUENCY * i / SAMPLING_FREQUENCY));
+}
+
+static long long period_ns() { return (long long) (1e9 / (SAMPLING_FREQUENCY * SPEEDUP)); }
+
+/**
+ * @brief the 'interrupt handler': one sample per (accelerated) sampling period
+ * @details the thread sleeps until the next sampling instant, then pushes 
+ * @details every sample that is due (the host may wake it up late)
+ */
+static void* produce(void* arg)
+{
+  producer_t* p = (producer_t*) arg;
+  long long begin = now_ns();
+  long i = 0;
+
+  while (i < p->samples) {
+    long long next = begin + i * period_ns();
+    struct timespec ts = { (time_t) (next / 1000000000LL), (long) (next % 1000000000LL) };
+    clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL);
+
+    for (long long now = now_ns(); i < p->samples && begin + i * period_ns() <= now; i++) {
+      p->pushed += push_sample(p->queue, p->tone ? tone_sample(i) : (int) (i & SAMPLE_MASK));
+    }
+  }
+  p->elapsed_ns = now_ns() - begin;
+  __atomic_store_n(&p->done, 1, __ATOMIC_RELEASE);
+  return NULL;
+}
+
+static int is_done(producer_t* p) { return __atomic_load_n(&p->done, __ATOMIC_ACQUIRE); }
+
+static void start(pthread_t* thread, producer_t* p, sample_queue_t* queue, long samples, int tone)
+{
+  p->queue = queue;
+  p->samples = samples;
+  p->tone = tone;
+  p->elapsed_ns = 0;
+  p->pushed = 0;
+  p->done = 0;
+  pthread_create(thread, NULL, produce, p);
+}
+
+/**
+ * @brief stall the consumer for a number of (accelerated) sampling periods
+ * @returns the time it actually stalled (ns): the host may wake it up late
+ */
+static long long stall(int periods)
+{
+  long long begin = now_ns();
+  long long end = begin + periods * period_ns();
+  struct timespec ts = { (time_t) (end / 1000000000LL), (long) (end % 1000000000LL) };
+
+  clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL);
+  return now_ns() - begin;
+}
+
+static int report(const char* name, int passed, sample_queue_t* queue, const char* details)
+{
+  printf("%-9s %s  overrun %5u  underrun %8u  %s\n", name, passed ? "PASS" : "FAIL",
+         get_overrun_count(queue), get_underrun_count(queue), details);
+  return passed;
+}
+
+/**
+ * @brief every sample arrives once and in order despite consumer stalls
+ * @details the stalls keep a hop of margin under the queue's depth.  The
+ * @details consumer's longest absence is measured: a loaded host may keep
+ * @details it away longer than the queue holds, and the samples then
+ * @details dropped are reported rather than failed.  After a gap, 'expected'
+ * @details resyncs to the sample popped: the gap must match the overruns.
+ */
+static int test_sequence()
+{
+  sample_queue_t* queue = create_sample_queue(HOP, DEPTH);
+  producer_t p;
+  pthread_t thread;
+  long expected = 0;
+  long gaps = 0;
+  long skipped = 0;
+  long long absorbed_ns = (long long) (DEPTH - 1) * HOP * period_ns();
+  long long longest_ns = 0;
+  long long last = now_ns();
+  char details[120];
+
+  srand(1);
+  start(&thread, &p, queue, 200 * HOP, 0);
+
+  while (!is_done(&p) || queued_samples(queue) > 0) {
+    int sample;
+    long long now = now_ns();
+
+    if (now - last > longest_ns) longest_ns = now - last;
+    last = now;
+
+    if (!pop_sample(queue, &sample)) {
+      sched_yield();
+      continue;
+    }
+    if (sample != (expected & SAMPLE_MASK)) {
+      long gap = (sample - expected) & SAMPLE_MASK;
+      gaps++;
+      skipped += gap;
+      expected += gap;
+    }
+    expected++;
+
+    // stall up to DEPTH - 2 hops, at most once per hop
+    if (expected % HOP == 0 && rand() % 4 == 0) stall(rand() % ((DEPTH - 2) * HOP));
+  }
+  pthread_join(thread, NULL);
+
+  // overruns only count against the queue if the consumer was never away longer than it holds
+  int late = longest_ns > absorbed_ns;
+  snprintf(details, sizeof(details), "%ld/%ld samples in order, %ld gap(s), away %.2f ms at most (%.2f)%s",
+           expected - skipped, p.samples, gaps, longest_ns / 1e6, absorbed_ns / 1e6,
+           late ? ", host late" : "");
+  int passed = report("sequence", expected == p.samples && skipped == get_overrun_count(queue) &&
+                      (late || get_overrun_count(queue) == 0), queue, details);
+  delete_sample_queue(queue);
+  return passed;
+}
+
+/**
+ * @brief every hop gives a frame of a streaming signal, with the right frequency
+ */
+static int test_frames()
+{
+  sample_queue_t* queue = create_sample_queue(HOP, DEPTH);
+  signal_t* signal = create_signal(SIGNAL_LENGTH, SAMPLING_FREQUENCY, ZERO_PADDING_ENABLED);
+  producer_t p;
+  pthread_t thread;
+  long samples = SIGNAL_LENGTH + 99 * HOP;
+  int frames = 0;
+  int wrong = 0;
+  char details[100];
+
+  enable_streaming(signal, HOP);
+  start(&thread, &p, queue, samples, 1);
+
+  while (!is_done(&p) || queued_frames(queue) > 0) {
+    // the loop is faster than the producer: most calls are underruns
+    if (!load_frame(queue, signal)) {
+      sched_yield();
+      continue;
+    }
+    if (!is_buffer_full(signal)) continue;
+
+    load_latest_frame(signal);
+    remove_bias(signal);
+    compute_spectrum(signal);
+    peak_t fundamental = estimate_fundamental(signal, 40.0, 900.0);
+    if (fundamental.index == -1 || fabs(fundamental.frequency - TONE_FREQUENCY) > 0.5) wrong++;
+    frames++;
+  }
+  pthread_join(thread, NULL);
+
+  int expected = (samples - SIGNAL_LENGTH) / HOP + 1;
+  snprintf(details, sizeof(details), "%d/%d frames, %d wrong frequency", frames, expected, wrong);
+  int passed = report("frames", frames == expected && wrong == 0 &&
+                      get_overrun_count(queue) == 0, queue, details);
+  delete_signal(signal);
+  delete_sample_queue(queue);
+  return passed;
+}
+
+/**
+ * @brief a consumer stalled longer than the queue: samples are dropped and counted,
+ * @brief the producer keeps its pace
+ */
+static int test_overrun()
+{
+  sample_queue_t* queue = create_sample_queue(HOP, 1);
+  producer_t p;
+  pthread_t thread;
+  long popped = 0;
+  char details[100];
+
+  start(&thread, &p, queue, 20 * HOP, 0);
+
+  while (!is_done(&p) || queued_samples(queue) > 0) {
+    int sample;
+    if (!pop_sample(queue, &sample)) sched_yield();
+    else if (++popped % HOP == 0) stall(2 * HOP);
+  }
+  pthread_join(thread, NULL);
+
+  // the producer must not have waited for the consumer
+  long long nominal = p.samples * period_ns();
+  snprintf(details, sizeof(details), "%ld pushed + %u dropped of %ld, producer took %.1f ms (%.1f)",
+           p.pushed, get_overrun_count(queue), p.samples, p.elapsed_ns / 1e6, nominal / 1e6);
+  int passed = report("overrun", get_overrun_count(queue) > 0 &&
+                      p.pushed + get_overrun_count(queue) == p.samples && popped == p.pushed &&
+                      p.elapsed_ns < nominal * 3 / 2, queue, details);
+  delete_sample_queue(queue);
+  return passed;
+}
+
+int main(int argc, char* argv[])
+{
+  int passed = 1;
+
+  printf("Sample queue: %d frames of %d samples, %.0f Hz x %d\n\n",
+         DEPTH, HOP, SAMPLING_FREQUENCY, SPEEDUP);
+
+  passed &= test_sequence();
+  passed &= test_frames();
+  passed &= test_overrun();
+
+  return passed ? 0 : 1;
+}
@@ -0,0 +1,703 @@
+/**
+ * spectrum_batch.cpp
+ *
+ * Offline batch analyzer: runs the Spectrum pitch pipeline over every
+ * frame of a corpus of recordings, on a pool of threads.
+ *
+ * Inputs are files or directories of files:
+ *   .wav  PCM (8, 16, 24 or 32 bits) or float, first channel
+ *   .raw  unsigned 16 bit little endian ADC values (-S rate, -B bits)
+ *   .h    C arrays of ADC values, as in Due/DAC (-S rate, -B bits)
+ * The expected pitch (label) comes from the file name: a note name
+ * ("E2", "guitar_G#3_take2") or a frequency ("110Hz").
+ *
+ * The peak search thresholds (-P, -R, -W) take comma separated lists:
+ * every combination is run over every file (a job per file and
+ * combination), so a corpus can be swept for the best tuning.
+ *
+ * Author: Vincent Lacasse (lacasse4@yahoo.com)
+ * Date: 2026-10-18
+ * Target system: Linux (host)
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <pthread.h>
+#include <spectrum.h>
+#include <peak.h>
+#include <peak_list.h>
+#include "dac_data.h"
+
+/*
+ * Default tuner settings (same as AutoStrobe2)
+ */
+#define SAMPLING_FREQUENCY  4000.0  // Hz
+#define SIGNAL_LENGTH       1024
+#define ADC_RESOLUTION      10      // Due analogRead() default resolution (bits)
+#define MIN_FREQUENCY       40      // Hz
+#define MAX_FREQUENCY       900     // Hz
+
+#define RAW_FREQUENCY       10000.0 // .raw and .h files: Due/DAC recordings
+#define RAW_RESOLUTION      12
+
+#define CORRECT_CENTS       50.0    // a pitch is correct within a quarter tone
+#define MAX_VALUES          8       // values of a swept threshold
+#define MAX_INPUTS          1024
+
+typedef struct input {
+  char path[512];
+  const char* name;        // file name, in path
+  char note[8];            // label: note name ("" if none)
+  double frequency;        // label: expected fundamental (0 if none)
+  double rate;             // sampling frequency (Hz)
+  float* data;             // samples in [0, 1) (offset binary)
+  long length;
+} input_t;
+
+typedef struct thresholds {
+  double lowest_power;
+  double highest_ratio;
+  double search_window;
+} thresholds_t;
+
+typedef struct result {
+  int frames;
+  int detected;
+  int correct;
+  int octave;
+  double median;           // median error of the correct frames (cents)
+  double abs_error;        // sum of |error| of the correct frames (cents)
+  double confidence;       // sum of the confidence of the detected frames
+  long long elapsed_ns;    // CPU time of the job
+} result_t;
+
+typedef struct settings {
+  double sampling_frequency;
+  int length;
+  int zero_padding;
+  int sample_type;
+  int real_fft;
+  int hop;
+  int tracking;
+  int estimator;
+  int decimation;
+  int refinement;
+  int adc_resolution;
+  double low_frequency;
+  double high_frequency;
+  double raw_frequency;
+  int raw_resolution;
+  int threads;
+  const char* output;      // directory of the pitch tracks (NULL: none)
+  int verbose;
+} settings_t;
+
+static const char* estimator_name[] = { "list", "sum", "product", "mpm" };
+
+static settings_t cfg;
+static input_t inputs[MAX_INPUTS];
+static int input_number = 0;
+static thresholds_t* combos = NULL;
+static int combo_number = 0;
+static result_t* results = NULL;      // job = combo * input_number + input
+static int next_job = 0;
+
+static long long now_ns(clockid_t clock)
+{
+  struct timespec ts;
+  clock_gettime(clock, &ts);
+  return ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+static double cents(double frequency, double reference)
+{
+  return 1200.0 * log2(frequency / reference);
+}
+
+static int compare_double(const void* a, const void* b)
+{
+  double x = *(const double*) a;
+  double y = *(const double*) b;
+  return (x > y) - (x < y);
+}
+
+static int has_extension(const char* name, const char* extension)
+{
+  const char* dot = strrchr(name, '.');
+  return dot != NULL && strcasecmp(dot + 1, extension) == 0;
+}
+
+/**
+ * @brief find the expected pitch in a file name: a note name or a frequency in Hz
+ * @returns 1 if found
+ */
+static int parse_label(input_t* input)
+{
+  static const int semitone[7] = { 9, 11, 0, 2, 4, 5, 7 };   // A to G
+  const char* name = input->name;
+
+  for (const char* c = name; *c != '\0' && *c != '.'; c++) {
+    if (c != name && isalnum((unsigned char) c[-1])) continue;
+
+    // a frequency: digits followed by "Hz"
+    char* end;
+    double frequency = strtod(c, &end);
+    if (end != c && frequency > 0.0 && strncasecmp(end, "hz", 2) == 0) {
+      input->frequency = frequency;
+      snprintf(input->note, sizeof(input->note), "%.0fHz", frequency);
+      return 1;
+    }
+
+    // a note: letter, optional sharp or flat, octave, not followed by a digit
+    int letter = toupper((unsigned char) c[0]);
+    if (letter < 'A' || letter > 'G') continue;
+    int accidental = 0;
+    const char* octave = c + 1;
+    if (*octave == '#' || *octave == 's') accidental = 1, octave++;
+    else if (*octave == 'b') accidental = -1, octave++;
+    if (!isdigit((unsigned char) octave[0]) || isdigit((unsigned char) octave[1])) continue;
+
+    int midi = 12 * (octave[0] - '0' + 1) + semitone[letter - 'A'] + accidental;
+    input->frequency = 440.0 * pow(2.0, (midi - 69) / 12.0);
+    snprintf(input->note, sizeof(input->note), "%.*s", (int) (octave - c + 1), c);
+    return 1;
+  }
+  return 0;
+}
+
+/**
+ * @brief append a sample to an input's data, growing it as needed
+ */
+static int append_sample(input_t* input, long* capacity, double value)
+{
+  if (input->length == *capacity) {
+    *capacity = *capacity ? *capacity * 2 : 65536;
+    float* larger = (float*) realloc(input->data, *capacity * sizeof(float));
+    if (larger == NULL) return 0;
+    input->data = larger;
+  }
+  input->data[input->length++] = value;
+  return 1;
+}
+
+static uint32_t read_le(const uint8_t* bytes, int size)
+{
+  uint32_t value = 0;
+  for (int i = size - 1; i >= 0; i--) value = value << 8 | bytes[i];
+  return value;
+}
+
+/**
+ * @brief load a RIFF WAVE file (PCM or 32 bit float, first channel)
+ */
+static int load_wav(input_t* input, FILE* file)
+{
+  uint8_t header[12];
+  uint8_t chunk[8];
+  uint8_t format[16];
+  int has_format = 0;
+  long capacity = 0;
+
+  if (fread(header, 1, 12, file) != 12 || memcmp(header, "RIFF", 4) || memcmp(header + 8, "WAVE", 4)) {
+    return 0;
+  }
+
+  while (fread(chunk, 1, 8, file) == 8) {
+    uint32_t size = read_le(chunk + 4, 4);
+
+    if (memcmp(chunk, "fmt ", 4) == 0 && size >= 16) {
+      if (fread(format, 1, 16, file) != 16) return 0;
+      fseek(file, size - 16 + (size & 1), SEEK_CUR);
+      has_format = 1;
+      continue;
+    }
+    if (memcmp(chunk, "data", 4) != 0 || !has_format) {
+      fseek(file, size + (size & 1), SEEK_CUR);
+      continue;
+    }
+
+    int encoding = read_le(format, 2);           // 1: PCM, 3: float
+    int channels = read_le(format + 2, 2);
+    int bits = read_le(format + 14, 2);
+    int bytes = bits / 8;
+    uint8_t sample[4 * 16];
+
+    input->rate = read_le(format + 4, 4);
+    if (channels < 1 || channels > 16 || bytes < 1 || bytes > 4 || (encoding == 3 && bits != 32) ||
+        (encoding != 1 && encoding != 3 && encoding != 0xFFFE)) {
+      return 0;
+    }
+
+    for (uint32_t read = 0; read + bytes * channels <= size; read += bytes * channels) {
+      if (fread(sample, bytes, channels, file) != (size_t) channels) break;
+      uint32_t value = read_le(sample, bytes);
+      double x;
+      if (encoding == 3) {
+        float real;
+        memcpy(&real, &value, sizeof(real));
+        x = real;
+      }
+      else if (bytes == 1) {
+        x = (value - 128) / 128.0;
+      }
+      else {
+        int shift = 32 - bits;
+        x = (double) ((int32_t) (value << shift) >> shift) / ldexp(1.0, bits - 1);
+      }
+      if (!append_sample(input, &capacity, (x + 1.0) / 2.0)) return 0;
+    }
+    return input->length > 0;
+  }
+  return 0;
+}
+
+/**
+ * @brief load unsigned 16 bit little endian ADC values
+ */
+static int load_raw(input_t* input, FILE* file)
+{
+  uint8_t bytes[2];
+  long capacity = 0;
+  double full_scale = ldexp(1.0, cfg.raw_resolution);
+
+  input->rate = cfg.raw_frequency;
+  while (fread(bytes, 1, 2, file) == 2) {
+    if (!append_sample(input, &capacity, read_le(bytes, 2) / full_scale)) return 0;
+  }
+  return input->length > 0;
+}
+
+/**
+ * @brief load the ADC values of a C array (the integers between '{' and '}')
+ */
+static int load_array(input_t* input, FILE* file)
+{
+  long capacity = 0;
+  long value;
+  int c;
+  double full_scale = ldexp(1.0, cfg.raw_resolution);
+
+  input->rate = cfg.raw_frequency;
+  while ((c = fgetc(file)) != EOF && c != '{');
+  while (fscanf(file, " %ld ,", &value) == 1) {
+    if (!append_sample(input, &capacity, value / full_scale)) return 0;
+  }
+  return input->length > 0;
+}
+
+/**
+ * @brief load a recording (by its extension)
+ * @returns 1 if OK, 0 if the file is not a recording or cannot be read
+ */
+static int load_input(const char* path)
+{
+  input_t* input = &inputs[input_number];
+  const char* slash = strrchr(path, '/');
+  int loaded = 0;
+
+  if (input_number == MAX_INPUTS) return 0;
+  if (!has_extension(path, "wav") && !has_extension(path, "raw") && !has_extension(path, "h")) return 0;
+
+  memset(input, 0, sizeof(input_t));
+  snprintf(input->path, sizeof(input->path), "%s", path);
+  input->name = slash ? input->path + (slash - path) + 1 : input->path;
+
+  FILE* file = fopen(path, "rb");
+  if (file == NULL) return 0;
+  if (has_extension(path, "wav")) loaded = load_wav(input, file);
+  else if (has_extension(path, "raw")) loaded = load_raw(input, file);
+  else loaded = load_array(input, file);
+  fclose(file);
+
+  if (!loaded || input->rate <= 0.0) {
+    fprintf(stderr, "skipped %s: not a recording\n", path);
+    free(input->data);
+    return 0;
+  }
+  parse_label(input);
+  input_number++;
+  return 1;
+}
+
+static int compare_names(const void* a, const void* b)
+{
+  return strcmp(*(char* const*) a, *(char* const*) b);
+}
+
+/**
+ * @brief load a file, or the files of a directory (in name order)
+ */
+static void load_path(const char* path)
+{
+  struct stat status;
+  char* names[MAX_INPUTS];
+  int count = 0;
+  char file[512];
+
+  if (stat(path, &status) != 0) {
+    fprintf(stderr, "cannot read %s\n", path);
+    exit(1);
+  }
+  if (!S_ISDIR(status.st_mode)) {
+    load_input(path);
+    return;
+  }
+
+  DIR* dir = opendir(path);
+  struct dirent* entry;
+  while (dir != NULL && (entry = readdir(dir)) != NULL && count < MAX_INPUTS) {
+    if (entry->d_name[0] == '.') continue;
+    names[count] = (char*) malloc(strlen(entry->d_name) + 1);
+    strcpy(names[count++], entry->d_name);
+  }
+  if (dir != NULL) closedir(dir);
+
+  qsort(names, count, sizeof(char*), compare_names);
+  for (int i = 0; i < count; i++) {
+    snprintf(file, sizeof(file), "%s/%s", path, names[i]);
+    load_input(file);
+    free(names[i]);
+  }
+}
+
+/**
+ * @brief return an input sample at (fractional) position 'at', scaled to ADC resolution
+ */
+static int resample(const input_t* input, double at)
+{
+  return (int) round(ldexp(interpolate(input->data, at), cfg.adc_resolution));
+}
+
+/**
+ * @brief open the pitch track of a job (NULL if no output directory)
+ */
+static FILE* open_track(const input_t* input, int combo)
+{
+  char path[768];
+
+  if (cfg.output == NULL) return NULL;
+  if (combo_number > 1) {
+    snprintf(path, sizeof(path), "%s/%s.%d.csv", cfg.output, input->name, combo);
+  }
+  else {
+    snprintf(path, sizeof(path), "%s/%s.csv", cfg.output, input->name);
+  }
+
+  FILE* track = fopen(path, "w");
+  if (track != NULL) fprintf(track, "frame,time_s,frequency,power,confidence,peaks,cents\n");
+  return track;
+}
+
+/**
+ * @brief run the pipeline over every frame of an input, with a combination of thresholds
+ */
+static void analyze(const input_t* input, const thresholds_t* thresholds, int combo, result_t* result)
+{
+  double step = input->rate / cfg.sampling_frequency;
+  double at = 0.0;
+  long capacity = 1024;
+  double* errors = (double*) malloc(capacity * sizeof(double));
+  long long start = now_ns(CLOCK_THREAD_CPUTIME_ID);
+
+  signal_t* signal = create_signal(cfg.length, cfg.sampling_frequency, cfg.zero_padding,
+                                   cfg.sample_type, cfg.real_fft);
+  if (signal == NULL || errors == NULL ||
+      !enable_streaming(signal, cfg.hop) ||
+      !set_decimation(signal, cfg.decimation) ||
+      !enable_refinement(signal, cfg.refinement) ||
+      !set_peak_thresholds(signal, thresholds->lowest_power, thresholds->highest_ratio,
+                           thresholds->search_window)) {
+    fprintf(stderr, "create_signal failed\n");
+    exit(1);
+  }
+  enable_tracking(get_peak_list(signal), cfg.tracking);
+  set_fundamental_estimator(signal, cfg.estimator);
+
+  FILE* track = open_track(input, combo);
+  memset(result, 0, sizeof(result_t));
+
+  while (1) {
+    peak_t fundamental;
+
+    // in streaming mode, the ring keeps the previous samples
+    if (!cfg.hop) erase_signal(signal);
+    while (!is_buffer_full(signal) && at < input->length - 1) {
+      add_sample(signal, resample(input, at));
+      at += step;
+    }
+    if (!is_buffer_full(signal)) break;
+    if (cfg.hop) load_latest_frame(signal);
+
+    remove_bias(signal);
+    if (cfg.estimator == ESTIMATOR_MPM) {
+      compute_autocorrelation(signal);
+    }
+    else {
+      compute_spectrum(signal);
+    }
+    if (cfg.estimator == ESTIMATOR_PEAK_LIST) {
+      compute_peak_list(signal, cfg.low_frequency, cfg.high_frequency);
+      fundamental = find_fundamental_frequency(get_peak_list(signal));
+    }
+    else {
+      fundamental = estimate_fundamental(signal, cfg.low_frequency, cfg.high_frequency);
+    }
+
+    int found = fundamental.index != -1 && fundamental.frequency > 0.0;
+    double error = found && input->frequency > 0.0 ? cents(fundamental.frequency, input->frequency) : 0.0;
+
+    if (track != NULL) {
+      fprintf(track, "%d,%.4f,%.3f,%.1f,%.3f,%d,%.2f\n", result->frames, at / input->rate,
+              found ? fundamental.frequency : 0.0, found ? fundamental.power : 0.0,
+              found ? fundamental.confidence : 0.0, list_size(get_peak_list(signal)), error);
+    }
+    result->frames++;
+
+    if (!found) continue;
+    result->detected++;
+    result->confidence += fundamental.confidence;
+    if (input->frequency <= 0.0) continue;
+
+    if (fabs(error) < CORRECT_CENTS) {
+      if (result->correct == capacity) {
+        capacity *= 2;
+        errors = (double*) realloc(errors, capacity * sizeof(double));
+      }
+      errors[result->correct++] = error;
+      result->abs_error += fabs(error);
+    }
+    else if (fabs(error - 1200.0 * round(error / 1200.0)) < CORRECT_CENTS) {
+      result->octave++;
+    }
+  }
+
+  if (result->correct > 0) {
+    qsort(errors, result->correct, sizeof(double), compare_double);
+    result->median = errors[result->correct / 2];
+  }
+  if (track != NULL) fclose(track);
+  delete_signal(signal);
+  free(errors);
+  result->elapsed_ns = now_ns(CLOCK_THREAD_CPUTIME_ID) - start;
+}
+
+/**
+ * @brief worker thread: takes jobs until none is left
+ */
+static void* worker(void* argument)
+{
+  int jobs = combo_number * input_number;
+  int job;
+
+  while ((job = __atomic_fetch_add(&next_job, 1, __ATOMIC_RELAXED)) < jobs) {
+    int combo = job / input_number;
+    analyze(&inputs[job % input_number], &combos[combo], combo, &results[job]);
+  }
+  return NULL;
+}
+
+static void print_result(const char* name, const char* note, const result_t* r, int labeled)
+{
+  printf("%-24s %-5s %7d %7.1f%%", name, note, r->frames,
+         r->frames ? 100.0 * r->detected / r->frames : 0.0);
+  if (labeled) {
+    printf(" %7.1f%% %7d %+9.2f %9.2f", r->frames ? 100.0 * r->correct / r->frames : 0.0,
+           r->octave, r->median, r->correct ? r->abs_error / r->correct : 0.0);
+  }
+  else {
+    printf(" %8s %7s %9s %9s", "-", "-", "-", "-");
+  }
+  if (cfg.estimator == ESTIMATOR_PEAK_LIST) {
+    printf(" %6s\n", "-");
+  }
+  else {
+    printf(" %6.2f\n", r->detected ? r->confidence / r->detected : 0.0);
+  }
+}
+
+/**
+ * @brief parse a comma separated list of values
+ * @returns the number of values
+ */
+static int parse_list(const char* text, double* values)
+{
+  int count = 0;
+  char* end;
+
+  while (count < MAX_VALUES) {
+    values[count++] = strtod(text, &end);
+    if (end == text || (*end != ',' && *end != '\0')) {
+      fprintf(stderr, "bad list of values: %s\n", text);
+      exit(1);
+    }
+    if (*end == '\0') break;
+    text = end + 1;
+  }
+  return count;
+}
+
+static int parse_name(const char* name, const char** names, int count)
+{
+  for (int i = 0; i < count; i++) {
+    if (strcmp(name, names[i]) == 0) return i;
+  }
+  fprintf(stderr, "unknown name: %s\n", name);
+  exit(1);
+}
+
+static void usage(const char* name)
+{
+  fprintf(stderr,
+    "usage: %s [-s sampling_frequency] [-n length] [-z zero_padding]\n"
+    "       [-t double|float|q15|q31] [-r] [-p hop] [-k] [-d 1|2|4]\n"
+    "       [-e list|sum|product|mpm] [-g] [-b adc_resolution]\n"
+    "       [-l low_frequency] [-h high_frequency]\n"
+    "       [-P lowest_peak_power,...] [-R highest_ratio,...] [-W search_window,...]\n"
+    "       [-S raw_sampling_frequency] [-B raw_resolution]\n"
+    "       [-j threads] [-o track_directory] [-v] file_or_directory...\n", name);
+  exit(1);
+}
+
+int main(int argc, char* argv[])
+{
+  double lowest_power[MAX_VALUES] = { LOWEST_PEAK_POWER };
+  double highest_ratio[MAX_VALUES] = { HIGHEST_RATIO };
+  double search_window[MAX_VALUES] = { SEARCH_WINDOW };
+  int powers = 1, ratios = 1, windows = 1;
+  int opt;
+
+  cfg = (settings_t) {
+    SAMPLING_FREQUENCY, SIGNAL_LENGTH, ZERO_PADDING_ENABLED, SAMPLE_DOUBLE, REAL_FFT_DISABLED, 0, 0,
+    ESTIMATOR_PEAK_LIST, 1, 0, ADC_RESOLUTION, MIN_FREQUENCY, MAX_FREQUENCY,
+    RAW_FREQUENCY, RAW_RESOLUTION, (int) sysconf(_SC_NPROCESSORS_ONLN), NULL, 0
+  };
+
+  while ((opt = getopt(argc, argv, "s:n:z:t:rp:ke:d:gb:l:h:P:R:W:S:B:j:o:v")) != -1) {
+    switch (opt) {
+      case 's': cfg.sampling_frequency = atof(optarg); break;
+      case 'n': cfg.length = atoi(optarg); break;
+      case 'z': cfg.zero_padding = atoi(optarg); break;
+      case 't': cfg.sample_type = parse_name(optarg, sample_type_name, 4); break;
+      case 'r': cfg.real_fft = REAL_FFT_ENABLED; break;
+      case 'p': cfg.hop = atoi(optarg); break;
+      case 'k': cfg.tracking = 1; break;
+      case 'e': cfg.estimator = parse_name(optarg, estimator_name, 4); break;
+      case 'd': cfg.decimation = atoi(optarg); break;
+      case 'g': cfg.refinement = 1; break;
+      case 'b': cfg.adc_resolution = atoi(optarg); break;
+      case 'l': cfg.low_frequency = atof(optarg); break;
+      case 'h': cfg.high_frequency = atof(optarg); break;
+      case 'P': powers = parse_list(optarg, lowest_power); break;
+      case 'R': ratios = parse_list(optarg, highest_ratio); break;
+      case 'W': windows = parse_list(optarg, search_window); break;
+      case 'S': cfg.raw_frequency = atof(optarg); break;
+      case 'B': cfg.raw_resolution = atoi(optarg); break;
+      case 'j': cfg.threads = atoi(optarg); break;
+      case 'o': cfg.output = optarg; break;
+      case 'v': cfg.verbose = 1; break;
+      default: usage(argv[0]);
+    }
+  }
+  if (optind == argc) usage(argv[0]);
+  if (cfg.threads < 1) cfg.threads = 1;
+
+  for (int i = optind; i < argc; i++) load_path(argv[i]);
+  if (input_number == 0) {
+    fprintf(stderr, "no recording found\n");
+    return 1;
+  }
+  if (cfg.output != NULL) mkdir(cfg.output, 0777);
+
+  // every combination of the swept thresholds
+  combo_number = powers * ratios * windows;
+  combos = (thresholds_t*) malloc(combo_number * sizeof(thresholds_t));
+  for (int i = 0; i < combo_number; i++) {
+    combos[i].lowest_power = lowest_power[i / (ratios * windows)];
+    combos[i].highest_ratio = highest_ratio[i / windows % ratios];
+    combos[i].search_window = search_window[i % windows];
+  }
+  results = (result_t*) calloc(combo_number * input_number, sizeof(result_t));
+
+  printf("Spectrum batch: %d file(s), %d threshold combination(s), %d thread(s)\n",
+         input_number, combo_number, cfg.threads);
+  printf("Signal: %d %s samples at %.0f Hz, zero padding %s, %s FFT, %d bit ADC\n",
+         cfg.length, sample_type_name[cfg.sample_type], cfg.sampling_frequency,
+         cfg.zero_padding ? "on" : "off", cfg.real_fft ? "real" : "complex", cfg.adc_resolution);
+  if (cfg.hop) printf("Streaming: hop %d samples\n", cfg.hop);
+  if (cfg.decimation > 1) printf("Decimation: %d\n", cfg.decimation);
+  printf("Estimator: %s%s%s\n", estimator_name[cfg.estimator], cfg.tracking ? ", tracking on" : "",
+         cfg.refinement ? ", Goertzel refinement" : "");
+
+  long long start = now_ns(CLOCK_MONOTONIC);
+  pthread_t* threads = (pthread_t*) malloc(cfg.threads * sizeof(pthread_t));
+  for (int i = 0; i < cfg.threads; i++) pthread_create(&threads[i], NULL, worker, NULL);
+  for (int i = 0; i < cfg.threads; i++) pthread_join(threads[i], NULL);
+  long long wall_ns = now_ns(CLOCK_MONOTONIC) - start;
+
+  // results, in file order, then a summary line per combination
+  long total_frames = 0;
+  long long busy_ns = 0;
+  int best = 0;
+  double best_score = -1.0;
+
+  for (int combo = 0; combo < combo_number; combo++) {
+    result_t sum;
+    int labeled = 0;
+    double median_sum = 0.0;
+
+    memset(&sum, 0, sizeof(sum));
+    printf("\nThresholds: lowest peak power %g, highest ratio %g, search window %g\n",
+           combos[combo].lowest_power, combos[combo].highest_ratio, combos[combo].search_window);
+    printf("%-24s %-5s %7s %8s %8s %7s %9s %9s %6s\n",
+           "file", "label", "frames", "detected", "correct", "octave", "median c", "mean |c|", "conf");
+
+    for (int i = 0; i < input_number; i++) {
+      result_t* r = &results[combo * input_number + i];
+      int has_label = inputs[i].frequency > 0.0;
+
+      if (combo_number == 1 || cfg.verbose) print_result(inputs[i].name, inputs[i].note, r, has_label);
+      sum.frames += r->frames;
+      sum.detected += r->detected;
+      sum.confidence += r->confidence;
+      busy_ns += r->elapsed_ns;
+      if (!has_label) continue;
+      labeled += r->frames;
+      sum.correct += r->correct;
+      sum.octave += r->octave;
+      sum.abs_error += r->abs_error;
+      median_sum += r->median * r->correct;
+    }
+    sum.median = sum.correct ? median_sum / sum.correct : 0.0;
+    total_frames += sum.frames;
+    print_result("all", "", &sum, labeled > 0);
+
+    double score = labeled ? (double) sum.correct / labeled : 0.0;
+    if (score > best_score) {
+      best_score = score;
+      best = combo;
+    }
+  }
+
+  if (combo_number > 1) {
+    printf("\nBest: lowest peak power %g, highest ratio %g, search window %g (%.1f%% correct)\n",
+           combos[best].lowest_power, combos[best].highest_ratio, combos[best].search_window,
+           100.0 * best_score);
+  }
+  printf("\nThroughput: %ld frames in %.3f s, %.0f frames/s (%.0f frames/s per CPU)\n",
+         total_frames, wall_ns * 1e-9, total_frames / (wall_ns * 1e-9),
+         busy_ns ? total_frames / (busy_ns * 1e-9) : 0.0);
+
+  for (int i = 0; i < input_number; i++) free(inputs[i].data);
+  free(threads);
+  free(results);
+  free(combos);
+  return 0;
+}
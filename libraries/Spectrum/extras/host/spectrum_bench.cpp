@@ -0,0 +1,507 @@
+/**
+ * spectrum_bench.cpp
+ *
+ * Host replay benchmark for the Spectrum pitch pipeline.
+ *
+ * The guitar recordings of Due/DAC are resampled to the tuner sampling
+ * frequency and fed frame by frame to the same call sequence AutoStrobe2
+ * uses:  add_sample -> remove_bias -> compute_spectrum -> compute_peak_list
+ * -> find_fundamental_frequency.
+ *
+ * For every note, the detected pitch is compared to the expected one.
+ * For every stage, time per frame and peak heap use are reported.
+ *
+ * Author: Vincent Lacasse (lacasse4@yahoo.com)
+ * Date: 2026-10-18
+ * Target system: Linux (host)
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+#include <new>
+#include <spectrum.h>
+#include <static_signal.h>
+#include <peak.h>
+#include <peak_list.h>
+#include <acquisition.h>
+#include <profile.h>
+#include <telemetry.h>
+#include "dac_data.h"
+#include "heap.h"
+#include "mock_adc.h"
+
+/*
+ * Default tuner settings (same as AutoStrobe2)
+ */
+#define SAMPLING_FREQUENCY  4000.0  // Hz
+#define SIGNAL_LENGTH       1024
+#define ADC_RESOLUTION      10      // Due analogRead() default resolution (bits)
+#define MIN_FREQUENCY       40      // Hz
+#define MAX_FREQUENCY       900     // Hz
+
+#define CORRECT_CENTS       50.0    // a pitch is correct within a quarter tone
+#define TELEMETRY_SIZE      16384   // telemetry transmit queue (bytes)
+
+enum stage {
+  STAGE_CREATE,
+  STAGE_ACQUIRE,
+  STAGE_BIAS,
+  STAGE_SPECTRUM,
+  STAGE_PEAKS,
+  STAGE_FUNDAMENTAL,
+  STAGE_NUMBER
+};
+
+static const char* stage_name[STAGE_NUMBER] = {
+  "create_signal",
+  "add_sample",
+  "remove_bias",
+  "compute_spectrum",
+  "compute_peak_list",
+  "find_fundamental",
+};
+
+typedef struct stage_stat {
+  long long total_ns;
+  long long min_ns;
+  long long max_ns;
+  long count;
+  size_t peak_heap;      // highest heap growth observed during the stage
+} stage_stat_t;
+
+typedef struct settings {
+  double sampling_frequency;
+  int length;
+  int zero_padding;
+  int sample_type;
+  int real_fft;
+  int static_storage;
+  int twiddle_table;
+  int const_tables;
+  int hop;
+  int tracking;
+  int estimator;
+  int decimation;
+  int refinement;
+  int mock;
+  int profiling;
+  const char* telemetry;
+  int adc_resolution;
+  double low_frequency;
+  double high_frequency;
+  int iterations;
+  int verbose;
+} settings_t;
+
+static const char* estimator_name[] = { "list", "sum", "product", "mpm" };
+
+static stage_stat_t stats[STAGE_NUMBER];
+static telemetry_t* telemetry = NULL;
+static struct timespec stage_start;
+static size_t stage_heap;
+
+static long long elapsed_ns(struct timespec* from, struct timespec* to)
+{
+  return (to->tv_sec - from->tv_sec) * 1000000000LL + (to->tv_nsec - from->tv_nsec);
+}
+
+static void begin_stage()
+{
+  heap_reset_peak();
+  stage_heap = heap_in_use();
+  clock_gettime(CLOCK_MONOTONIC, &stage_start);
+}
+
+static void end_stage(int stage)
+{
+  struct timespec stop;
+  clock_gettime(CLOCK_MONOTONIC, &stop);
+
+  long long ns = elapsed_ns(&stage_start, &stop);
+  size_t heap = heap_peak() - stage_heap;
+  stage_stat_t* s = &stats[stage];
+
+  if (s->count == 0 || ns < s->min_ns) s->min_ns = ns;
+  if (s->count == 0 || ns > s->max_ns) s->max_ns = ns;
+  if (heap > s->peak_heap) s->peak_heap = heap;
+  s->total_ns += ns;
+  s->count++;
+}
+
+/**
+ * @brief telemetry writer: the file takes everything
+ */
+static int write_file(void* context, const uint8_t* data, int length)
+{
+  return fwrite(data, 1, length, (FILE*) context);
+}
+
+static double cents(double frequency, double reference)
+{
+  return 1200.0 * log2(frequency / reference);
+}
+
+static int compare_double(const void* a, const void* b)
+{
+  double x = *(const double*) a;
+  double y = *(const double*) b;
+  return (x > y) - (x < y);
+}
+
+/*
+ * Static storage (-a): the default tuner signal, built in place for every recording
+ */
+typedef Signal<SIGNAL_LENGTH, (unsigned long) SAMPLING_FREQUENCY, ZeroPad::On> tuner_t;
+
+alignas(8) static uint8_t tuner_storage[sizeof(tuner_t)];
+
+template <typename T, bool RealFft>
+static signal_t* create_static_tuner()
+{
+  typedef Signal<SIGNAL_LENGTH, (unsigned long) SAMPLING_FREQUENCY, ZeroPad::On, T, RealFft> typed_t;
+  static_assert(sizeof(typed_t) <= sizeof(tuner_storage), "tuner_storage is too small");
+
+  return *new (tuner_storage) typed_t();
+}
+
+static signal_t* create_static_signal(settings_t* cfg)
+{
+  if (cfg->length != SIGNAL_LENGTH || cfg->sampling_frequency != SAMPLING_FREQUENCY || 
+      !cfg->zero_padding) {
+    fprintf(stderr, "static storage: %d samples at %.0f Hz with zero padding only\n",
+            SIGNAL_LENGTH, SAMPLING_FREQUENCY);
+    exit(1);
+  }
+
+  switch (cfg->sample_type) {
+    case SAMPLE_FLOAT: return cfg->real_fft ? create_static_tuner<float, true>() : create_static_tuner<float, false>();
+    case SAMPLE_Q15:   return cfg->real_fft ? create_static_tuner<q15_t, true>() : create_static_tuner<q15_t, false>();
+    case SAMPLE_Q31:   return cfg->real_fft ? create_static_tuner<q31_t, true>() : create_static_tuner<q31_t, false>();
+    default:           return cfg->real_fft ? create_static_tuner<double, true>() : create_static_tuner<double, false>();
+  }
+}
+
+/**
+ * @brief replay one recording and print its accuracy line
+ */
+static void replay(const recording_t* rec, settings_t* cfg)
+{
+  double step = DAC_SAMPLING_FREQ / cfg->sampling_frequency;
+  int available = (int) ((rec->length - 1) / step) / cfg->decimation;   // decimated samples
+  int frames = cfg->hop ? (available - cfg->length) / cfg->hop + 1 : available / cfg->length;
+  double* errors = (double*) malloc(frames * cfg->iterations * sizeof(double));
+  int detected = 0;
+  int correct = 0;
+  int octave = 0;
+  double abs_error = 0.0;
+  double confidence = 0.0;
+  uint16_t* samples = NULL;
+  mock_adc_t* mock = NULL;
+  acquisition_t* acquisition = NULL;
+
+  begin_stage();
+  signal_t* signal = cfg->static_storage ? create_static_signal(cfg) :
+                     create_signal(cfg->length, cfg->sampling_frequency, cfg->zero_padding,
+                                   cfg->sample_type, cfg->real_fft);
+  end_stage(STAGE_CREATE);
+  if (signal == NULL ||
+      !enable_const_tables(signal, cfg->const_tables) ||
+      !enable_twiddle_table(signal, cfg->twiddle_table) ||
+      !enable_streaming(signal, cfg->hop) ||
+      !set_decimation(signal, cfg->decimation) ||
+      !enable_refinement(signal, cfg->refinement)) {
+    fprintf(stderr, "create_signal failed\n");
+    exit(1);
+  }
+  enable_tracking(get_peak_list(signal), cfg->tracking);
+  set_fundamental_estimator(signal, cfg->estimator);
+
+  // mock acquisition: the resampled recording, in blocks of a hop (or a frame)
+  if (cfg->mock) {
+    long length = (long) available * cfg->decimation;
+    int block = (cfg->hop ? cfg->hop : cfg->length) * cfg->decimation;
+
+    samples = (uint16_t*) malloc(length * sizeof(uint16_t));
+    for (long i = 0; i < length; i++) {
+      samples[i] = resample_recording(rec, i * step, cfg->adc_resolution);
+    }
+    mock = create_mock_adc(samples, length, MOCK_IMMEDIATE);
+    acquisition = create_acquisition(&mock_adc_backend, mock, 0, cfg->sampling_frequency, block,
+                                     ACQUISITION_MIN_DEPTH);
+    if (acquisition == NULL) {
+      fprintf(stderr, "create_acquisition failed\n");
+      exit(1);
+    }
+  }
+
+  for (int iteration = 0; iteration < cfg->iterations; iteration++) {
+    double at = 0.0;
+
+    erase_signal(signal);
+    reset_tracking(get_peak_list(signal));
+    if (acquisition != NULL) start_acquisition(acquisition);
+
+    for (int frame = 0; frame < frames; frame++) {
+      peak_t fundamental;
+
+      // in streaming mode, the ring keeps the previous samples
+      if (!cfg->hop) erase_signal(signal);
+
+      profile_begin(PROFILE_FRAME);
+      profile_begin(PROFILE_ACQUIRE);
+      begin_stage();
+      while (!is_buffer_full(signal)) {
+        if (acquisition != NULL) {
+          if (!acquire_block(acquisition, signal)) break;
+          continue;
+        }
+        add_sample(signal, resample_recording(rec, at, cfg->adc_resolution));
+        at += step;
+      }
+      if (!is_buffer_full(signal)) break;
+      profile_end(PROFILE_ACQUIRE);
+      if (cfg->hop) load_latest_frame(signal);
+      end_stage(STAGE_ACQUIRE);
+
+      begin_stage();
+      remove_bias(signal);
+      end_stage(STAGE_BIAS);
+
+      if (telemetry != NULL && iteration == 0) send_frame(telemetry, signal);
+
+      begin_stage();
+      if (cfg->estimator == ESTIMATOR_MPM) {
+        compute_autocorrelation(signal);
+      }
+      else {
+        compute_spectrum(signal);
+      }
+      end_stage(STAGE_SPECTRUM);
+
+      // the harmonic estimators do not need the peak list
+      begin_stage();
+      if (cfg->estimator == ESTIMATOR_PEAK_LIST) {
+        compute_peak_list(signal, cfg->low_frequency, cfg->high_frequency);
+      }
+      end_stage(STAGE_PEAKS);
+
+      begin_stage();
+      if (cfg->estimator == ESTIMATOR_PEAK_LIST) {
+        fundamental = find_fundamental_frequency(get_peak_list(signal));
+      }
+      else {
+        fundamental = estimate_fundamental(signal, cfg->low_frequency, cfg->high_frequency);
+      }
+      end_stage(STAGE_FUNDAMENTAL);
+      profile_end(PROFILE_FRAME);
+
+      // the spectrum, unless the signal holds the autocorrelation
+      if (telemetry != NULL && iteration == 0) {
+        if (cfg->estimator != ESTIMATOR_MPM) send_spectrum(telemetry, signal);
+        send_peak_list(telemetry, get_peak_list(signal));
+        send_pitch(telemetry, &fundamental, list_size(get_peak_list(signal)), 0);
+        service_telemetry(telemetry);
+      }
+
+      if (cfg->verbose && iteration == 0) {
+        printf("  %s frame %3d: F = %8.2f Hz, %d peak(s)\n",
+               rec->note, frame, fundamental.frequency, list_size(get_peak_list(signal)));
+      }
+
+      if (fundamental.index == -1 || fundamental.frequency <= 0.0) continue;
+
+      double error = cents(fundamental.frequency, rec->frequency);
+      detected++;
+      confidence += fundamental.confidence;
+      if (fabs(error) < CORRECT_CENTS) {
+        errors[correct++] = error;
+        abs_error += fabs(error);
+      }
+      else if (fabs(error - 1200.0 * round(error / 1200.0)) < CORRECT_CENTS) {
+        octave++;
+      }
+    }
+  }
+
+  delete_signal(signal);
+  if (acquisition != NULL) {
+    delete_acquisition(acquisition);
+    delete_mock_adc(mock);
+    free(samples);
+  }
+
+  int total = frames * cfg->iterations;
+  double median = 0.0;
+  if (correct > 0) {
+    qsort(errors, correct, sizeof(double), compare_double);
+    median = errors[correct / 2];
+  }
+
+  printf("%-4s %8.2f %7d %7.1f%% %7.1f%% %7d %+9.2f %9.2f",
+         rec->note, rec->frequency, total,
+         100.0 * detected / total, 100.0 * correct / total, octave,
+         median, correct ? abs_error / correct : 0.0);
+
+  // the peak list estimator has no confidence measure
+  if (cfg->estimator == ESTIMATOR_PEAK_LIST) {
+    printf(" %6s\n", "-");
+  }
+  else {
+    printf(" %6.2f\n", detected ? confidence / detected : 0.0);
+  }
+
+  free(errors);
+}
+
+static void print_stats()
+{
+  long long frame_ns = 0;
+
+  printf("\n%-18s %12s %12s %12s %12s\n", "stage", "mean ns", "min ns", "max ns", "peak heap");
+  for (int i = 0; i < STAGE_NUMBER; i++) {
+    stage_stat_t* s = &stats[i];
+    long long mean = s->count ? s->total_ns / s->count : 0;
+    if (i != STAGE_CREATE) frame_ns += mean;
+    printf("%-18s %12lld %12lld %12lld %12zu\n",
+           stage_name[i], mean, s->min_ns, s->max_ns, s->peak_heap);
+  }
+  printf("%-18s %12lld\n", "total per frame", frame_ns);
+}
+
+static void print_line(const char* line)
+{
+  puts(line);
+}
+
+static int parse_sample_type(const char* name)
+{
+  for (int i = SAMPLE_DOUBLE; i <= SAMPLE_Q31; i++) {
+    if (strcmp(name, sample_type_name[i]) == 0) return i;
+  }
+  fprintf(stderr, "unknown sample type: %s\n", name);
+  exit(1);
+}
+
+static int parse_estimator(const char* name)
+{
+  for (int i = ESTIMATOR_PEAK_LIST; i <= ESTIMATOR_MPM; i++) {
+    if (strcmp(name, estimator_name[i]) == 0) return i;
+  }
+  fprintf(stderr, "unknown estimator: %s\n", name);
+  exit(1);
+}
+
+static void usage(const char* name)
+{
+  fprintf(stderr,
+    "usage: %s [-s sampling_frequency] [-n length] [-z zero_padding]\n"
+    "       [-t double|float|q15|q31] [-r] [-a] [-w] [-c] [-p hop] [-k] [-d 1|2|4]\n"
+    "       [-e list|sum|product|mpm] [-g] [-m] [-f] [-o telemetry_file]\n"
+    "       [-b adc_resolution] [-l low_frequency] [-h high_frequency]\n"
+    "       [-i iterations] [-v]\n", name);
+  exit(1);
+}
+
+int main(int argc, char* argv[])
+{
+  settings_t cfg = {
+    SAMPLING_FREQUENCY, SIGNAL_LENGTH, ZERO_PADDING_ENABLED, SAMPLE_DOUBLE, REAL_FFT_DISABLED, 0, 0, 0, 0, 0, ESTIMATOR_PEAK_LIST, 1, 0, 0, 0, NULL,
+    ADC_RESOLUTION,
+    MIN_FREQUENCY, MAX_FREQUENCY, 1, 0
+  };
+  int opt;
+
+  while ((opt = getopt(argc, argv, "s:n:z:t:rawcp:ke:d:gmfo:b:l:h:i:v")) != -1) {
+    switch (opt) {
+      case 's': cfg.sampling_frequency = atof(optarg); break;
+      case 'n': cfg.length = atoi(optarg); break;
+      case 'z': cfg.zero_padding = atoi(optarg); break;
+      case 't': cfg.sample_type = parse_sample_type(optarg); break;
+      case 'r': cfg.real_fft = REAL_FFT_ENABLED; break;
+      case 'a': cfg.static_storage = 1; break;
+      case 'w': cfg.twiddle_table = 1; break;
+      case 'c': cfg.const_tables = 1; break;
+      case 'p': cfg.hop = atoi(optarg); break;
+      case 'k': cfg.tracking = 1; break;
+      case 'e': cfg.estimator = parse_estimator(optarg); break;
+      case 'd': cfg.decimation = atoi(optarg); break;
+      case 'g': cfg.refinement = 1; break;
+      case 'm': cfg.mock = 1; break;
+      case 'f': cfg.profiling = 1; break;
+      case 'o': cfg.telemetry = optarg; break;
+      case 'b': cfg.adc_resolution = atoi(optarg); break;
+      case 'l': cfg.low_frequency = atof(optarg); break;
+      case 'h': cfg.high_frequency = atof(optarg); break;
+      case 'i': cfg.iterations = atoi(optarg); break;
+      case 'v': cfg.verbose = 1; break;
+      default: usage(argv[0]);
+    }
+  }
+
+  printf("Spectrum replay: %d %s samples at %.0f Hz, zero padding %s, %s FFT, %d bit ADC\n",
+         cfg.length, sample_type_name[cfg.sample_type], cfg.sampling_frequency,
+         cfg.zero_padding ? "on" : "off", cfg.real_fft ? "real" : "complex",
+         cfg.adc_resolution);
+  if (cfg.static_storage) {
+    printf("Storage: static (static_signal.h)\n");
+  }
+  printf("Tables: twiddle %s, %s\n", cfg.twiddle_table ? "on" : "off",
+         cfg.const_tables ? "const when available" : "RAM");
+  if (cfg.hop) {
+    printf("Streaming: hop %d samples (%.1f ms), %.1f%% overlap\n", cfg.hop,
+           1000.0 * cfg.hop / cfg.sampling_frequency, 100.0 * (cfg.length - cfg.hop) / cfg.length);
+  }
+  if (cfg.mock) {
+    printf("Acquisition: %s backend, blocks of %d samples\n", mock_adc_backend.name,
+           (cfg.hop ? cfg.hop : cfg.length) * cfg.decimation);
+  }
+  if (cfg.decimation > 1) {
+    printf("Decimation: %d (%.0f Hz)\n", cfg.decimation, cfg.sampling_frequency / cfg.decimation);
+  }
+  printf("Estimator: %s%s%s\n", estimator_name[cfg.estimator], cfg.tracking ? ", tracking on" : "",
+         cfg.refinement ? ", Goertzel refinement" : "");
+  printf("\n");
+  printf("%-4s %8s %7s %8s %8s %7s %9s %9s %6s\n",
+         "note", "expected", "frames", "detected", "correct", "octave", "median c", "mean |c|", "conf");
+
+  FILE* file = NULL;
+  if (cfg.telemetry != NULL) {
+    file = fopen(cfg.telemetry, "wb");
+    telemetry = file ? create_telemetry(TELEMETRY_SIZE, write_file, file) : NULL;
+    if (telemetry == NULL) {
+      fprintf(stderr, "cannot write telemetry to %s\n", cfg.telemetry);
+      exit(1);
+    }
+  }
+
+  enable_profiling(cfg.profiling);
+  for (int i = 0; i < DAC_RECORDINGS; i++) {
+    if (telemetry != NULL) {
+      char text[TELEMETRY_MAX_TEXT];
+      snprintf(text, sizeof(text), "note %s %.2f Hz", recordings[i].note, recordings[i].frequency);
+      send_text(telemetry, text);
+    }
+    replay(&recordings[i], &cfg);
+  }
+
+  print_stats();
+  if (cfg.profiling) {
+    printf("\nLibrary profile (histogram: <upper bound in us:runs)\n");
+    dump_profile(print_line);
+  }
+
+  if (telemetry != NULL) {
+    service_telemetry(telemetry);
+    printf("\nTelemetry: %lu records written to %s, %lu dropped\n",
+           (unsigned long) get_sent_records(telemetry), cfg.telemetry,
+           (unsigned long) get_dropped_records(telemetry));
+    delete_telemetry(telemetry);
+    fclose(file);
+  }
+  return 0;
+}
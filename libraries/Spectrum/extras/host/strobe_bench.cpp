@@ -0,0 +1,251 @@
+/**
+ * strobe_bench.cpp
+ *
+ * Host benchmark of the strobe output (strobe.h) against AutoStrobe2's
+ * former PWM driver, on the Due's PWM clock (MCK/64).  A pitch is tracked
+ * through a sequence of notes (with a little noise) and both drivers are
+ * updated every 50 ms, as AutoStrobe2's LED interrupt does:
+ *   restart   stop then start the PWM (pwm_lib): the running period is
+ *             cut short, the period is truncated to 1e-8 s then to counts
+ *   strobe    the next period and duty at each period's end, gliding to
+ *             the target, with a sub-count accumulator
+ * For every note it reports the mean frequency of the whole periods once
+ * settled, against the pitch + 1 Hz offset, and the glitches: periods
+ * shorter than both the previous one and the target.
+ *
+ * Author: Vincent Lacasse (lacasse4@yahoo.com)
+ * Date: 2026-10-18
+ * Target system: Linux (host)
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+#include <strobe.h>
+
+#define CLOCK               (84000000.0 / 64)   // Due PWM clock (counts per second)
+#define MAX_PERIOD          0xFFFF
+#define UPDATE_INTERVAL     0.050   // s, AutoStrobe2's UPDATE_INTERVAL
+#define FREQUENCY_OFFSET    1.0     // Hz, AutoStrobe2's FREQUENCY_OFFSET
+#define DUTY                0.5
+#define NOTE_SECONDS        2.0
+#define SETTLE_SECONDS      0.5     // glide time before the error is measured
+#define GLITCH_RATIO        0.9     // a period this much shorter than expected is a glitch
+
+#define RESTART             0
+#define STROBE              1
+
+static const double notes[] = { 82.41, 110.0, 146.83, 196.0, 246.94, 329.63, 440.0, 659.26, 880.0 };
+#define NOTES ((int) (sizeof(notes) / sizeof(notes[0])))
+
+typedef struct stats {
+    int64_t window_counts[NOTES];  // settled time of each note (counts)
+    int window_periods[NOTES];     // periods over it
+    int glitches[NOTES];
+    long periods;
+    long long ns;                  // strobe_period_elapsed() time
+} stats_t;
+
+typedef struct mock_pwm {
+    uint32_t period;               // running period (counts)
+    uint32_t next;                 // period given by update(), applied at the end of the running one
+    int pending;
+} mock_pwm_t;
+
+static double jitter = 0.05;       // Hz, noise of the tracked pitch
+
+static long long now_ns()
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+static int start_mock(strobe_t* strobe, uint32_t period, uint32_t duty)
+{
+  mock_pwm_t* mock = (mock_pwm_t*) get_strobe_context(strobe);
+  mock->period = period;
+  mock->pending = 0;
+  return 1;
+}
+
+static void stop_mock(strobe_t* strobe) { }
+
+static void update_mock(strobe_t* strobe, uint32_t period, uint32_t duty)
+{
+  mock_pwm_t* mock = (mock_pwm_t*) get_strobe_context(strobe);
+  mock->next = period;
+  mock->pending = 1;
+}
+
+static const strobe_backend_t mock_pwm_backend = { "mock_pwm", CLOCK, MAX_PERIOD, start_mock, stop_mock,
+                                                   update_mock };
+
+/**
+ * @brief pitch given to the drivers at update 'k': the note and some noise
+ */
+static double tracked_pitch(long k, int* note)
+{
+  *note = (int) (k * UPDATE_INTERVAL / NOTE_SECONDS);
+  unsigned int seed = (unsigned int) k * 2654435761u;
+  seed ^= seed >> 13;
+  seed *= 1103515245u;
+  return notes[*note] + jitter * (((seed >> 16) & 0x7FFF) / 16383.5 - 1.0);
+}
+
+/**
+ * @brief former driver: period in 1e-8 s (PWM_MULTIPLIER), truncated to counts by pwm_lib
+ */
+static uint32_t restart_counts(double frequency)
+{
+  uint32_t period = (uint32_t) round(100000000 / (frequency + FREQUENCY_OFFSET));
+  return (uint32_t) ((period / 100000000.0) * CLOCK);
+}
+
+/**
+ * @brief account for an output period starting at 'start' (counts)
+ * @param cut the period was cut short by a restart
+ */
+static void record(stats_t* stats, int64_t start, int64_t length, int64_t previous, int64_t expected,
+                   int cut)
+{
+  int64_t note_counts = (int64_t) (NOTE_SECONDS * CLOCK);
+  int note = (int) (start / note_counts);
+  if (note >= NOTES) return;
+
+  stats->periods++;
+  if (length < GLITCH_RATIO * (previous < expected ? previous : expected)) stats->glitches[note]++;
+  if (!cut && start - note * note_counts >= SETTLE_SECONDS * CLOCK) {
+    stats->window_counts[note] += length;
+    stats->window_periods[note]++;
+  }
+}
+
+static void run_restart(stats_t* stats)
+{
+  int64_t end = (int64_t) (NOTES * NOTE_SECONDS * CLOCK);
+  int64_t interval = (int64_t) (UPDATE_INTERVAL * CLOCK);
+  int note;
+  int64_t start = 0;
+  int64_t period = restart_counts(tracked_pitch(0, &note));
+  int64_t previous = period;
+  int64_t update = interval;
+
+  for (long k = 1; start < end; ) {
+    if (update <= start + period) {
+      // led_stop(), led_start(): the running period ends now
+      record(stats, start, update - start, previous, period, 1);
+      previous = update - start;
+      start = update;
+      period = restart_counts(tracked_pitch(k++, &note));
+      update += interval;
+    }
+    else {
+      record(stats, start, period, previous, period, 0);
+      previous = period;
+      start += period;
+    }
+  }
+}
+
+static void run_strobe(stats_t* stats)
+{
+  int64_t end = (int64_t) (NOTES * NOTE_SECONDS * CLOCK);
+  int64_t interval = (int64_t) (UPDATE_INTERVAL * CLOCK);
+  mock_pwm_t mock;
+  strobe_t* strobe = create_strobe(&mock_pwm_backend, &mock);
+  int note;
+
+  if (strobe == NULL || !start_strobe(strobe, tracked_pitch(0, &note) + FREQUENCY_OFFSET)) {
+    fprintf(stderr, "cannot start the strobe\n");
+    exit(1);
+  }
+  set_strobe(strobe, tracked_pitch(0, &note) + FREQUENCY_OFFSET, DUTY);
+
+  int64_t start = 0;
+  int64_t previous = mock.period;
+  int64_t update = interval;
+
+  for (long k = 1; start < end; ) {
+    // the LED interrupt updates the target while the period runs
+    while (update < start + mock.period) {
+      set_strobe(strobe, tracked_pitch(k++, &note) + FREQUENCY_OFFSET, DUTY);
+      update += interval;
+    }
+
+    int64_t expected = (int64_t) (CLOCK / get_strobe_frequency(strobe));
+    record(stats, start, mock.period, previous, expected, 0);
+    previous = mock.period;
+    start += mock.period;
+
+    // end of period: the hardware applies the pending values, then interrupts
+    if (mock.pending) {
+      mock.period = mock.next;
+      mock.pending = 0;
+    }
+    long long t0 = now_ns();
+    strobe_period_elapsed(strobe);
+    stats->ns += now_ns() - t0;
+  }
+
+  delete_strobe(strobe);
+}
+
+static double error_mhz(stats_t* stats, int note)
+{
+  if (stats->window_periods[note] == 0) return 0.0;
+  double frequency = stats->window_periods[note] * CLOCK / stats->window_counts[note];
+  return 1000.0 * (frequency - notes[note] - FREQUENCY_OFFSET);
+}
+
+static void usage(const char* name)
+{
+  fprintf(stderr, "usage: %s [-j jitter_hz]\n", name);
+  exit(1);
+}
+
+int main(int argc, char* argv[])
+{
+  int opt;
+
+  while ((opt = getopt(argc, argv, "j:")) != -1) {
+    switch (opt) {
+      case 'j': jitter = atof(optarg); break;
+      default: usage(argv[0]);
+    }
+  }
+  if (jitter < 0.0) usage(argv[0]);
+
+  stats_t stats[2];
+  memset(stats, 0, sizeof(stats));
+  run_restart(&stats[RESTART]);
+  run_strobe(&stats[STROBE]);
+
+  printf("Strobe: %.4f MHz clock, update every %.0f ms, pitch + %.1f Hz, pitch noise +/-%.2f Hz\n",
+         CLOCK * 1e-6, UPDATE_INTERVAL * 1000, FREQUENCY_OFFSET, jitter);
+  printf("Every note is held %.1f s, its error is measured after %.1f s\n\n", NOTE_SECONDS, SETTLE_SECONDS);
+  printf("%8s %7s %12s %12s %10s %10s\n", "pitch", "counts", "restart mHz", "strobe mHz", "restart gl", "strobe gl");
+
+  double worst[2] = { 0.0, 0.0 };
+  int glitches[2] = { 0, 0 };
+  for (int n = 0; n < NOTES; n++) {
+    for (int d = 0; d < 2; d++) {
+      if (fabs(error_mhz(&stats[d], n)) > worst[d]) worst[d] = fabs(error_mhz(&stats[d], n));
+      glitches[d] += stats[d].glitches[n];
+    }
+    printf("%8.2f %7.0f %12.1f %12.1f %10d %10d\n", notes[n], CLOCK / (notes[n] + FREQUENCY_OFFSET),
+           error_mhz(&stats[RESTART], n), error_mhz(&stats[STROBE], n), stats[RESTART].glitches[n],
+           stats[STROBE].glitches[n]);
+  }
+
+  printf("\n%-22s %10s %10s\n", "all", "restart", "strobe");
+  printf("%-22s %10ld %10ld\n", "periods", stats[RESTART].periods, stats[STROBE].periods);
+  printf("%-22s %10d %10d\n", "glitches", glitches[RESTART], glitches[STROBE]);
+  printf("%-22s %10.1f %10.1f\n", "worst error mHz", worst[RESTART], worst[STROBE]);
+  printf("%-22s %10s %10.1f\n", "ns per period", "-", (double) stats[STROBE].ns / stats[STROBE].periods);
+  return 0;
+}
@@ -0,0 +1,194 @@
+#!/usr/bin/env python3
+"""
+telemetry_decode.py
+
+Decodes a telemetry stream (telemetry.cpp) into CSV and numpy files.
+
+    python3 extras/telemetry_decode.py stream.bin [-o prefix]
+    python3 extras/telemetry_decode.py /dev/ttyACM0 [-o prefix]
+
+The input is a file, or a serial port already set to the sketch's speed
+(stty -F /dev/ttyACM0 115200 raw): a port is read until Ctrl-C.
+Records with a bad CRC are skipped, gaps in sequence numbers (records
+dropped by the sender or lost on the link) are counted.  Output files:
+
+    prefix_pitch.csv      sequence, time_us, frequency, power, confidence, peaks, dropped
+    prefix_peaks.csv      sequence, time_us, rank, index, frequency, power
+    prefix_frames.csv     sequence, time_us, start, step, count (one line per row of the .npy)
+    prefix_frames.npy     float32 array, one frame per row
+    prefix_spectra.csv    same as frames, for the spectra
+    prefix_spectra.npy    float32 array, one spectrum per row
+    prefix_text.txt       text records
+
+Rows of different lengths are padded with NaN.  The .npy files are written
+without numpy (format version 1.0): numpy.load() reads them.
+
+Author: Vincent Lacasse (lacasse4@yahoo.com)
+Date: 2026-10-18
+"""
+
+import argparse
+import os
+import struct
+import sys
+
+PITCH = 1                   # record types, must match telemetry.h
+PEAKS = 2
+FRAME = 3
+SPECTRUM = 4
+TEXT = 5
+
+HEADER = struct.Struct("<BHI")       # type, sequence, time (us)
+
+
+def crc16(data):
+    """CRC-16/CCITT-FALSE"""
+    crc = 0xFFFF
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else crc << 1
+        crc &= 0xFFFF
+    return crc
+
+
+def cobs_decode(data):
+    """decoded bytes of a COBS block (without the delimiter), or None if invalid"""
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        code = data[i]
+        if code == 0 or i + code > len(data):
+            return None
+        out += data[i + 1:i + code]
+        i += code
+        if code < 0xFF and i < len(data):
+            out.append(0)
+    return bytes(out)
+
+
+class Decoder:
+    def __init__(self):
+        self.pitch = []
+        self.peaks = []
+        self.peak_lists = 0
+        self.frames = []
+        self.spectra = []
+        self.text = []
+        self.records = 0
+        self.bad = 0
+        self.lost = 0
+        self.sequence = None
+        self.pending = bytearray()
+
+    def feed(self, data):
+        self.pending += data
+        while True:
+            end = self.pending.find(0)
+            if end < 0:
+                return
+            block = bytes(self.pending[:end])
+            del self.pending[:end + 1]
+            if block:
+                self.record(block)
+
+    def record(self, block):
+        raw = cobs_decode(block)
+        if raw is None or len(raw) < HEADER.size + 2 or \
+           crc16(raw[:-2]) != struct.unpack_from("<H", raw, len(raw) - 2)[0]:
+            self.bad += 1
+            return
+
+        kind, sequence, time = HEADER.unpack_from(raw)
+        payload = raw[HEADER.size:-2]
+        if self.sequence is not None:
+            self.lost += (sequence - self.sequence - 1) & 0xFFFF
+        self.sequence = sequence
+        self.records += 1
+
+        try:
+            self.parse(kind, sequence, time, payload)
+        except struct.error:
+            self.bad += 1
+
+    def parse(self, kind, sequence, time, payload):
+        if kind == PITCH:
+            frequency, power, confidence, peaks, dropped = struct.unpack("<fffHI", payload)
+            self.pitch.append((sequence, time, frequency, power, confidence, peaks, dropped))
+        elif kind == PEAKS:
+            self.peak_lists += 1
+            for rank in range(payload[0]):
+                index, frequency, power = struct.unpack_from("<Hff", payload, 1 + 10 * rank)
+                self.peaks.append((sequence, time, rank, index, frequency, power))
+        elif kind in (FRAME, SPECTRUM):
+            start, step, scale, count = struct.unpack_from("<fffH", payload)
+            values = struct.unpack_from("<%dh" % count, payload, 14)
+            row = ((sequence, time, start, step, count), [v / scale for v in values])
+            (self.frames if kind == FRAME else self.spectra).append(row)
+        elif kind == TEXT:
+            self.text.append(payload.decode("ascii", "replace"))
+
+
+def write_csv(path, header, rows):
+    with open(path, "w") as file:
+        file.write(",".join(header) + "\n")
+        for row in rows:
+            file.write(",".join("%.9g" % v if isinstance(v, float) else str(v) for v in row) + "\n")
+
+
+def write_npy(path, rows):
+    """write rows of floats as a 2-D float32 .npy file, padded with NaN"""
+    width = max(len(row) for row in rows)
+    header = "{'descr': '<f4', 'fortran_order': False, 'shape': (%d, %d), }" % (len(rows), width)
+    header += " " * (63 - (len(header) + 10) % 64) + "\n"
+    with open(path, "wb") as file:
+        file.write(b"\x93NUMPY\x01\x00" + struct.pack("<H", len(header)) + header.encode("ascii"))
+        for row in rows:
+            file.write(struct.pack("<%df" % width, *(row + [float("nan")] * (width - len(row)))))
+
+
+def write_arrays(prefix, name, rows):
+    if not rows:
+        return
+    write_csv("%s_%s.csv" % (prefix, name), ["sequence", "time_us", "start", "step", "count"],
+              [info for info, _ in rows])
+    write_npy("%s_%s.npy" % (prefix, name), [values for _, values in rows])
+
+
+def main():
+    parser = argparse.ArgumentParser(description="decode a Spectrum telemetry stream")
+    parser.add_argument("input", help="telemetry file or serial port")
+    parser.add_argument("-o", "--output", help="output prefix (default: input without extension)")
+    args = parser.parse_args()
+    prefix = args.output or os.path.splitext(os.path.basename(args.input))[0]
+
+    decoder = Decoder()
+    with open(args.input, "rb", buffering=0) as stream:
+        try:
+            while True:
+                data = stream.read(4096)
+                if not data:
+                    break
+                decoder.feed(data)
+        except KeyboardInterrupt:
+            pass
+
+    write_csv(prefix + "_pitch.csv",
+              ["sequence", "time_us", "frequency", "power", "confidence", "peaks", "dropped"], decoder.pitch)
+    write_csv(prefix + "_peaks.csv",
+              ["sequence", "time_us", "rank", "index", "frequency", "power"], decoder.peaks)
+    write_arrays(prefix, "frames", decoder.frames)
+    write_arrays(prefix, "spectra", decoder.spectra)
+    if decoder.text:
+        with open(prefix + "_text.txt", "w") as file:
+            file.write("\n".join(decoder.text) + "\n")
+
+    print("%d records: %d pitch, %d peak lists, %d frames, %d spectra, %d text" %
+          (decoder.records, len(decoder.pitch), decoder.peak_lists,
+           len(decoder.frames), len(decoder.spectra), len(decoder.text)))
+    print("%d bad records (CRC or format), %d lost (sequence gaps)" % (decoder.bad, decoder.lost))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
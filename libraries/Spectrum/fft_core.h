@@ -0,0 +1,435 @@
+/**
+ * fft_core.h
+ *
+ * Radix 2 FFT building blocks shared by the fixed point and real input FFTs.
+ * Internal to the Spectrum library.
+ *
+ * Author: Vincent Lacasse (lacasse4@yahoo.com)
+ * Date: 2026-10-18
+ * Target system: Arduino Due
+ *
+ */
+
+/*
+ * The algorithms are written once and instantiated for every sample type
+ * through a 'math' policy:
+ *   - floating_math<T>: plain arithmetic, the result is not scaled
+ *     (same scale as arduinoFFT)
+ *   - fixed_math<T, W, FRAC>: T holds FRAC fractional bits, products are
+ *     computed in the wider type W and every FFT stage scales its output
+ *     by 1/2 (half()) so that it can never overflow: the result is the
+ *     spectrum divided by the number of samples.
+ *
+ * Complex data is addressed as real[i * stride] and imag[i * stride] so
+ * that the same code handles split arrays (stride 1) and interleaved
+ * re/im pairs (stride 2).
+ *
+ * Twiddle factors are read from a quarter wave sine table when one is
+ * given: sine[m] = sin(2*pi*m/period) for m in [0, quarter], where
+ * quarter = period/4 and period is at least the FFT size.  Otherwise they
+ * are computed by rotation, once per group of butterflies.
+ */
+
+#ifndef _FFT_CORE_H
+#define _FFT_CORE_H
+
+#include <math.h>
+#include <stdint.h>
+#include <stddef.h>
+
+uint32_t isqrt32(uint32_t value);
+uint32_t isqrt64(uint64_t value);
+
+template <typename T>
+struct floating_math {
+  typedef T wide;
+
+  static T coefficient(double value) { return (T) value; }
+  static T multiply(T a, T b) { return a * b; }
+  static T dot(T w1, T a, T w2, T b) { return w1 * a + w2 * b; }
+  static T half(T value) { return value; }
+  static T mean(T a, T b) { return (a + b) * (T) 0.5; }
+  static T magnitude(T re, T im) { return sqrt(re * re + im * im); }
+  static int normalize(T* data, int length) { return 0; }
+  static double scale(int samples, int shift) { return 1.0; }
+
+  /**
+   * @brief replace a spectrum by its power (re^2 + im^2 in real, 0 in imag)
+   */
+  static void power(T* real, T* imag, int length) {
+    for (int i = 0; i < length; i++) {
+      real[i] = real[i] * real[i] + imag[i] * imag[i];
+      imag[i] = 0;
+    }
+  }
+};
+
+template <typename T, typename W, int FRAC>
+struct fixed_math {
+  typedef W wide;
+
+  /**
+   * @brief convert a real value in [-1.0, 1.0] to fixed point, with saturation
+   */
+  static W coefficient(double value) {
+    double scaled = floor(value * ((W) 1 << FRAC) + 0.5);
+    double largest = (double) (((W) 1 << FRAC) - 1);
+
+    if (scaled > largest) return (W) largest;
+    if (scaled < -largest) return (W) -largest;
+    return (W) scaled;
+  }
+  static T multiply(W a, T b) { return (T) ((a * b) >> FRAC); }
+  static W dot(W w1, T a, W w2, T b) { return (w1 * a + w2 * b) >> FRAC; }
+  static T half(W value) { return (T) (value >> 1); }
+  static W mean(W a, W b) { return (a + b) >> 1; }
+  static T magnitude(T re, T im);
+
+  /**
+   * @brief scale data up (block floating point) to use the available precision
+   * @returns the number of bits data was shifted left by
+   * @details the largest value is kept under half scale to leave headroom to the FFT
+   */
+  static int normalize(T* data, int length) {
+    W largest = 0;
+    int shift = 0;
+
+    for (int i = 0; i < length; i++) {
+      W value = data[i] < 0 ? -(W) data[i] : data[i];
+      if (value > largest) largest = value;
+    }
+
+    if (largest == 0) return 0;
+
+    while ((largest << (shift + 1)) < ((W) 1 << (FRAC - 1))) {
+      shift++;
+    }
+
+    for (int i = 0; i < length; i++) {
+      data[i] = (T) ((W) data[i] << shift);
+    }
+    return shift;
+  }
+
+  /**
+   * @brief factor bringing a spectrum of 'samples' normalized by 'shift' bits back to the floating point scale
+   */
+  static double scale(int samples, int shift) { return ldexp(samples, -shift); }
+
+  /**
+   * @brief replace a spectrum by its power (re^2 + im^2 in real, 0 in imag), within a constant factor
+   * @details the squares are kept in W and shifted right as a block so that
+   * @details the largest is under half scale: squared in T (multiply()),
+   * @details the bins of an FFT scaled by 1/N would mostly round to 0.
+   */
+  static void power(T* real, T* imag, int length) {
+    W largest = 0;
+    int shift = 0;
+
+    // each square halved: re^2 + im^2 could overflow W at full scale
+    for (int i = 0; i < length; i++) {
+      W value = (((W) real[i] * real[i]) >> 1) + (((W) imag[i] * imag[i]) >> 1);
+      if (value > largest) largest = value;
+    }
+
+    while ((largest >> shift) >= ((W) 1 << (FRAC - 1))) {
+      shift++;
+    }
+
+    for (int i = 0; i < length; i++) {
+      W value = (((W) real[i] * real[i]) >> 1) + (((W) imag[i] * imag[i]) >> 1);
+      real[i] = (T) (value >> shift);
+      imag[i] = 0;
+    }
+  }
+};
+
+template <>
+inline int16_t fixed_math<int16_t, int32_t, 15>::magnitude(int16_t re, int16_t im)
+{
+  uint32_t energy = (uint32_t) ((int32_t) re * re) + (uint32_t) ((int32_t) im * im);
+  uint32_t root = isqrt32(energy);
+  return root > INT16_MAX ? INT16_MAX : root;
+}
+
+template <>
+inline int32_t fixed_math<int32_t, int64_t, 31>::magnitude(int32_t re, int32_t im)
+{
+  uint64_t energy = (uint64_t) ((int64_t) re * re) + (uint64_t) ((int64_t) im * im);
+  uint32_t root = isqrt64(energy);
+  return root > INT32_MAX ? INT32_MAX : root;
+}
+
+typedef fixed_math<int16_t, int32_t, 15> q15_math;
+typedef fixed_math<int32_t, int64_t, 31> q31_math;
+
+/**
+ * @brief twiddle factor e^(-2i*pi*k/period) from a quarter wave sine table
+ * @param k in [0, period/2)
+ */
+template <typename W, typename T>
+inline void twiddle(const T* sine, int quarter, int k, W* c, W* s)
+{
+  if (k <= quarter) {
+    *c = sine[quarter - k];
+    *s = -(W) sine[k];
+  }
+  else {
+    *c = -(W) sine[k - quarter];
+    *s = -(W) sine[2 * quarter - k];
+  }
+}
+
+/**
+ * @brief in-place forward radix 2 complex FFT
+ * @param stride distance between two consecutive complex values
+ * @param sine quarter wave sine table (or NULL), see above
+ */
+template <typename M, typename T>
+void fft_complex(T* real, T* imag, int stride, int samples, const T* sine = NULL, int quarter = 0)
+{
+  typedef typename M::wide W;
+  T temp;
+  int power = 0;
+
+  while ((1 << power) < samples) power++;
+
+  // reverse bits
+  int j = 0;
+  for (int i = 0; i < samples - 1; i++) {
+    if (i < j) {
+      temp = real[i * stride]; real[i * stride] = real[j * stride]; real[j * stride] = temp;
+      temp = imag[i * stride]; imag[i * stride] = imag[j * stride]; imag[j * stride] = temp;
+    }
+    int k = samples >> 1;
+    while (k <= j) {
+      j -= k;
+      k >>= 1;
+    }
+    j += k;
+  }
+
+  // butterflies
+  for (int l = 0; l < power; l++) {
+    int l1 = 1 << l;
+    int l2 = l1 << 1;
+
+    // without a table, twiddle factor e^(-i*pi*j/l1) is rotated once per group
+    double c = sine ? 0.0 : cos(M_PI / l1);
+    double s = sine ? 0.0 : -sin(M_PI / l1);
+    double u1 = 1.0;
+    double u2 = 0.0;
+
+    // table index step for this stage
+    int step = sine ? (4 * quarter) / l2 : 0;
+
+    for (j = 0; j < l1; j++) {
+      W w1;
+      W w2;
+
+      if (sine) {
+        twiddle(sine, quarter, j * step, &w1, &w2);
+      }
+      else {
+        w1 = M::coefficient(u1);
+        w2 = M::coefficient(u2);
+
+        double z = u1 * c - u2 * s;
+        u2 = u1 * s + u2 * c;
+        u1 = z;
+      }
+
+      for (int i = j; i < samples; i += l2) {
+        T* r0 = &real[i * stride];
+        T* i0 = &imag[i * stride];
+        T* r1 = &real[(i + l1) * stride];
+        T* i1 = &imag[(i + l1) * stride];
+        W t1 = M::dot(w1, *r1, -w2, *i1);
+        W t2 = M::dot(w1, *i1, w2, *r1);
+        *r1 = M::half(*r0 - t1);
+        *i1 = M::half(*i0 - t2);
+        *r0 = M::half(*r0 + t1);
+        *i0 = M::half(*i0 + t2);
+      }
+    }
+  }
+}
+
+/**
+ * @brief in-place forward radix 2 complex FFTs of 'count' signals at once
+ * @param real, imag arrays of the 'count' signals' real and imaginary parts
+ * @param stride distance between two consecutive complex values
+ * @param sine quarter wave sine table (or NULL), see above
+ * @details same as fft_complex(), but every twiddle factor is computed (or 
+ * @details read) once for all the signals: its butterflies are applied to 
+ * @details each signal in turn.  fft_complex() is kept apart: the extra 
+ * @details loop costs a single signal a few percent.
+ */
+template <typename M, typename T>
+void fft_complex_batch(T** real, T** imag, int count, int stride, int samples, const T* sine = NULL, 
+                       int quarter = 0)
+{
+  typedef typename M::wide W;
+  T temp;
+  int power = 0;
+
+  while ((1 << power) < samples) power++;
+
+  // reverse bits
+  int j = 0;
+  for (int i = 0; i < samples - 1; i++) {
+    if (i < j) {
+      for (int n = 0; n < count; n++) {
+        T* re = real[n];
+        T* im = imag[n];
+        temp = re[i * stride]; re[i * stride] = re[j * stride]; re[j * stride] = temp;
+        temp = im[i * stride]; im[i * stride] = im[j * stride]; im[j * stride] = temp;
+      }
+    }
+    int k = samples >> 1;
+    while (k <= j) {
+      j -= k;
+      k >>= 1;
+    }
+    j += k;
+  }
+
+  // butterflies
+  for (int l = 0; l < power; l++) {
+    int l1 = 1 << l;
+    int l2 = l1 << 1;
+
+    // without a table, twiddle factor e^(-i*pi*j/l1) is rotated once per group
+    double c = sine ? 0.0 : cos(M_PI / l1);
+    double s = sine ? 0.0 : -sin(M_PI / l1);
+    double u1 = 1.0;
+    double u2 = 0.0;
+
+    // table index step for this stage
+    int step = sine ? (4 * quarter) / l2 : 0;
+
+    for (j = 0; j < l1; j++) {
+      W w1;
+      W w2;
+
+      if (sine) {
+        twiddle(sine, quarter, j * step, &w1, &w2);
+      }
+      else {
+        w1 = M::coefficient(u1);
+        w2 = M::coefficient(u2);
+
+        double z = u1 * c - u2 * s;
+        u2 = u1 * s + u2 * c;
+        u1 = z;
+      }
+
+      for (int n = 0; n < count; n++) {
+        T* re = real[n];
+        T* im = imag[n];
+
+        for (int i = j; i < samples; i += l2) {
+          T* r0 = &re[i * stride];
+          T* i0 = &im[i * stride];
+          T* r1 = &re[(i + l1) * stride];
+          T* i1 = &im[(i + l1) * stride];
+          W t1 = M::dot(w1, *r1, -w2, *i1);
+          W t2 = M::dot(w1, *i1, w2, *r1);
+          *r1 = M::half(*r0 - t1);
+          *i1 = M::half(*i0 - t2);
+          *r0 = M::half(*r0 + t1);
+          *i0 = M::half(*i0 + t2);
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief in-place FFT of a real signal, returns the magnitude spectrum
+ * @param data 'samples' real values, replaced by 'bins' magnitudes
+ * @details the signal is seen as samples/2 complex values (even samples are
+ * @details the real parts, odd samples the imaginary parts).  After a half
+ * @details size complex FFT, a split step rebuilds the spectrum of the real
+ * @details signal.  Bins above samples/2 (not computed) are set to 0.
+ * @param sine quarter wave sine table (or NULL), see above
+ */
+template <typename M, typename T>
+void fft_real_split(T* data, int samples, int bins, const T* sine = NULL, int quarter = 0);
+
+template <typename M, typename T>
+void fft_real_magnitude(T* data, int samples, int bins, const T* sine = NULL, int quarter = 0)
+{
+  fft_complex<M, T>(data, data + 1, 2, samples >> 1, sine, quarter);
+  fft_real_split<M, T>(data, samples, bins, sine, quarter);
+}
+
+/**
+ * @brief second half of fft_real_magnitude(): split step and magnitude, once
+ * @brief the half size complex FFT of 'data' was computed (fft_complex_batch()
+ * @brief computes several at once)
+ */
+template <typename M, typename T>
+void fft_real_split(T* data, int samples, int bins, const T* sine, int quarter)
+{
+  typedef typename M::wide W;
+  int half = samples >> 1;
+  int step = sine ? (4 * quarter) / samples : 0;
+
+  // split step, X[0] and X[half] are both real: they share the first pair
+  T a = data[0];
+  T b = data[1];
+  data[0] = M::half((W) a + b);
+  data[1] = M::half((W) a - b);
+
+  // without a table, twiddle factor e^(-2i*pi*k/samples) is rotated once per pair
+  double c = sine ? 0.0 : cos(2.0 * M_PI / samples);
+  double s = sine ? 0.0 : -sin(2.0 * M_PI / samples);
+  double u1 = c;
+  double u2 = s;
+
+  for (int k = 1; k <= (half >> 1); k++) {
+    T* zk = &data[2 * k];
+    T* zm = &data[2 * (half - k)];
+    W w1;
+    W w2;
+
+    if (sine) {
+      twiddle(sine, quarter, k * step, &w1, &w2);
+    }
+    else {
+      w1 = M::coefficient(u1);
+      w2 = M::coefficient(u2);
+
+      double z = u1 * c - u2 * s;
+      u2 = u1 * s + u2 * c;
+      u1 = z;
+    }
+
+    // even (e) and odd (o) samples spectra
+    W er = M::mean(zk[0], zm[0]);
+    W ei = M::mean(zk[1], -(W) zm[1]);
+    W orl = M::mean(zk[1], zm[1]);
+    W oim = M::mean(zm[0], -(W) zk[0]);
+
+    // w * o
+    W wor = M::dot(w1, (T) orl, -w2, (T) oim);
+    W woi = M::dot(w1, (T) oim, w2, (T) orl);
+
+    zk[0] = M::half(er + wor);
+    zk[1] = M::half(ei + woi);
+    zm[0] = M::half(er - wor);
+    zm[1] = M::half(woi - ei);
+  }
+
+  // magnitude, written in place (bin k overwrites data already consumed)
+  data[0] = data[0] < 0 ? -data[0] : data[0];
+  for (int k = 1; k < half && k < bins; k++) {
+    data[k] = M::magnitude(data[2 * k], data[2 * k + 1]);
+  }
+  for (int k = half; k < bins; k++) {
+    data[k] = 0;
+  }
+}
+
+#endif
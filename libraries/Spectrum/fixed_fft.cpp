@@ -0,0 +1,87 @@
+/**
+ * fixed_fft.cpp
+ *
+ * Fixed point (Q15 and Q31) FFT
+ *
+ * Author: Vincent Lacasse (lacasse4@yahoo.com)
+ * Date: 2026-10-18
+ * Target system: Arduino Due
+ *
+ */
+
+/*
+ * The Due's Cortex-M3 has no FPU: every double (or float) operation is
+ * done in software.  These functions do the same work as arduinoFFT with
+ * integer arithmetic only.  Q15 samples use 32 bit products, Q31 samples
+ * use 64 bit products (a single SMULL instruction on the M3).
+ *
+ * The FFT scales its output by 1/2 at each stage so that it can never
+ * overflow: the result is the true spectrum divided by the number of samples
+ * (see fft_core.h).
+ */
+
+#include <math.h>
+#include "fixed_fft.h"
+#include "fft_core.h"
+
+/*
+ * Q15 entry points
+ */
+void fft_q15(q15_t* real, q15_t* imag, int samples)
+{
+  fft_complex<q15_math>(real, imag, 1, samples);
+}
+
+/*
+ * Q31 entry points
+ */
+void fft_q31(q31_t* real, q31_t* imag, int samples)
+{
+  fft_complex<q31_math>(real, imag, 1, samples);
+}
+
+/**
+ * @brief integer square root (rounded down)
+ */
+uint32_t isqrt32(uint32_t value)
+{
+  uint32_t root = 0;
+  uint32_t bit = 1UL << 30;
+
+  while (bit > value) bit >>= 2;
+
+  while (bit != 0) {
+    if (value >= root + bit) {
+      value -= root + bit;
+      root = (root >> 1) + bit;
+    }
+    else {
+      root >>= 1;
+    }
+    bit >>= 2;
+  }
+  return root;
+}
+
+/**
+ * @brief integer square root of a 64 bit value (rounded down)
+ */
+uint32_t isqrt64(uint64_t value)
+{
+  uint64_t root = 0;
+  uint64_t bit = 1ULL << 62;
+
+  while (bit > value) bit >>= 2;
+
+  while (bit != 0) {
+    if (value >= root + bit) {
+      value -= root + bit;
+      root = (root >> 1) + bit;
+    }
+    else {
+      root >>= 1;
+    }
+    bit >>= 2;
+  }
+  return (uint32_t) root;
+}
@@ -0,0 +1,27 @@
+/**
+ * fixed_fft.h
+ * 
+ * Fixed point (Q15 and Q31) FFT
+ * 
+ * Author: Vincent Lacasse (lacasse4@yahoo.com)
+ * Date: 2026-10-18
+ * Target system: Arduino Due
+ * 
+ */
+
+#ifndef _FIXED_FFT_H
+#define _FIXED_FFT_H
+
+#include <stdint.h>
+#include "arduinoFFT.h"
+
+typedef int16_t q15_t;
+typedef int32_t q31_t;
+
+void fft_q15(q15_t* real, q15_t* imag, int samples);
+void fft_q31(q31_t* real, q31_t* imag, int samples);
+
+uint32_t isqrt32(uint32_t value);
+uint32_t isqrt64(uint64_t value);
+
+#endif
@@ -0,0 +1,223 @@
+/**
+ * gate.cpp
+ *
+ * C module gating the pitch pipeline: a level gate (block RMS with
+ * hysteresis) and a spectral flux onset detector
+ *
+ * Author: Vincent Lacasse (lacasse4@yahoo.com)
+ * Date: 2026-10-18
+ * Target system: Arduino Due
+ *
+ */
+
+/*
+ * Samples are analyzed in blocks of GATE_BLOCK (16 ms at 4000 Hz):
+ *
+ *   level  RMS of the block around its mean.  The gate opens at the open
+ *          level (or on an onset) and closes once the level stayed under
+ *          the close level for GATE_HOLD_BLOCKS blocks: a note's decay
+ *          keeps it open, silence closes it.
+ *   flux   sum of the magnitude increases of the block's spectrum over
+ *          the previous block's (Q15 real FFT, const sine table).  An onset
+ *          is a flux above both GATE_ONSET_RATIO times its running mean and
+ *          GATE_ONSET_FLUX; a new attack shows there even when the level
+ *          barely changes (a note played over a ringing one).
+ *
+ * Levels and flux are in ADC units (a sine of amplitude A has a level of
+ * A/sqrt(2) and a flux of A on its onset).  The pitch pipeline skips its
+ * frames while the gate is closed, and takes one 'delay' samples after an
+ * onset instead of waiting for its next hop (see schedule_frame()).
+ */
+
+#include <stdlib.h>
+#include <math.h>
+#include "gate.h"
+#include "spectrum.h"
+#include "fixed_fft.h"
+#include "fft_core.h"
+#include "tables.h"
+
+struct gate {
+    int shift;                         // ADC units to Q15 (15 - resolution, headroom for the mean)
+    int block[GATE_BLOCK];             // samples of the current block
+    int count;                         // samples in the current block
+    q15_t data[GATE_BLOCK];            // FFT input, then magnitudes
+    q15_t previous[GATE_BLOCK / 2];    // previous block's magnitudes
+    int primed;                        // previous holds a block
+
+    double open_level;                 // see set_gate_levels()
+    double close_level;
+    double onset_ratio;
+    double onset_flux;
+
+    double level;                      // latest block RMS (ADC units)
+    double flux;                       // latest block flux (ADC units)
+    double mean_flux;                  // running mean of the flux
+    int open;                          // gate state
+    int hold;                          // blocks left before the gate closes
+    int refractory;                    // blocks left before another onset
+    int onset;                         // samples since an untaken onset, -1 if none
+};
+
+/**
+ * @brief create a gate
+ * @param adc_resolution bits of the samples given to add_gate_sample()
+ * @returns the gate, or NULL if out of memory or if the resolution is not 8 to 15 bits
+ */
+gate_t* create_gate(int adc_resolution)
+{
+  if (adc_resolution < 8 || adc_resolution > 15) return NULL;
+
+  gate_t* gate = (gate_t*) malloc(sizeof(gate_t));
+  if (gate == NULL) return NULL;
+
+  gate->shift = 15 - adc_resolution;
+  gate->open_level = GATE_OPEN_LEVEL;
+  gate->close_level = GATE_CLOSE_LEVEL;
+  gate->onset_ratio = GATE_ONSET_RATIO;
+  gate->onset_flux = GATE_ONSET_FLUX;
+  reset_gate(gate);
+  return gate;
+}
+
+/**
+ * @brief release gate resources
+ */
+void delete_gate(gate_t* gate)
+{
+  free(gate);
+}
+
+/**
+ * @brief set the gate levels (GATE_OPEN_LEVEL, GATE_CLOSE_LEVEL,
+ * @brief GATE_ONSET_RATIO and GATE_ONSET_FLUX by default)
+ * @returns 1 if OK, 0 if a level is out of range (levels are unchanged)
+ */
+int set_gate_levels(gate_t* gate, double open_level, double close_level, double onset_ratio,
+                    double onset_flux)
+{
+  if (close_level < 0.0 || open_level < close_level || onset_ratio < 1.0 || onset_flux < 0.0) {
+    return 0;
+  }
+  gate->open_level = open_level;
+  gate->close_level = close_level;
+  gate->onset_ratio = onset_ratio;
+  gate->onset_flux = onset_flux;
+  return 1;
+}
+
+/**
+ * @brief close the gate and forget the past blocks
+ */
+void reset_gate(gate_t* gate)
+{
+  gate->count = 0;
+  gate->primed = 0;
+  gate->level = 0.0;
+  gate->flux = 0.0;
+  gate->mean_flux = 0.0;
+  gate->open = 0;
+  gate->hold = 0;
+  gate->refractory = 0;
+  gate->onset = -1;
+}
+
+/**
+ * @brief level and spectral flux of a complete block
+ */
+static void analyze_block(gate_t* gate)
+{
+  int32_t sum = 0;
+  for (int i = 0; i < GATE_BLOCK; i++) sum += gate->block[i];
+  int mean = sum / GATE_BLOCK;
+
+  // level, and Q15 input (saturated) for the flux
+  double energy = 0.0;
+  for (int i = 0; i < GATE_BLOCK; i++) {
+    int value = gate->block[i] - mean;
+    energy += (double) value * value;
+
+    int32_t q = (int32_t) value << gate->shift;
+    gate->data[i] = q > INT16_MAX ? INT16_MAX : (q < -INT16_MAX ? -INT16_MAX : q);
+  }
+  gate->level = sqrt(energy / GATE_BLOCK);
+
+  // the real FFT scales a sine of amplitude A (ADC units) to a bin of A/2 (Q15)
+  fft_real_magnitude<q15_math, q15_t>(gate->data, GATE_BLOCK, GATE_BLOCK / 2,
+                                      (const q15_t*) find_const_sine_table(SAMPLE_Q15),
+                                      CONST_SINE_PERIOD / 4);
+  int32_t increase = 0;
+  for (int k = 1; k < GATE_BLOCK / 2; k++) {
+    if (gate->primed && gate->data[k] > gate->previous[k]) increase += gate->data[k] - gate->previous[k];
+    gate->previous[k] = gate->data[k];
+  }
+  gate->flux = ldexp((double) increase, 1 - gate->shift);
+  gate->primed = 1;
+}
+
+/**
+ * @brief update the gate state after a block
+ */
+static void update_gate(gate_t* gate)
+{
+  int onset = gate->primed && gate->refractory == 0 && gate->flux >= gate->onset_flux &&
+              gate->flux > gate->onset_ratio * gate->mean_flux;
+
+  gate->mean_flux += GATE_FLUX_ALPHA * (gate->flux - gate->mean_flux);
+  if (gate->refractory > 0) gate->refractory--;
+
+  if (onset) {
+    gate->onset = 0;
+    gate->refractory = GATE_REFRACTORY;
+  }
+
+  if (onset || gate->level >= gate->open_level) {
+    gate->open = 1;
+    gate->hold = GATE_HOLD_BLOCKS;
+  }
+  else if (gate->level < gate->close_level && gate->open) {
+    if (--gate->hold <= 0) gate->open = 0;
+  }
+}
+
+/**
+ * @brief add a sample (ADC value) to the gate
+ * @details the level and flux are updated every GATE_BLOCK samples
+ */
+void add_gate_sample(gate_t* gate, int sample)
+{
+  if (gate->onset >= 0) gate->onset++;
+
+  gate->block[gate->count++] = sample;
+  if (gate->count < GATE_BLOCK) return;
+
+  gate->count = 0;
+  analyze_block(gate);
+  update_gate(gate);
+}
+
+/**
+ * @brief return true while a note is sounding
+ */
+int is_gate_open(gate_t* gate)
+{
+  return gate->open;
+}
+
+/**
+ * @brief take the latest onset
+ * @returns the number of samples added since the onset (its block's last
+ * @returns sample), or -1 if there was none since the last call
+ */
+int take_onset(gate_t* gate)
+{
+  int onset = gate->onset;
+  gate->onset = -1;
+  return onset;
+}
+
+/**
+ * @brief getters
+ */
+double get_gate_level(gate_t* gate) { return gate->level; }
+double get_gate_flux(gate_t* gate)  { return gate->flux; }
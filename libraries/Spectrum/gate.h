@@ -0,0 +1,39 @@
+/**
+ * gate.h
+ *
+ * C module gating the pitch pipeline: a level gate (block RMS with
+ * hysteresis) and a spectral flux onset detector
+ *
+ * Author: Vincent Lacasse (lacasse4@yahoo.com)
+ * Date: 2026-10-18
+ * Target system: Arduino Due
+ *
+ */
+
+#ifndef _GATE_H
+#define _GATE_H
+
+#define GATE_BLOCK          64      // samples per level and flux block (a power of 2)
+#define GATE_OPEN_LEVEL     8.0     // block RMS (ADC units) that opens the gate
+#define GATE_CLOSE_LEVEL    4.0     // block RMS under which the gate closes, after the hold
+#define GATE_HOLD_BLOCKS    32      // blocks the gate stays open under the close level
+#define GATE_ONSET_RATIO    3.0     // flux over the mean flux for an onset
+#define GATE_ONSET_FLUX     40.0    // lowest flux of an onset (ADC units)
+#define GATE_FLUX_ALPHA     0.05    // mean flux smoothing (per block)
+#define GATE_REFRACTORY     8       // blocks after an onset without another one
+
+typedef struct gate gate_t;
+
+gate_t* create_gate(int adc_resolution);
+void delete_gate(gate_t* gate);
+int set_gate_levels(gate_t* gate, double open_level, double close_level, double onset_ratio,
+                    double onset_flux);
+void reset_gate(gate_t* gate);
+
+void add_gate_sample(gate_t* gate, int sample);
+int is_gate_open(gate_t* gate);
+int take_onset(gate_t* gate);
+double get_gate_level(gate_t* gate);
+double get_gate_flux(gate_t* gate);
+
+#endif
@@ -0,0 +1,251 @@
+/**
+ * multires.cpp
+ *
+ * C module for multi-resolution pitch detection: one window length per
+ * octave band, all reading the same ring of samples
+ *
+ * Author: Vincent Lacasse (lacasse4@yahoo.com)
+ * Date: 2026-10-18
+ * Target system: Arduino Due
+ *
+ */
+
+/*
+ * A single window is a compromise: 1024 samples at 4000 Hz resolve 40 Hz
+ * well but take 256 ms to fill, far longer than a 800 Hz note needs.
+ * Here, band 0 (the lowest) uses the full length and every band above it
+ * covers the next octave with half the window of the band below: the
+ * relative resolution is the same in every band (constant Q), and the
+ * latency of a band is proportional to its period.  With 4 bands of
+ * 1024 to 128 samples from 40 to 900 Hz:
+ *
+ *   band  window  hop   frequencies
+ *   0     1024    256    40 - 112.5 Hz
+ *   1      512    128   112.5 - 225 Hz
+ *   2      256     64   225 - 450 Hz
+ *   3      128     32   450 - 900 Hz
+ *
+ * Band 0's signal holds the only ring: the other bands copy their latest
+ * samples from it (load_latest_frame_from()).  Every band searches the
+ * whole frequency range (its harmonics and sub-harmonics help), but keeps
+ * a fundamental only within its own octave.  The fundamental is that of the
+ * highest band that has one (the most recent estimate, at the resolution
+ * its octave needs) unless it is a harmonic of a lower band's fundamental.
+ * The peak power threshold of a band is scaled to its window length
+ * (spectrum magnitudes grow with the length).
+ */
+
+#include <stdlib.h>
+#include <math.h>
+#include "multires.h"
+
+typedef struct band {
+    signal_t* signal;            // band's window, no ring except band 0's
+    double low_frequency;        // lowest fundamental kept by the band
+    double high_frequency;       // highest fundamental kept by the band
+    int hop;                     // samples between two frames
+    int pending;                 // samples added since the last frame
+    peak_t fundamental;          // latest fundamental within the band (index -1 if none)
+} band_t;
+
+struct multires {
+    int bands;                   // number of bands
+    band_t band[MULTIRES_MAX_BANDS];
+    int length;                  // band 0's window length
+    double low_frequency;        // searched frequency range
+    double high_frequency;
+    int count;                   // samples in the ring (up to length)
+    int selected;                // band of the fundamental, -1 if none
+};
+
+/**
+ * @brief create a multi-resolution analysis
+ * @param bands number of octave bands, 1 to MULTIRES_MAX_BANDS
+ * @param length window length of band 0 (the lowest band), a power of 2;
+ * @param length each band above uses half the window of the band below
+ * @param low_frequency, high_frequency searched frequency range (Hz)
+ * @returns the analysis, or NULL if out of memory or if the bands do not fit
+ * @details the highest band covers [high_frequency / 2, high_frequency],
+ * @details each band below the octave under it, band 0 goes down to
+ * @details low_frequency.  Its window must be at least MULTIRES_MIN_LENGTH.
+ * @details The signals use zero padding and the default window;
+ * @details get_band_signal() gives access to their settings.
+ */
+multires_t* create_multires(int bands, int length, double sampling_frequency, double low_frequency,
+                            double high_frequency, int sample_type)
+{
+  if (bands < 1 || bands > MULTIRES_MAX_BANDS || (length >> (bands - 1)) < MULTIRES_MIN_LENGTH ||
+      low_frequency <= 0.0 || high_frequency <= low_frequency * (1 << (bands - 1)) ||
+      high_frequency > sampling_frequency / 2) {
+    return NULL;
+  }
+
+  multires_t* multires = (multires_t*) malloc(sizeof(multires_t));
+  if (multires == NULL) return NULL;
+
+  multires->bands = 0;
+  multires->length = length;
+  multires->low_frequency = low_frequency;
+  multires->high_frequency = high_frequency;
+
+  for (int b = 0; b < bands; b++) {
+    band_t* band = &multires->band[b];
+    int band_length = length >> b;
+
+    band->signal = create_signal(band_length, sampling_frequency, ZERO_PADDING_ENABLED, sample_type);
+    if (band->signal == NULL) {
+      delete_multires(multires);
+      return NULL;
+    }
+    multires->bands++;
+
+    band->high_frequency = high_frequency / (1 << (bands - 1 - b));
+    band->low_frequency = b == 0 ? low_frequency : band->high_frequency / 2;
+    band->hop = band_length / MULTIRES_HOP_DIVIDER;
+    set_peak_thresholds(band->signal, LOWEST_PEAK_POWER * band_length / length, HIGHEST_RATIO,
+                        SEARCH_WINDOW);
+  }
+
+  if (!enable_streaming(multires->band[0].signal, multires->band[0].hop)) {
+    delete_multires(multires);
+    return NULL;
+  }
+
+  reset_multires(multires);
+  return multires;
+}
+
+/**
+ * @brief release multi-resolution analysis resources
+ */
+void delete_multires(multires_t* multires)
+{
+  for (int b = 0; b < multires->bands; b++) {
+    delete_signal(multires->band[b].signal);
+  }
+  free(multires);
+}
+
+/**
+ * @brief getters
+ */
+int get_band_count(multires_t* multires)                           { return multires->bands; }
+signal_t* get_band_signal(multires_t* multires, int band)          { return multires->band[band].signal; }
+double get_band_low_frequency(multires_t* multires, int band)      { return multires->band[band].low_frequency; }
+double get_band_high_frequency(multires_t* multires, int band)     { return multires->band[band].high_frequency; }
+int get_multires_band(multires_t* multires)                        { return multires->selected; }
+
+/**
+ * @brief empty the ring and forget the fundamentals
+ */
+void reset_multires(multires_t* multires)
+{
+  erase_signal(multires->band[0].signal);
+  multires->count = 0;
+  multires->selected = -1;
+
+  for (int b = 0; b < multires->bands; b++) {
+    multires->band[b].pending = 0;
+    erase_peak(&multires->band[b].fundamental);
+  }
+}
+
+/**
+ * @brief add a sample to the ring shared by the bands
+ */
+void add_multires_sample(multires_t* multires, int sample)
+{
+  add_sample(multires->band[0].signal, sample);
+  if (multires->count < multires->length) multires->count++;
+
+  for (int b = 0; b < multires->bands; b++) {
+    multires->band[b].pending++;
+  }
+}
+
+/**
+ * @brief analyze the latest frame of a band
+ */
+static void process_band(multires_t* multires, band_t* band)
+{
+  signal_t* signal = band->signal;
+
+  band->pending = 0;
+  load_latest_frame_from(signal, multires->band[0].signal);
+  remove_bias(signal);
+  compute_spectrum(signal);
+  compute_peak_list(signal, multires->low_frequency, multires->high_frequency);
+
+  band->fundamental = find_fundamental_frequency(get_peak_list(signal));
+  if (band->fundamental.index != -1 && (band->fundamental.frequency < band->low_frequency ||
+                                        band->fundamental.frequency >= band->high_frequency)) {
+    erase_peak(&band->fundamental);
+  }
+}
+
+/**
+ * @brief true if a band below holds a fundamental of which band's fundamental is a harmonic
+ * @details a short window resolves a low note's upper harmonics better than
+ * @details its fundamental: the longer windows below decide then.
+ */
+static int is_lower_harmonic(multires_t* multires, int band)
+{
+  double frequency = multires->band[band].fundamental.frequency;
+
+  for (int b = 0; b < band; b++) {
+    peak_t* lower = &multires->band[b].fundamental;
+    if (lower->index == -1) continue;
+
+    double ratio = frequency / lower->frequency;
+    double harmonic = round(ratio);
+    if (harmonic >= 2.0 && fabs(ratio - harmonic) < MULTIRES_HARMONIC_TOLERANCE * harmonic) return 1;
+  }
+  return 0;
+}
+
+/**
+ * @brief analyze every band whose frame is due
+ * @returns the number of bands analyzed (0: the fundamental is unchanged)
+ * @details a band's frame is due every 'hop' samples once the ring holds a
+ * @details window of the band: the highest band gives its first frame after
+ * @details length / 2^(bands-1) samples.  Frames a band fell behind on are
+ * @details dropped (see load_latest_frame()).
+ */
+int update_multires(multires_t* multires)
+{
+  int processed = 0;
+
+  for (int b = multires->bands - 1; b >= 0; b--) {
+    band_t* band = &multires->band[b];
+    if (band->pending >= band->hop && multires->count >= get_length(band->signal)) {
+      process_band(multires, band);
+      processed++;
+    }
+  }
+  if (processed == 0) return 0;
+
+  // the highest band with a fundamental has the most recent one
+  multires->selected = -1;
+  for (int b = multires->bands - 1; b >= 0; b--) {
+    if (multires->band[b].fundamental.index != -1 && !is_lower_harmonic(multires, b)) {
+      multires->selected = b;
+      break;
+    }
+  }
+  return processed;
+}
+
+/**
+ * @brief return the fundamental (index -1 if none)
+ * @details its index is a bin of the band's spectrum (see get_multires_band())
+ */
+peak_t get_multires_fundamental(multires_t* multires)
+{
+  peak_t none;
+
+  if (multires->selected == -1) {
+    erase_peak(&none);
+    return none;
+  }
+  return multires->band[multires->selected].fundamental;
+}
@@ -0,0 +1,40 @@
+/**
+ * multires.h
+ *
+ * C module for multi-resolution pitch detection: one window length per
+ * octave band, all reading the same ring of samples
+ *
+ * Author: Vincent Lacasse (lacasse4@yahoo.com)
+ * Date: 2026-10-18
+ * Target system: Arduino Due
+ *
+ */
+
+#ifndef _MULTIRES_H
+#define _MULTIRES_H
+
+#include "spectrum.h"
+
+#define MULTIRES_MAX_BANDS    4       // at most 4 octave bands
+#define MULTIRES_MIN_LENGTH   64      // shortest band window (samples)
+#define MULTIRES_HOP_DIVIDER  4       // a band's hop is its length / 4 (75% overlap)
+#define MULTIRES_HARMONIC_TOLERANCE 0.03  // relative distance to a harmonic of a lower band
+
+typedef struct multires multires_t;
+
+multires_t* create_multires(int bands, int length, double sampling_frequency, double low_frequency,
+                            double high_frequency, int sample_type = SAMPLE_DOUBLE);
+void delete_multires(multires_t* multires);
+
+int get_band_count(multires_t* multires);
+signal_t* get_band_signal(multires_t* multires, int band);
+double get_band_low_frequency(multires_t* multires, int band);
+double get_band_high_frequency(multires_t* multires, int band);
+
+void add_multires_sample(multires_t* multires, int sample);
+int update_multires(multires_t* multires);
+peak_t get_multires_fundamental(multires_t* multires);
+int get_multires_band(multires_t* multires);
+void reset_multires(multires_t* multires);
+
+#endif
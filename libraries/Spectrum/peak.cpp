@@ -18,4 +18,5 @@ void erase_peak(peak_t* peak) {
     peak->index = -1;
     peak->frequency = 0.0;
     peak->power = 0.0;
+    peak->confidence = 0.0;
 };
\ No newline at end of file
@@ -16,6 +16,7 @@ typedef struct peak {
     int index;            // peak index in signal array
     double frequency;     // peak frequency
     double power;         // peak power
+    double confidence;    // estimator confidence in [0, 1] (see estimate_fundamental)
 
     double p[5];
     double early_freq;
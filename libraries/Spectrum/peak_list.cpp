@@ -14,11 +14,24 @@
 #include "peak_list.h"
 #include "peak.h"
 
+/*
+ * Fundamental frequency tracker (alpha-beta filter), kept from frame to frame
+ */
+typedef struct tracker {
+    int enabled;                 // tracking is done only if enabled
+    int confidence;              // number of consistent frames (up to TRACK_CONFIDENCE)
+    double frequency;            // filtered fundamental frequency
+    double rate;                 // fundamental frequency change per frame
+} tracker_t;
+
 struct peak_list  {
     int n_peak;                  // number of peak found in signal
     peak_t peak[PEAK_NUMBER];    // list of peaks found
+    tracker_t tracker;           // not erased by erase_peak_list()
 };
 
+static_assert(sizeof(peak_list_t) <= PEAK_LIST_STATE_SIZE, "PEAK_LIST_STATE_SIZE is too small");
+
 /**
  * @brief create at peak list
  */
@@ -27,7 +40,21 @@ peak_list_t* create_peak_list()
   peak_list_t* list = (peak_list_t*) malloc(sizeof(peak_list_t));
   if (list == NULL) return NULL;
 
+  return create_peak_list_at(list);
+}
+
+/**
+ * @brief create a peak list in caller provided storage (no heap)
+ * @param storage PEAK_LIST_STATE_SIZE bytes, 8 byte aligned, that outlive the list
+ * @details such a list must not be deleted with delete_peak_list()
+ */
+peak_list_t* create_peak_list_at(void* storage)
+{
+  peak_list_t* list = (peak_list_t*) storage;
+
   erase_peak_list(list);
+  list->tracker.enabled = 0;
+  reset_tracking(list);
   return list;
 }
 
@@ -41,6 +68,7 @@ void delete_peak_list(peak_list_t* list)
 
 /**
  * @brief erase the peak list
+ * @details the tracker state is kept
  */
 void erase_peak_list(peak_list_t* list) 
 {
@@ -80,6 +108,18 @@ peak_t get_peak(peak_list_t* list, int index)
   return list->peak[index];
 }
 
+/**
+ * @brief replace the peak at index
+ * @param index index of a peak of the list
+ * @return 1 if OK, 0 if index is outside the list
+ */
+int set_peak(peak_list_t* list, int index, peak_t* peak) 
+{
+  if (index < 0 || index >= list->n_peak) return 0;
+  list->peak[index] = *peak;
+  return 1;
+}
+
 /**
  * @brief find the fundamental frequency (if it exists) from the peak list
  * @param list  the peak list into which the fundamental is sought
@@ -115,3 +155,83 @@ peak_t find_fundamental_frequency(peak_list_t* list)
 
   return not_found;
 }
+
+/**
+ * @brief enable or disable fundamental frequency tracking (disabled by default)
+ * @details when tracking is locked, compute_peak_list() only searches narrow
+ * @details windows around the predicted fundamental and its harmonics and the
+ * @details fundamental's frequency is smoothed by an alpha-beta filter.
+ */
+void enable_tracking(peak_list_t* list, int enabled)
+{
+  list->tracker.enabled = enabled;
+  reset_tracking(list);
+}
+
+/**
+ * @brief forget the tracked fundamental
+ */
+void reset_tracking(peak_list_t* list)
+{
+  list->tracker.confidence = 0;
+  list->tracker.frequency = 0.0;
+  list->tracker.rate = 0.0;
+}
+
+/**
+ * @brief return true if the tracked fundamental is trusted (search can be narrowed)
+ */
+int is_tracking(peak_list_t* list)
+{
+  return list->tracker.enabled && list->tracker.confidence >= TRACK_LOCK;
+}
+
+/**
+ * @brief return the fundamental frequency expected in the next frame
+ */
+double get_predicted_frequency(peak_list_t* list)
+{
+  return list->tracker.frequency + list->tracker.rate;
+}
+
+/**
+ * @brief update the tracker with the fundamental of the peak list
+ * @details to be called once the list is complete (see compute_peak_list()).
+ * @details A fundamental close to the prediction raises confidence and 
+ * @details updates the filter, any other fundamental restarts tracking from it.
+ * @details No fundamental halves the confidence.
+ * @details Once locked, the filtered frequency replaces the fundamental's.
+ */
+void update_tracking(peak_list_t* list)
+{
+  tracker_t* tracker = &list->tracker;
+  peak_t measured;
+  double predicted;
+  double residual;
+
+  if (!tracker->enabled) return;
+
+  measured = find_fundamental_frequency(list);
+  if (measured.index == -1) {
+    tracker->confidence /= 2;
+    if (tracker->confidence == 0) reset_tracking(list);
+    return;
+  }
+
+  predicted = get_predicted_frequency(list);
+  if (tracker->confidence > 0 && fabs(measured.frequency - predicted) < predicted * TRACK_WINDOW) {
+    residual = measured.frequency - predicted;
+    tracker->frequency = predicted + TRACK_ALPHA * residual;
+    tracker->rate += TRACK_BETA * residual;
+    if (tracker->confidence < TRACK_CONFIDENCE) tracker->confidence++;
+  }
+  else {
+    tracker->frequency = measured.frequency;
+    tracker->rate = 0.0;
+    tracker->confidence = 1;
+  }
+
+  if (tracker->confidence >= TRACK_LOCK) {
+    list->peak[list->n_peak - 1].frequency = tracker->frequency;
+  }
+}
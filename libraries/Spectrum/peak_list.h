@@ -16,17 +16,35 @@
 #define LOWEST_PEAK_POWER 1000   // lowest peak power considered in peak search
 #define SMALL_REMAINDER   0.05   // remainder used to validate a GCD 
 
+#define TRACK_ALPHA       0.5    // alpha-beta filter: frequency gain
+#define TRACK_BETA        0.1    // alpha-beta filter: frequency rate gain
+#define TRACK_LOCK        3      // confidence needed to search around the tracked pitch only
+#define TRACK_CONFIDENCE  8      // highest confidence
+#define TRACK_WINDOW      0.03   // relative search window around predicted frequencies
+#define TRACK_BINS        2      // smallest search half window (spectrum bins)
+#define TRACK_HARMONICS   4      // harmonics sought around the tracked fundamental
+
+#define PEAK_LIST_STATE_SIZE 480 // bytes of storage for create_peak_list_at() (8 byte aligned)
+
 
 #include "peak.h"
 
 typedef struct peak_list peak_list_t;
 
 peak_list_t* create_peak_list();
+peak_list_t* create_peak_list_at(void* storage);
 void delete_peak_list(peak_list_t* peak_list);
 void erase_peak_list(peak_list_t* peak_list);
 int add_peak(peak_list_t* peak_list, peak_t* peak);
 peak_t get_peak(peak_list_t* peak_list, int index);
+int set_peak(peak_list_t* peak_list, int index, peak_t* peak);
 int list_size(peak_list_t* peak_list);
 peak_t find_fundamental_frequency(peak_list_t* peak_list);
 
+void enable_tracking(peak_list_t* peak_list, int enabled);
+void reset_tracking(peak_list_t* peak_list);
+int is_tracking(peak_list_t* peak_list);
+double get_predicted_frequency(peak_list_t* peak_list);
+void update_tracking(peak_list_t* peak_list);
+
 #endif
\ No newline at end of file
@@ -0,0 +1,177 @@
+/**
+ * profile.cpp
+ *
+ * C module timing the stages of the pitch pipeline (opt-in)
+ *
+ * Author: Vincent Lacasse (lacasse4@yahoo.com)
+ * Date: 2026-10-18
+ * Target system: Arduino Due
+ *
+ */
+
+/*
+ * Stages are timed with the Cortex-M3 cycle counter (DWT CYCCNT) on the
+ * Due and with clock_gettime() on the host: a tick is a CPU cycle on the
+ * Due and a nanosecond on the host.  Durations are kept modulo 2^32 ticks
+ * (51 s on the Due, 4.2 s on the host).
+ *
+ * Profiling is disabled by default: profile_begin() and profile_end() then
+ * only test a flag.  Stages may be nested (PROFILE_FRAME holds the others,
+ * PROFILE_FUNDAMENTAL holds PROFILE_PEAK_LIST with the peak list estimator,
+ * and both hold PROFILE_REFINE), but a stage must not be nested in itself.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "profile.h"
+
+#if defined(ARDUINO_ARCH_SAM)
+
+#include <Arduino.h>
+
+#define TICKS_PER_US  (F_CPU / 1000000)
+
+static void start_clock()
+{
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+static inline uint32_t get_ticks() { return DWT->CYCCNT; }
+
+#else
+
+#include <time.h>
+
+#define TICKS_PER_US  1000
+
+static void start_clock() { }
+
+static inline uint32_t get_ticks()
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint32_t) (ts.tv_sec * 1000000000ULL + ts.tv_nsec);
+}
+
+#endif
+
+static const char* stage_name[PROFILE_STAGES] = {
+  "load_frame",
+  "remove_bias",
+  "window",
+  "fft",
+  "magnitude",
+  "autocorrelation",
+  "peak_list",
+  "fundamental",
+  "refine",
+  "acquire",
+  "output",
+  "frame",
+};
+
+static int enabled = 0;
+static uint32_t start[PROFILE_STAGES];
+static profile_stat_t stat[PROFILE_STAGES];
+
+/**
+ * @brief enable or disable profiling (disabled by default)
+ * @details the statistics are kept (see reset_profile())
+ */
+void enable_profiling(int enable)
+{
+  if (enable && !enabled) start_clock();
+  enabled = enable;
+}
+
+int is_profiling_enabled() { return enabled; }
+
+/**
+ * @brief clear the statistics of every stage
+ */
+void reset_profile()
+{
+  memset(stat, 0, sizeof(stat));
+}
+
+/**
+ * @brief mark the beginning of a stage
+ */
+void profile_begin(int stage)
+{
+  if (!enabled) return;
+  start[stage] = get_ticks();
+}
+
+/**
+ * @brief mark the end of a stage and account its duration
+ */
+void profile_end(int stage)
+{
+  if (!enabled) return;
+
+  uint32_t ticks = get_ticks() - start[stage];
+  uint32_t us = ticks / TICKS_PER_US;
+  profile_stat_t* s = &stat[stage];
+  int bin = 0;
+
+  while (us != 0 && bin < PROFILE_BINS - 1) {
+    us >>= 1;
+    bin++;
+  }
+
+  if (s->count == 0 || ticks < s->min) s->min = ticks;
+  if (ticks > s->max) s->max = ticks;
+  s->total += ticks;
+  s->count++;
+  s->histogram[bin]++;
+}
+
+/**
+ * @brief statistics of a stage (in ticks)
+ */
+const profile_stat_t* get_profile_stat(int stage)
+{
+  return &stat[stage];
+}
+
+const char* get_stage_name(int stage)
+{
+  return stage_name[stage];
+}
+
+/**
+ * @brief convert a duration in ticks to microseconds
+ */
+double ticks_to_us(uint64_t ticks)
+{
+  return (double) ticks / TICKS_PER_US;
+}
+
+/**
+ * @brief print one line per timed stage: count, min, mean and max in us,
+ * @brief then the non empty histogram bins as <upper bound in us>:count
+ * @param print function printing a line (without new line character)
+ */
+void dump_profile(void (*print)(const char* line))
+{
+  char line[160];
+
+  for (int i = 0; i < PROFILE_STAGES; i++) {
+    profile_stat_t* s = &stat[i];
+    if (s->count == 0) continue;
+
+    int length = snprintf(line, sizeof(line), "%-15s n %5lu  min %8.1f  mean %8.1f  max %8.1f us |",
+                          stage_name[i], (unsigned long) s->count, ticks_to_us(s->min),
+                          ticks_to_us(s->total) / s->count, ticks_to_us(s->max));
+
+    for (int bin = 0; bin < PROFILE_BINS && length < (int) sizeof(line); bin++) {
+      if (s->histogram[bin] == 0) continue;
+      length += snprintf(line + length, sizeof(line) - length, bin == PROFILE_BINS - 1 ? " >%lu:%lu" : " <%lu:%lu",
+                         1UL << (bin == PROFILE_BINS - 1 ? bin - 1 : bin), (unsigned long) s->histogram[bin]);
+    }
+    print(line);
+  }
+}
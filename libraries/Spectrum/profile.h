@@ -0,0 +1,55 @@
+/**
+ * profile.h
+ *
+ * C module timing the stages of the pitch pipeline (opt-in)
+ *
+ * Author: Vincent Lacasse (lacasse4@yahoo.com)
+ * Date: 2026-10-18
+ * Target system: Arduino Due
+ *
+ */
+
+#ifndef _PROFILE_H
+#define _PROFILE_H
+
+#include <stdint.h>
+
+// stages timed by the Spectrum library
+#define PROFILE_LOAD             0    // load_latest_frame()
+#define PROFILE_BIAS             1    // remove_bias()
+#define PROFILE_WINDOW           2    // compute_spectrum(): normalization and window
+#define PROFILE_FFT              3    // compute_spectrum(): FFT (and magnitude with the real FFT)
+#define PROFILE_MAGNITUDE        4    // compute_spectrum(): magnitude (complex FFT)
+#define PROFILE_AUTOCORRELATION  5    // compute_autocorrelation()
+#define PROFILE_PEAK_LIST        6    // compute_peak_list()
+#define PROFILE_FUNDAMENTAL      7    // estimate_fundamental()
+#define PROFILE_REFINE           8    // refine_frequency()
+// stages timed by the application
+#define PROFILE_ACQUIRE          9    // moving samples to the signal
+#define PROFILE_OUTPUT           10   // printing, display
+#define PROFILE_FRAME            11   // a whole frame
+#define PROFILE_STAGES           12
+
+#define PROFILE_BINS             16   // histogram bin k: [2^(k-1), 2^k) us, bin 0: under 1 us
+
+typedef struct profile_stat {
+    uint32_t count;                   // number of timed runs
+    uint32_t min;                     // shortest run (ticks)
+    uint32_t max;                     // longest run (ticks)
+    uint64_t total;                   // sum of the runs (ticks)
+    uint32_t histogram[PROFILE_BINS]; // runs per duration bin
+} profile_stat_t;
+
+void enable_profiling(int enabled);
+int is_profiling_enabled();
+void reset_profile();
+
+void profile_begin(int stage);
+void profile_end(int stage);
+
+const profile_stat_t* get_profile_stat(int stage);
+const char* get_stage_name(int stage);
+double ticks_to_us(uint64_t ticks);
+void dump_profile(void (*print)(const char* line));
+
+#endif
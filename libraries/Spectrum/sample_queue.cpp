@@ -0,0 +1,200 @@
+/**
+ * sample_queue.cpp
+ *
+ * C module passing samples from an interrupt handler to the main loop
+ * (wait-free single producer, single consumer queue)
+ *
+ * Author: Vincent Lacasse (lacasse4@yahoo.com)
+ * Date: 2026-10-18
+ * Target system: Arduino Due
+ *
+ */
+
+/*
+ * The producer (the acquisition interrupt handler) only writes 'head' and
+ * the overrun counter, the consumer (the main loop) only writes 'tail' and
+ * the underrun counter.  Neither side ever waits for the other or disables
+ * interrupts: push_sample() drops the sample when the queue is full.
+ *
+ * head and tail are published with release stores and read with acquire
+ * loads: a sample is written before head moves past it and read before
+ * tail does.  On the Due, these are plain 32 bit loads and stores with a
+ * memory barrier; on the host, the same code runs with two threads.
+ *
+ * The queue holds 'depth' frames of 'frame_size' samples (plus one empty
+ * slot that tells a full queue from an empty one).  With a streaming
+ * signal, a frame is a hop: the main loop may fall 'depth' hops behind
+ * without losing a sample.
+ */
+
+#include <stdlib.h>
+#include "sample_queue.h"
+
+struct sample_queue {
+    int frame_size;              // samples in a frame
+    int depth;                   // frames the queue can hold
+    int size;                    // buffer size: frame_size * depth + 1 slots
+    int16_t* buffer;             // samples (ADC values)
+    int head;                    // next slot written (producer only)
+    int tail;                    // next slot read (consumer only)
+    uint32_t overrun;            // samples dropped on a full queue (producer only)
+    uint32_t underrun;           // load_frame() calls without a full frame (consumer only)
+};
+
+/**
+ * @brief create a queue of 'depth' frames of 'frame_size' samples
+ * @returns the queue, or NULL if out of memory or if a size is not positive
+ * @details samples are stored as 16 bit integers (ADC values)
+ */
+sample_queue_t* create_sample_queue(int frame_size, int depth)
+{
+  if (frame_size <= 0 || depth <= 0) return NULL;
+
+  sample_queue_t* queue = (sample_queue_t*) malloc(sizeof(sample_queue_t));
+  if (queue == NULL) return NULL;
+
+  queue->frame_size = frame_size;
+  queue->depth = depth;
+  queue->size = frame_size * depth + 1;
+  queue->buffer = (int16_t*) malloc(queue->size * sizeof(int16_t));
+  if (queue->buffer == NULL) {
+    free(queue);
+    return NULL;
+  }
+
+  erase_sample_queue(queue);
+  return queue;
+}
+
+/**
+ * @brief release queue resources
+ */
+void delete_sample_queue(sample_queue_t* queue)
+{
+  free(queue->buffer);
+  free(queue);
+}
+
+/**
+ * @brief empty the queue and clear its counters
+ * @details only while the producer is stopped
+ */
+void erase_sample_queue(sample_queue_t* queue)
+{
+  __atomic_store_n(&queue->head, 0, __ATOMIC_RELEASE);
+  __atomic_store_n(&queue->tail, 0, __ATOMIC_RELEASE);
+  __atomic_store_n(&queue->overrun, 0, __ATOMIC_RELAXED);
+  __atomic_store_n(&queue->underrun, 0, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief getters
+ */
+int get_frame_size(sample_queue_t* queue)  { return queue->frame_size; }
+int get_queue_depth(sample_queue_t* queue) { return queue->depth; }
+
+/**
+ * @brief next slot after index
+ */
+static inline int next_slot(sample_queue_t* queue, int index)
+{
+  return index + 1 == queue->size ? 0 : index + 1;
+}
+
+/**
+ * @brief add a sample to the queue (producer side, never blocks)
+ * @returns 1 if OK, 0 if the queue was full (the sample is dropped and
+ * @returns the overrun counter incremented)
+ */
+int push_sample(sample_queue_t* queue, int sample)
+{
+  int head = __atomic_load_n(&queue->head, __ATOMIC_RELAXED);
+  int next = next_slot(queue, head);
+
+  if (next == __atomic_load_n(&queue->tail, __ATOMIC_ACQUIRE)) {
+    __atomic_store_n(&queue->overrun, queue->overrun + 1, __ATOMIC_RELAXED);
+    return 0;
+  }
+
+  queue->buffer[head] = sample;
+  __atomic_store_n(&queue->head, next, __ATOMIC_RELEASE);
+  return 1;
+}
+
+/**
+ * @brief number of samples in the queue (consumer side)
+ * @details the producer may add samples at any time: this is a lower bound
+ */
+int queued_samples(sample_queue_t* queue)
+{
+  int head = __atomic_load_n(&queue->head, __ATOMIC_ACQUIRE);
+  int tail = __atomic_load_n(&queue->tail, __ATOMIC_RELAXED);
+
+  return head >= tail ? head - tail : head + queue->size - tail;
+}
+
+/**
+ * @brief number of complete frames in the queue (consumer side)
+ */
+int queued_frames(sample_queue_t* queue)
+{
+  return queued_samples(queue) / queue->frame_size;
+}
+
+/**
+ * @brief remove the oldest sample from the queue (consumer side)
+ * @returns 1 if OK, 0 if the queue was empty
+ */
+int pop_sample(sample_queue_t* queue, int* sample)
+{
+  int tail = __atomic_load_n(&queue->tail, __ATOMIC_RELAXED);
+
+  if (tail == __atomic_load_n(&queue->head, __ATOMIC_ACQUIRE)) return 0;
+
+  *sample = queue->buffer[tail];
+  __atomic_store_n(&queue->tail, next_slot(queue, tail), __ATOMIC_RELEASE);
+  return 1;
+}
+
+/**
+ * @brief move the oldest frame of the queue to a signal (consumer side)
+ * @returns 1 if OK, 0 if the queue holds less than a frame (nothing is
+ * @returns moved and the underrun counter is incremented)
+ * @details the samples go through add_sample(): decimation and streaming
+ * @details apply.  With a streaming signal, make frame_size the hop (times
+ * @details the decimation factor) and check is_buffer_full() after each frame.
+ * @details The slots are given back to the producer once the frame is moved.
+ */
+int load_frame(sample_queue_t* queue, signal_t* signal)
+{
+  int tail = __atomic_load_n(&queue->tail, __ATOMIC_RELAXED);
+
+  if (queued_samples(queue) < queue->frame_size) {
+    __atomic_store_n(&queue->underrun, queue->underrun + 1, __ATOMIC_RELAXED);
+    return 0;
+  }
+
+  for (int i = 0; i < queue->frame_size; i++) {
+    add_sample(signal, queue->buffer[tail]);
+    tail = next_slot(queue, tail);
+  }
+
+  __atomic_store_n(&queue->tail, tail, __ATOMIC_RELEASE);
+  return 1;
+}
+
+/**
+ * @brief number of samples dropped because the queue was full
+ */
+uint32_t get_overrun_count(sample_queue_t* queue)
+{
+  return __atomic_load_n(&queue->overrun, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief number of load_frame() calls that found less than a frame
+ */
+uint32_t get_underrun_count(sample_queue_t* queue)
+{
+  return __atomic_load_n(&queue->underrun, __ATOMIC_RELAXED);
+}
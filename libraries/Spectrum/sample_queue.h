@@ -0,0 +1,41 @@
+/**
+ * sample_queue.h
+ *
+ * C module passing samples from an interrupt handler to the main loop
+ * (wait-free single producer, single consumer queue)
+ *
+ * Author: Vincent Lacasse (lacasse4@yahoo.com)
+ * Date: 2026-10-18
+ * Target system: Arduino Due
+ *
+ */
+
+#ifndef _SAMPLE_QUEUE_H
+#define _SAMPLE_QUEUE_H
+
+#include <stdint.h>
+#include "spectrum.h"
+
+typedef struct sample_queue sample_queue_t;
+
+sample_queue_t* create_sample_queue(int frame_size, int depth);
+void delete_sample_queue(sample_queue_t* queue);
+void erase_sample_queue(sample_queue_t* queue);
+
+int get_frame_size(sample_queue_t* queue);
+int get_queue_depth(sample_queue_t* queue);
+
+// producer side (interrupt handler)
+int push_sample(sample_queue_t* queue, int sample);
+
+// consumer side (main loop)
+int queued_samples(sample_queue_t* queue);
+int queued_frames(sample_queue_t* queue);
+int pop_sample(sample_queue_t* queue, int* sample);
+int load_frame(sample_queue_t* queue, signal_t* signal);
+
+// either side
+uint32_t get_overrun_count(sample_queue_t* queue);
+uint32_t get_underrun_count(sample_queue_t* queue);
+
+#endif
@@ -15,7 +15,13 @@
  */
 
 #include <stdlib.h>
+#include <string.h>
 #include "spectrum.h"
+#include "fixed_fft.h"
+#include "fft_core.h"
+#include "tables.h"
+#include "decimator.h"
+#include "profile.h"
 #include "peak.h"
 #include "peak_list.h"
 
@@ -29,54 +35,171 @@ extern char uuu[3][100];
  */
 struct signal {
     int length;                 // number of samples
-    double sampling_frequency;  // samplingFrequency in Hertz
-    int sampling_period;        // sampling period in microseconds
+    double sampling_frequency;  // samplingFrequency in Hertz (after decimation)
+    int sampling_period;        // sampling period in microseconds (before decimation)
+    double input_frequency;     // sampling frequency of the samples given to add_sample()
 
     int length_with_padding;    // number of samples with zero padding
+    double bin_width;           // spectrum bin width in Hertz (sampling_frequency / length_with_padding)
     int zero_padding_enabled;   // indicates if enough memory is allocated for zero padding
-    unsigned char window_type;  // window type for pre FFT windowing
-
-    double* real;               // signal array (real part)
-    double* imag;               // signal array (imaginary part)
+    FFTWindow window_type;      // window type for pre FFT windowing
+
+    int sample_type;            // SAMPLE_DOUBLE, SAMPLE_FLOAT, SAMPLE_Q15 or SAMPLE_Q31
+    int sample_size;            // size of one sample in bytes
+    double magnitude_scale;     // converts spectrum values to the double spectrum scale
+    int real_fft_enabled;       // spectrum computed with a real input FFT (no imag array)
+
+    const void* window;         // first half of the window, of the sample type
+    void* window_buffer;        // window table in RAM (NULL when a const table is used)
+    const void* sine;           // quarter wave sine table for FFT twiddles (NULL if disabled)
+    void* sine_buffer;          // sine table in RAM (NULL when a const table is used)
+    int sine_quarter;           // quarter of the sine table period
+    int const_tables_enabled;   // use const (flash) tables when available
+
+    int estimator;              // fundamental estimator (see estimate_fundamental)
+    double lowest_power;        // lowest peak power considered in peak search
+    double highest_ratio;       // ratio to highest peak power for a peak to be accepted
+    double search_window;       // relative window where divider peaks are sought
+    float* lag_energy;          // MPM: m(lag) / m(0) for lags up to length/2 (NULL until used)
+    float* frame;               // refinement: windowed time domain frame (NULL if disabled)
+
+    void* real;                 // signal array (real part)
+    void* imag;                 // signal array (imaginary part)
     peak_list_t* list;          // spectrum's peak list
+    void* window_storage;       // caller's window table storage (NULL: window_buffer is allocated)
+    int static_storage;         // struct, arrays and peak list are the caller's (create_signal_at)
 
     int index;                  // index of next sample to acquire
+
+    void* ring;                 // streaming ring buffer, 'length' samples (NULL if disabled)
+    int hop;                    // streaming: new samples between two frames
+    int ring_head;              // streaming: index of the next sample in ring
+    int ring_count;             // streaming: number of valid samples in ring
+    int ring_pending;           // streaming: samples added since the last frame
+
+    decimator_t decimator;      // decimating low pass filter fed by add_sample()
 };
 
+static void erase_buffers(signal_t* signal);
+static int update_window(signal_t* signal);
+static int update_sine(signal_t* signal);
+
+static_assert(sizeof(signal_t) <= SIGNAL_STATE_SIZE, "SIGNAL_STATE_SIZE is too small");
+
+/**
+ * @brief set the fields of a signal whose arrays are not assigned yet
+ */
+static void init_signal(signal_t* signal, int length, double sampling_frequency, 
+                        int zero_padding_enabled, int sample_type, int real_fft_enabled)
+{
+  signal->length = length;
+  signal->sampling_frequency = sampling_frequency;
+  signal->input_frequency = sampling_frequency;
+  signal->zero_padding_enabled = zero_padding_enabled;
+  signal->length_with_padding = length * (zero_padding_enabled ? 2 : 1);
+  signal->bin_width = sampling_frequency / signal->length_with_padding;
+  signal->sampling_period = round(CYCLES_PER_MHZ/sampling_frequency); // in microsec.
+
+  signal->window_type = FFT_WIN_TYP_HAMMING;
+
+  signal->sample_type = sample_type;
+  signal->sample_size = sample_type_size(sample_type);
+  signal->magnitude_scale = 1.0;
+  signal->real_fft_enabled = real_fft_enabled;
+
+  signal->window = NULL;
+  signal->window_buffer = NULL;
+  signal->window_storage = NULL;
+  signal->sine = NULL;
+  signal->sine_buffer = NULL;
+  signal->sine_quarter = 0;
+  signal->const_tables_enabled = 0;
+
+  signal->ring = NULL;
+  signal->hop = 0;
+
+  signal->estimator = ESTIMATOR_PEAK_LIST;
+  signal->lowest_power = LOWEST_PEAK_POWER;
+  signal->highest_ratio = HIGHEST_RATIO;
+  signal->search_window = SEARCH_WINDOW;
+  signal->lag_energy = NULL;
+  signal->frame = NULL;
+
+  signal->real = NULL;
+  signal->imag = NULL;
+  signal->list = NULL;
+  signal->static_storage = 0;
+
+  init_decimator(&signal->decimator, 1);
+}
+
 /**
  * @brief create a signal
  * @param length signal's length
  * @param sampling_frequency signal's sampling frequency in Hertz
  * @param zero_padding_enabled extra memory allocated for signal if true
+ * @param sample_type SAMPLE_DOUBLE, SAMPLE_FLOAT, SAMPLE_Q15 or SAMPLE_Q31
+ * @param real_fft_enabled use a real input FFT if true
  * @details signal is twice the 'length' if FFT zero padding is enabled
+ * @details float and fixed point samples use less memory and are processed 
+ * @details faster on the Due (no FPU) at the cost of spectrum precision
+ * @details the real input FFT is about twice as fast and does not need 
+ * @details the imaginary array
+ * @details the window is precomputed here (see set_window_type)
  */
-signal_t* create_signal(int length, double sampling_frequency, int zero_padding_enabled)
+signal_t* create_signal(int length, double sampling_frequency, int zero_padding_enabled, 
+                        int sample_type, int real_fft_enabled)
 {
   signal_t* signal = (signal_t*) malloc(sizeof(signal_t));
   if (signal == NULL) return NULL;
 
-  signal->length = length;
-  signal->sampling_frequency = sampling_frequency;
-  signal->zero_padding_enabled = zero_padding_enabled;
-  signal->length_with_padding = length * (zero_padding_enabled ? 2 : 1);
-  signal->sampling_period = round(CYCLES_PER_MHZ/sampling_frequency); // in microsec.
-
-  signal->window_type = FFT_WIN_TYP_HAMMING;
+  init_signal(signal, length, sampling_frequency, zero_padding_enabled, sample_type, real_fft_enabled);
 
   // Allocate twice the memory if zero padding is enabled.
   // This allows to perform zero padding safely.
-  signal->real = (double *) malloc(signal->length_with_padding * sizeof(double));
-  signal->imag = (double *) malloc(signal->length_with_padding * sizeof(double));
+  signal->real = malloc(signal->length_with_padding * signal->sample_size);
+  signal->imag = real_fft_enabled ? NULL : malloc(signal->length_with_padding * signal->sample_size);
   signal->list = create_peak_list();
 
-  if (signal->imag == NULL || signal->imag == NULL || signal->list == NULL) {
-    delete_peak_list(signal->list);
-    free(signal->imag);
-    free(signal->real);
-    free(signal);
+  if (signal->real == NULL || (signal->imag == NULL && !real_fft_enabled) || signal->list == NULL ||
+      !update_window(signal)) {
+    delete_signal(signal);
+    return NULL;
+  }
+
+  erase_signal(signal);
+
+  return signal;
+}
+
+/**
+ * @brief create a signal in caller provided storage (no heap)
+ * @param storage the signal's state, arrays, window and peak list (see 
+ * @param storage signal_storage_t), which must outlive the signal
+ * @returns the signal, or NULL if an array is missing
+ * @details same as create_signal() otherwise.  Features enabled later 
+ * @details (streaming, twiddle table, MPM, refinement) still allocate their 
+ * @details buffers; delete_signal() releases these only.  Static_signal.h 
+ * @details wraps this function in a compile time sized template.
+ */
+signal_t* create_signal_at(const signal_storage_t* storage, int length, double sampling_frequency, 
+                           int zero_padding_enabled, int sample_type, int real_fft_enabled)
+{
+  if (storage->state == NULL || storage->real == NULL || storage->window == NULL ||
+      storage->peak_list == NULL || (storage->imag == NULL && !real_fft_enabled)) {
     return NULL;
   }
 
+  signal_t* signal = (signal_t*) storage->state;
+
+  init_signal(signal, length, sampling_frequency, zero_padding_enabled, sample_type, real_fft_enabled);
+  signal->static_storage = 1;
+  signal->real = storage->real;
+  signal->imag = real_fft_enabled ? NULL : storage->imag;
+  signal->window_storage = storage->window;
+  signal->list = create_peak_list_at(storage->peak_list);
+
+  update_window(signal);
   erase_signal(signal);
 
   return signal;
@@ -87,6 +210,22 @@ signal_t* create_signal(int length, double sampling_frequency, int zero_padding_
  */
 void delete_signal(signal_t* signal)
 {
+  free(signal->lag_energy);
+  free(signal->frame);
+  free(signal->ring);
+  free(signal->sine_buffer);
+  free(signal->window_buffer);
+  if (signal->static_storage) {
+    // the state outlives this call: deleting again must not free again
+    signal->lag_energy = NULL;
+    signal->frame = NULL;
+    signal->ring = NULL;
+    signal->sine_buffer = NULL;
+    signal->window_buffer = NULL;
+    return;
+  }
+
+  delete_peak_list(signal->list);
   free(signal->imag);
   free(signal->real);
   free(signal);
@@ -98,29 +237,114 @@ void delete_signal(signal_t* signal)
 int get_length(signal_t* signal)                { return signal->length; }
 int get_length_with_padding(signal_t* signal)   { return signal->length_with_padding; }
 int is_padding_enabled(signal_t* signal)        { return signal->zero_padding_enabled; }
+int is_real_fft_enabled(signal_t* signal)       { return signal->real_fft_enabled; }
 double get_sampling_frequency(signal_t* signal) { return signal->sampling_frequency; }
-double* get_signal_array(signal_t* signal)      { return signal->real; }
+int get_sample_type(signal_t* signal)           { return signal->sample_type; }
+void* get_signal_data(signal_t* signal)         { return signal->real; }
 peak_list_t* get_peak_list(signal_t* signal)    { return signal->list; }
 
+/**
+ * @brief return the signal array, or NULL if samples are not SAMPLE_DOUBLE
+ */
+double* get_signal_array(signal_t* signal)
+{
+  return signal->sample_type == SAMPLE_DOUBLE ? (double*) signal->real : NULL;
+}
+
+/**
+ * @brief return the size in bytes of a sample of type 'sample_type'
+ */
+int sample_type_size(int sample_type)
+{
+  switch (sample_type) {
+    case SAMPLE_FLOAT: return sizeof(float);
+    case SAMPLE_Q15:   return sizeof(q15_t);
+    case SAMPLE_Q31:   return sizeof(q31_t);
+    default:           return sizeof(double);
+  }
+}
+
+/**
+ * @brief set the real and imaginary buffers to 0
+ */
+static void erase_buffers(signal_t* signal)
+{
+  memset(signal->real, 0, signal->length_with_padding * signal->sample_size);
+  if (signal->imag != NULL) {
+    memset(signal->imag, 0, signal->length_with_padding * signal->sample_size);
+  }
+}
+
+/**
+ * @brief store an ADC value at index in an array of the signal's sample type
+ */
+static void set_sample(signal_t* signal, void* array, int index, int value)
+{
+  switch (signal->sample_type) {
+    case SAMPLE_DOUBLE: ((double*) array)[index] = value; break;
+    case SAMPLE_FLOAT:  ((float*) array)[index] = value;  break;
+    case SAMPLE_Q15:    ((q15_t*) array)[index] = value;  break;
+    case SAMPLE_Q31:    ((q31_t*) array)[index] = value;  break;
+  }
+}
+
+/**
+ * @brief return the spectrum value at index, on the double spectrum scale
+ */
+static double get_value(signal_t* signal, int index)
+{
+  switch (signal->sample_type) {
+    case SAMPLE_FLOAT: return ((float*) signal->real)[index];
+    case SAMPLE_Q15:   return ((q15_t*) signal->real)[index] * signal->magnitude_scale;
+    case SAMPLE_Q31:   return ((q31_t*) signal->real)[index] * signal->magnitude_scale;
+    default:           return ((double*) signal->real)[index];
+  }
+}
+
+/**
+ * @brief return the time domain sample at index, whatever the sample type
+ * @details valid between the acquisition and compute_spectrum()
+ */
+double get_sample_value(signal_t* signal, int index)
+{
+  switch (signal->sample_type) {
+    case SAMPLE_FLOAT: return ((float*) signal->real)[index];
+    case SAMPLE_Q15:   return ((q15_t*) signal->real)[index];
+    case SAMPLE_Q31:   return ((q31_t*) signal->real)[index];
+    default:           return ((double*) signal->real)[index];
+  }
+}
+
+/**
+ * @brief return the spectrum value at index, on the double spectrum scale
+ * @details valid after compute_spectrum()
+ */
+double get_spectrum_value(signal_t* signal, int index)
+{
+  return get_value(signal, index);
+}
+
 /**
  * @brief digitizes an analog signal from channel using the Arduino ADC
  * @param channel ADC Arduino channel 
  * @param removeBias bias is removed after data aquisition if true
  * @details signal is filled with 'length' samples obtained from the ADC CHANNEL
+ * @details (through add_sample(): decimation and streaming apply)
  */
 void acquire(signal_t* signal, int channel, int removeBias) 
 {
   unsigned long microseconds;
 
-  erase_array(signal->real, signal->length_with_padding);
-  erase_array(signal->imag, signal->length_with_padding);
+  signal->index = 0;
+  erase_buffers(signal);
 
   microseconds = micros();
-  for(int i = 0; i < signal->length; i++) {
-      signal->real[i] = analogRead(channel);
+  while (!is_buffer_full(signal)) {
+      add_sample(signal, analogRead(channel));
       while(micros() - microseconds < signal->sampling_period);  // wait
       microseconds += signal->sampling_period;
   }
+  load_latest_frame(signal);
 
   if (removeBias) {
     remove_bias(signal);
@@ -130,60 +354,652 @@ void acquire(signal_t* signal, int channel, int removeBias)
 /**
  * @brief add a sample to the real signal buffer and increment acquistion index
  * @param sample sample to be added to the real buffer 
+ * @details in streaming mode, the sample goes to the ring buffer instead
+ * @details (the oldest sample is overwritten when the ring is full)
+ * @details with decimation, only one filtered sample out of 'factor' is stored
  */
 
 void add_sample(signal_t* signal, int sample) {
+  if (!decimate(&signal->decimator, sample, &sample)) return;
+
+  if (signal->ring != NULL) {
+    set_sample(signal, signal->ring, signal->ring_head, sample);
+    signal->ring_head = (signal->ring_head + 1) % signal->length;
+    if (signal->ring_count < signal->length) signal->ring_count++;
+    signal->ring_pending++;
+    return;
+  }
+
   if (signal->index < signal->length) {
-    signal->real[signal->index++] = sample;
+    set_sample(signal, signal->real, signal->index++, sample);
   }
 }
 
 /**
  * @brief return true if the 'real' buffer is full.
+ * @details in streaming mode, return true when the ring is full and 'hop' 
+ * @details samples were added since the last load_latest_frame()
  */
 
 int is_buffer_full(signal_t* signal) {
+  if (signal->ring != NULL) {
+    return signal->ring_count >= signal->length && signal->ring_pending >= signal->hop;
+  }
   return signal->index >= signal->length;
 }
 
 /**
- * @brief remove the bias from an analog signal (real part only)
+ * @brief make the next streaming frame due in 'samples' samples
+ * @details is_buffer_full() becomes true once 'samples' more samples are 
+ * @details stored (after decimation) and the ring is full; the following 
+ * @details frames come every 'hop' samples from there.  With 'hop' samples, 
+ * @details the frame that is due is skipped; with 0, a frame is due now.
  */
-void remove_bias(signal_t* signal) 
+void schedule_frame(signal_t* signal, int samples)
+{
+  if (samples < 0) samples = 0;
+  signal->ring_pending = signal->hop - samples;
+}
+
+/**
+ * @brief decimate the samples given to add_sample() by 'factor'
+ * @param factor 1 (no decimation, default), 2 or 4
+ * @returns 1 if OK, 0 if factor is not supported
+ * @details samples go through a low pass filter (integer polyphase FIR, see
+ * @details decimator.cpp) and one out of 'factor' is kept.  The signal's 
+ * @details sampling frequency becomes the input frequency divided by factor:
+ * @details the same resolution is obtained with a 'factor' times shorter FFT.
+ * @details From a 4000 Hz input, factor 2 keeps 0-900 Hz and factor 4 keeps
+ * @details 0-400 Hz.  The filter state is kept by erase_signal() (the input 
+ * @details is a continuous stream) and cleared here.
+ */
+int set_decimation(signal_t* signal, int factor)
+{
+  if (!init_decimator(&signal->decimator, factor)) return 0;
+
+  signal->sampling_frequency = signal->input_frequency / factor;
+  signal->bin_width = signal->sampling_frequency / signal->length_with_padding;
+  return 1;
+}
+
+int get_decimation(signal_t* signal) { return signal->decimator.factor; }
+
+/**
+ * @brief empty the streaming ring buffer
+ */
+static void erase_ring(signal_t* signal)
+{
+  signal->ring_head = 0;
+  signal->ring_count = 0;
+  signal->ring_pending = 0;
+}
+
+/**
+ * @brief enable the overlapping (STFT) streaming mode
+ * @param hop number of new samples between two frames, 0 disables streaming
+ * @returns 1 on success, 0 if out of memory or hop > length
+ * @details add_sample() pushes samples into a ring buffer of 'length' samples.
+ * @details Every 'hop' samples, is_buffer_full() becomes true and 
+ * @details load_latest_frame() copies the latest 'length' samples to the 
+ * @details signal array, ready for remove_bias() and compute_spectrum().
+ * @details Overlap is 1 - hop/length (hop = length/4 gives 75% overlap).
+ * @details Acquisition can go on during processing: no second signal is needed.
+ */
+int enable_streaming(signal_t* signal, int hop)
+{
+  if (hop < 0 || hop > signal->length) return 0;
+
+  if (hop == 0) {
+    free(signal->ring);
+    signal->ring = NULL;
+    signal->hop = 0;
+    return 1;
+  }
+
+  if (signal->ring == NULL) {
+    signal->ring = malloc(signal->length * signal->sample_size);
+    if (signal->ring == NULL) return 0;
+  }
+
+  signal->hop = hop;
+  erase_ring(signal);
+  return 1;
+}
+
+int get_hop(signal_t* signal) { return signal->hop; }
+
+/**
+ * @brief copy the latest 'length' samples of the ring buffer to the signal array
+ * @details oldest sample first.  The padding and the peak list are erased.
+ * @details If processing fell behind by more than 'hop' samples, the skipped 
+ * @details frames are dropped: the next frame is again 'hop' samples away.
+ * @details Must not be interrupted by add_sample() (use a critical zone).
+ */
+void load_latest_frame(signal_t* signal)
+{
+  int size = signal->sample_size;
+  int older = signal->length - signal->ring_head;   // samples from ring_head to the end
+
+  if (signal->ring == NULL) return;
+
+  profile_begin(PROFILE_LOAD);
+  erase_buffers(signal);
+  erase_peak_list(signal->list);
+
+  memcpy(signal->real, (char*) signal->ring + signal->ring_head * size, older * size);
+  memcpy((char*) signal->real + older * size, signal->ring, signal->ring_head * size);
+
+  signal->ring_pending = 0;
+  signal->index = signal->length;
+  profile_end(PROFILE_LOAD);
+}
+
+/**
+ * @brief copy the latest 'length' samples of another signal's ring buffer to the signal array
+ * @param source streaming signal of the same sample type, at least as long
+ * @returns 1 if OK, 0 if source has no ring, holds less than 'length' 
+ * @returns samples or does not match (nothing is copied)
+ * @details same as load_latest_frame(), but several signals of different 
+ * @details lengths can read one ring (see multires.h).  The source's hop 
+ * @details counter is not changed: the caller decides when a frame is due.
+ */
+int load_latest_frame_from(signal_t* signal, signal_t* source)
+{
+  int size = signal->sample_size;
+  int length = signal->length;
+
+  if (source->ring == NULL || source->ring_count < length || length > source->length ||
+      source->sample_type != signal->sample_type) {
+    return 0;
+  }
+
+  profile_begin(PROFILE_LOAD);
+  erase_buffers(signal);
+  erase_peak_list(signal->list);
+
+  // the latest sample is before ring_head, the oldest 'length' samples before it
+  int first = source->ring_head - length;
+  if (first < 0) {
+    first += source->length;
+    int older = source->length - first;    // samples from 'first' to the end of the ring
+    memcpy(signal->real, (char*) source->ring + first * size, older * size);
+    memcpy((char*) signal->real + older * size, source->ring, (length - older) * size);
+  }
+  else {
+    memcpy(signal->real, (char*) source->ring + first * size, length * size);
+  }
+
+  signal->index = length;
+  profile_end(PROFILE_LOAD);
+  return 1;
+}
+
+/**
+ * @brief remove the bias from an array
+ * @details the bias is accumulated in type A (integer types for fixed point)
+ */
+template <typename T, typename A>
+static void remove_array_bias(T* array, int length) 
 {
-  double bias = 0.0;
+  A bias = 0;
 
   // compute bias
-  for (int i = 0; i < signal->length; i++) {
-    bias += signal->real[i];
+  for (int i = 0; i < length; i++) {
+    bias += array[i];
   }
 
   // remove bias
-  bias = bias / signal->length;
-  for (int i = 0; i < signal->length; i++) {
-    signal->real[i] -= bias;
+  bias = bias / length;
+  for (int i = 0; i < length; i++) {
+    array[i] -= bias;
+  }
+}
+
+/**
+ * @brief remove the bias from an analog signal (real part only)
+ */
+void remove_bias(signal_t* signal) 
+{
+  profile_begin(PROFILE_BIAS);
+  switch (signal->sample_type) {
+    case SAMPLE_DOUBLE: remove_array_bias<double, double>((double*) signal->real, signal->length); break;
+    case SAMPLE_FLOAT:  remove_array_bias<float, float>((float*) signal->real, signal->length);    break;
+    case SAMPLE_Q15:    remove_array_bias<q15_t, int32_t>((q15_t*) signal->real, signal->length); break;
+    case SAMPLE_Q31:    remove_array_bias<q31_t, int64_t>((q31_t*) signal->real, signal->length); break;
   }
+  profile_end(PROFILE_BIAS);
 }
 
 
+/**
+ * @brief point the signal to the table of its window, building it if needed
+ * @returns 1 on success, 0 if out of memory
+ */
+static int update_window(signal_t* signal)
+{
+  const void* table = NULL;
+
+  if (signal->const_tables_enabled) {
+    table = find_const_window_table(signal->sample_type, signal->window_type, signal->length);
+  }
+
+  if (table != NULL) {
+    free(signal->window_buffer);
+    signal->window_buffer = NULL;
+    signal->window = table;
+    return 1;
+  }
+
+  if (signal->window_storage != NULL) {
+    fill_window_table(signal->window_storage, signal->sample_type, signal->window_type, signal->length);
+    signal->window = signal->window_storage;
+    return 1;
+  }
+
+  if (signal->window_buffer == NULL) {
+    signal->window_buffer = malloc((signal->length >> 1) * signal->sample_size);
+    if (signal->window_buffer == NULL) return 0;
+  }
+
+  fill_window_table(signal->window_buffer, signal->sample_type, signal->window_type, signal->length);
+  signal->window = signal->window_buffer;
+  return 1;
+}
+
+/**
+ * @brief point the signal to a sine table covering its FFT size, building it if needed
+ * @returns 1 on success, 0 if out of memory
+ */
+static int update_sine(signal_t* signal)
+{
+  free(signal->sine_buffer);
+  signal->sine_buffer = NULL;
+
+  if (signal->const_tables_enabled && signal->length_with_padding <= CONST_SINE_PERIOD) {
+    signal->sine = find_const_sine_table(signal->sample_type);
+    signal->sine_quarter = CONST_SINE_PERIOD / 4;
+    return 1;
+  }
+
+  signal->sine_buffer = create_sine_table(signal->sample_type, signal->length_with_padding);
+  signal->sine = signal->sine_buffer;
+  signal->sine_quarter = signal->length_with_padding / 4;
+  return signal->sine != NULL;
+}
+
 /**
  * @brief set the window type for FFT processing 
  * @param window_type window type from arduinoFFT lib
+ * @returns 1 on success, 0 if out of memory (the previous window is lost)
+ * @details the window is computed once here, not at every compute_spectrum()
  */
-void set_window_type(signal_t* signal, unsigned char window_type) {
+int set_window_type(signal_t* signal, FFTWindow window_type) {
   signal->window_type = window_type;
+  return update_window(signal);
 }
 
 /**
- * @brief compute signal spectrum using arduinoFFt lib.
+ * @brief enable or disable the FFT twiddle factor table (disabled by default)
+ * @returns 1 on success, 0 if out of memory (the table is then disabled)
+ * @details with the table, the FFT reads its twiddle factors instead of 
+ * @details computing them with floating point rotations.  It costs 
+ * @details length_with_padding/4 samples of RAM (none with const tables).
+ */
+int enable_twiddle_table(signal_t* signal, int enabled)
+{
+  if (enabled) {
+    return update_sine(signal);
+  }
+
+  free(signal->sine_buffer);
+  signal->sine_buffer = NULL;
+  signal->sine = NULL;
+  signal->sine_quarter = 0;
+  return 1;
+}
+
+/**
+ * @brief use the const (flash) window and sine tables when available
+ * @returns 1 on success, 0 if out of memory
+ * @details const tables exist for the Hamming window of 1024 and 2048 
+ * @details samples and for FFT sizes up to CONST_SINE_PERIOD (see 
+ * @details extras/gen_tables.py).  Other tables are kept in RAM.
+ */
+int enable_const_tables(signal_t* signal, int enabled)
+{
+  signal->const_tables_enabled = enabled;
+
+  if (!update_window(signal)) return 0;
+  if (signal->sine != NULL) return update_sine(signal);
+  return 1;
+}
+
+/**
+ * @brief use the window and twiddle tables of another signal instead of its own
+ * @param owner signal of the same length, padding and sample type, which
+ * @param owner must outlive 'signal' (or stop sharing first)
+ * @returns 1 if OK, 0 if the signals do not match
+ * @details the signal's own tables are released.  Changing its window type, 
+ * @details twiddle table or const tables afterwards gives it its own tables 
+ * @details again; changes to the owner's tables are not followed.
+ */
+int share_tables(signal_t* signal, signal_t* owner)
+{
+  if (signal->length != owner->length || signal->length_with_padding != owner->length_with_padding ||
+      signal->sample_type != owner->sample_type) {
+    return 0;
+  }
+
+  free(signal->window_buffer);
+  free(signal->sine_buffer);
+  signal->window_buffer = NULL;
+  signal->sine_buffer = NULL;
+
+  signal->window_type = owner->window_type;
+  signal->const_tables_enabled = owner->const_tables_enabled;
+  signal->window = owner->window;
+  signal->sine = owner->sine;
+  signal->sine_quarter = owner->sine_quarter;
+  return 1;
+}
+
+/**
+ * @brief FFT without a twiddle table: arduinoFFT for floating point samples
+ */
+static void default_fft(double* real, double* imag, int samples)
+{
+  ArduinoFFT<double> FFT;
+  FFT.compute(real, imag, samples, FFT_FORWARD);
+}
+
+static void default_fft(float* real, float* imag, int samples)
+{
+  ArduinoFFT<float> FFT;
+  FFT.compute(real, imag, samples, FFT_FORWARD);
+}
+
+static void default_fft(q15_t* real, q15_t* imag, int samples) { fft_q15(real, imag, samples); }
+static void default_fft(q31_t* real, q31_t* imag, int samples) { fft_q31(real, imag, samples); }
+
+/**
+ * @brief copy the windowed frame of samples of type T for refine_frequency()
+ * @details the frame is only needed within a constant factor: fixed point 
+ * @details window weights are used as is
+ */
+template <typename T>
+static void save_typed_frame(signal_t* signal)
+{
+  const T* real = (const T*) signal->real;
+  const T* window = (const T*) signal->window;
+  int length = signal->length;
+
+  for (int i = 0; i < (length >> 1); i++) {
+    signal->frame[i] = (float) window[i] * (float) real[i];
+    signal->frame[length - (i + 1)] = (float) window[i] * (float) real[length - (i + 1)];
+  }
+}
+
+/**
+ * @brief keep a copy of the time domain frame if refinement is enabled
+ */
+static void save_frame(signal_t* signal)
+{
+  if (signal->frame == NULL) return;
+
+  switch (signal->sample_type) {
+    case SAMPLE_DOUBLE: save_typed_frame<double>(signal); break;
+    case SAMPLE_FLOAT:  save_typed_frame<float>(signal);  break;
+    case SAMPLE_Q15:    save_typed_frame<q15_t>(signal);  break;
+    case SAMPLE_Q31:    save_typed_frame<q31_t>(signal);  break;
+  }
+}
+
+/**
+ * @brief compute the spectrum of samples of type T with the math policy M
+ */
+template <typename M, typename T>
+static void compute_typed_spectrum(signal_t* signal)
+{
+  T* real = (T*) signal->real;
+  T* imag = (T*) signal->imag;
+  const T* window = (const T*) signal->window;
+  const T* sine = (const T*) signal->sine;
+  int length = signal->length;
+  int samples = signal->length_with_padding;
+
+  profile_begin(PROFILE_WINDOW);
+  int shift = M::normalize(real, length);
+
+  for (int i = 0; i < (length >> 1); i++) {
+    real[i] = M::multiply(window[i], real[i]);
+    real[length - (i + 1)] = M::multiply(window[i], real[length - (i + 1)]);
+  }
+  profile_end(PROFILE_WINDOW);
+
+  profile_begin(PROFILE_FFT);
+  if (signal->real_fft_enabled) {
+    fft_real_magnitude<M>(real, samples, length, sine, signal->sine_quarter);
+    profile_end(PROFILE_FFT);
+  }
+  else {
+    if (sine != NULL) {
+      fft_complex<M>(real, imag, 1, samples, sine, signal->sine_quarter);
+    }
+    else {
+      default_fft(real, imag, samples);
+    }
+    profile_end(PROFILE_FFT);
+
+    profile_begin(PROFILE_MAGNITUDE);
+    for (int i = 0; i < length; i++) {
+      real[i] = M::magnitude(real[i], imag[i]);
+    }
+    profile_end(PROFILE_MAGNITUDE);
+  }
+
+  signal->magnitude_scale = M::scale(samples, shift);
+}
+
+/**
+ * @brief compute signal spectrum using arduinoFFt lib. (double and float)
+ * @brief or the fixed point FFT (Q15 and Q31)
  * @details the original time domain signal is overwritten
+ * @details fixed point samples are scaled to full range before windowing.
+ * @details magnitude_scale brings the spectrum back to the double scale 
+ * @details so that peak powers can be compared to the same thresholds
+ * @details the window and the twiddle factors come from the signal's tables
+ * @details with refinement enabled, the windowed frame is kept (see refine_frequency())
  */
 void compute_spectrum(signal_t* signal) 
 {
-  arduinoFFT FFT;
-  FFT.Windowing(signal->real, signal->length, signal->window_type, FFT_FORWARD);
-  FFT.Compute(signal->real, signal->imag, signal->length_with_padding, FFT_FORWARD); 
-  FFT.ComplexToMagnitude(signal->real, signal->imag, signal->length);
+  save_frame(signal);
+
+  switch (signal->sample_type) {
+    case SAMPLE_DOUBLE: compute_typed_spectrum<floating_math<double>, double>(signal); break;
+    case SAMPLE_FLOAT:  compute_typed_spectrum<floating_math<float>, float>(signal);   break;
+    case SAMPLE_Q15:    compute_typed_spectrum<q15_math, q15_t>(signal);               break;
+    case SAMPLE_Q31:    compute_typed_spectrum<q31_math, q31_t>(signal);               break;
+  }
+}
+
+/**
+ * @brief compute the spectra of 'count' signals of type T with the math policy M
+ * @details same steps as compute_typed_spectrum(), with a batched FFT
+ */
+template <typename M, typename T>
+static void compute_typed_spectra(signal_t** signals, int count)
+{
+  T* real[BATCH_MAX_SIGNALS];
+  T* imag[BATCH_MAX_SIGNALS];
+  int shift[BATCH_MAX_SIGNALS];
+  const T* window = (const T*) signals[0]->window;
+  const T* sine = (const T*) signals[0]->sine;
+  int quarter = signals[0]->sine_quarter;
+  int length = signals[0]->length;
+  int samples = signals[0]->length_with_padding;
+  int real_fft = signals[0]->real_fft_enabled;
+
+  profile_begin(PROFILE_WINDOW);
+  for (int n = 0; n < count; n++) {
+    real[n] = (T*) signals[n]->real;
+    imag[n] = real_fft ? real[n] + 1 : (T*) signals[n]->imag;
+    shift[n] = M::normalize(real[n], length);
+
+    for (int i = 0; i < (length >> 1); i++) {
+      real[n][i] = M::multiply(window[i], real[n][i]);
+      real[n][length - (i + 1)] = M::multiply(window[i], real[n][length - (i + 1)]);
+    }
+  }
+  profile_end(PROFILE_WINDOW);
+
+  profile_begin(PROFILE_FFT);
+  if (real_fft) {
+    fft_complex_batch<M>(real, imag, count, 2, samples >> 1, sine, quarter);
+    for (int n = 0; n < count; n++) {
+      fft_real_split<M>(real[n], samples, length, sine, quarter);
+    }
+    profile_end(PROFILE_FFT);
+  }
+  else {
+    fft_complex_batch<M>(real, imag, count, 1, samples, sine, quarter);
+    profile_end(PROFILE_FFT);
+
+    profile_begin(PROFILE_MAGNITUDE);
+    for (int n = 0; n < count; n++) {
+      for (int i = 0; i < length; i++) {
+        real[n][i] = M::magnitude(real[n][i], imag[n][i]);
+      }
+    }
+    profile_end(PROFILE_MAGNITUDE);
+  }
+
+  for (int n = 0; n < count; n++) {
+    signals[n]->magnitude_scale = M::scale(samples, shift[n]);
+  }
+}
+
+/**
+ * @brief compute the spectra of several signals with one batched FFT
+ * @param signals signals of the same length, padding, sample type and FFT 
+ * @param signals type, windowed with the first signal's window table
+ * @param count at most BATCH_MAX_SIGNALS
+ * @returns 1 if OK, 0 if the signals do not match (nothing is computed)
+ * @details each signal ends as after compute_spectrum().  The FFT's twiddle 
+ * @details factors are computed (or read from the first signal's table) once 
+ * @details for all signals; share the tables (see share_tables()) to keep a 
+ * @details single copy of them in RAM and in cache.
+ * @details The batch pays off from about BATCH_MIN_SIGNALS signals: float
+ * @details samples with the real FFT and a twiddle table run at 0.76x the speed
+ * @details of separate compute_spectrum() calls for 1 signal and 0.95x for 2.
+ * @details Below that, or for floating point signals without a twiddle table
+ * @details (arduinoFFT beats the library's FFT computing its twiddle factors:
+ * @details 0.59x to 0.93x), each signal goes through compute_spectrum(),
+ * @details with its own window table.
+ */
+int compute_spectra(signal_t** signals, int count)
+{
+  if (count < 1 || count > BATCH_MAX_SIGNALS) return 0;
+
+  for (int n = 1; n < count; n++) {
+    if (signals[n]->length != signals[0]->length ||
+        signals[n]->length_with_padding != signals[0]->length_with_padding ||
+        signals[n]->sample_type != signals[0]->sample_type ||
+        signals[n]->real_fft_enabled != signals[0]->real_fft_enabled) {
+      return 0;
+    }
+  }
+
+  int floating = signals[0]->sample_type == SAMPLE_DOUBLE || signals[0]->sample_type == SAMPLE_FLOAT;
+  if (count < BATCH_MIN_SIGNALS || (floating && signals[0]->sine == NULL)) {
+    for (int n = 0; n < count; n++) {
+      compute_spectrum(signals[n]);
+    }
+    return 1;
+  }
+
+  for (int n = 0; n < count; n++) {
+    save_frame(signals[n]);
+  }
+
+  switch (signals[0]->sample_type) {
+    case SAMPLE_DOUBLE: compute_typed_spectra<floating_math<double>, double>(signals, count); break;
+    case SAMPLE_FLOAT:  compute_typed_spectra<floating_math<float>, float>(signals, count);   break;
+    case SAMPLE_Q15:    compute_typed_spectra<q15_math, q15_t>(signals, count);               break;
+    case SAMPLE_Q31:    compute_typed_spectra<q31_math, q31_t>(signals, count);               break;
+  }
+  return 1;
+}
+
+/**
+ * @brief compute the autocorrelation of samples of type T with the math policy M
+ * @details the power spectrum of a real signal is real and even: its forward 
+ * @details FFT is the inverse FFT, i.e. the autocorrelation (times a constant)
+ */
+template <typename M, typename T>
+static void compute_typed_autocorrelation(signal_t* signal)
+{
+  T* real = (T*) signal->real;
+  T* imag = (T*) signal->imag;
+  const T* sine = (const T*) signal->sine;
+  int samples = signal->length_with_padding;
+  int length = signal->length;
+  float energy = 0.0f;
+
+  // MPM's m(lag) = sum of x[j]^2 + x[j+lag]^2, j in [0, length-lag), relative to m(0)
+  for (int i = 0; i < length; i++) {
+    energy += (float) real[i] * (float) real[i];
+  }
+  float m = 2.0f * energy;
+  signal->lag_energy[0] = 1.0f;
+  for (int lag = 1; lag <= (length >> 1); lag++) {
+    m -= (float) real[lag - 1] * (float) real[lag - 1] + (float) real[length - lag] * (float) real[length - lag];
+    signal->lag_energy[lag] = energy > 0.0f ? m / (2.0f * energy) : 0.0f;
+  }
+
+  M::normalize(real, length);
+  memset(imag, 0, samples * signal->sample_size);
+
+  // not arduinoFFT: it sets bin 0 to 0, which would be the lag 0 value here
+  fft_complex<M>(real, imag, 1, samples, sine, signal->sine_quarter);
+
+  // power spectrum (block floating point for the fixed point types)
+  M::power(real, imag, samples);
+  M::normalize(real, samples);
+  fft_complex<M>(real, imag, 1, samples, sine, signal->sine_quarter);
+
+  signal->magnitude_scale = 1.0;
+}
+
+/**
+ * @brief replace the signal by its autocorrelation (lag 0 to length-1)
+ * @returns 1 if OK, 0 if the signal has no imaginary array (real input FFT) 
+ * @returns or if out of memory
+ * @details to be called instead of compute_spectrum() for ESTIMATOR_MPM
+ * @details (see find_period_fundamental()).  The signal is not windowed.
+ * @details The autocorrelation is only known within a constant factor.
+ * @details Zero padding should be enabled, otherwise it is circular.
+ * @details The first call allocates length/2 floats for MPM's normalization.
+ */
+int compute_autocorrelation(signal_t* signal)
+{
+  if (signal->imag == NULL) return 0;
+
+  if (signal->lag_energy == NULL) {
+    signal->lag_energy = (float*) malloc(((signal->length >> 1) + 1) * sizeof(float));
+    if (signal->lag_energy == NULL) return 0;
+  }
+
+  profile_begin(PROFILE_AUTOCORRELATION);
+  save_frame(signal);
+
+  switch (signal->sample_type) {
+    case SAMPLE_DOUBLE: compute_typed_autocorrelation<floating_math<double>, double>(signal); break;
+    case SAMPLE_FLOAT:  compute_typed_autocorrelation<floating_math<float>, float>(signal);   break;
+    case SAMPLE_Q15:    compute_typed_autocorrelation<q15_math, q15_t>(signal);               break;
+    case SAMPLE_Q31:    compute_typed_autocorrelation<q31_math, q31_t>(signal);               break;
+  }
+  profile_end(PROFILE_AUTOCORRELATION);
+  return 1;
 }
 
 /**
@@ -191,7 +1007,7 @@ void compute_spectrum(signal_t* signal)
  * @param frequency frequency to be converted to index
  */
 int frequency_to_index(signal_t* signal, double frequency) {
-  return round(frequency * signal->length_with_padding / signal->sampling_frequency);
+  return round(frequency / signal->bin_width);
 }
 
 /**
@@ -199,7 +1015,7 @@ int frequency_to_index(signal_t* signal, double frequency) {
  * @param index index to be converted to a frequency
  */
 double index_to_frequency(signal_t* signal, double index) {
-  return index * signal->sampling_frequency / signal->length_with_padding;
+  return index * signal->bin_width;
 }
 
 /**
@@ -212,11 +1028,81 @@ void erase_signal_at_peak(signal_t* signal, peak_t* peak)
   int index = peak->index - (ERASER_SIZE) / 2;
   index = index < 0 ? 0 : index;
 
-  for (int i = 0; i < ERASER_SIZE && index < signal->length; i++) {
-    signal->real[index++] = 0.0;
+  int count = signal->length - index;
+  count = count > ERASER_SIZE ? ERASER_SIZE : count;
+
+  if (count > 0) {
+    memset((char*) signal->real + index * signal->sample_size, 0, count * signal->sample_size);
   }
 }
 
+/**
+ * @brief find the highest peak around a frequency
+ * @param frequency center of the search window
+ * @details the window is TRACK_WINDOW wide, but at least TRACK_BINS bins on each side
+ */
+static peak_t find_peak_near(signal_t* signal, double frequency)
+{
+  double half_window = frequency * TRACK_WINDOW;
+  double smallest = index_to_frequency(signal, TRACK_BINS);
+
+  if (half_window < smallest) half_window = smallest;
+  return find_highest_power(signal, frequency - half_window, frequency + half_window);
+}
+
+/**
+ * @brief build the peak list from narrow windows around the tracked fundamental
+ * @returns 1 if the fundamental was found, 0 otherwise (the list is then empty)
+ * @details harmonics are added first so that the fundamental is the list's last peak
+ */
+static int compute_tracked_peak_list(signal_t* signal, double low_frequency, double high_frequency)
+{
+  double predicted = get_predicted_frequency(signal->list);
+  peak_t fundamental;
+  peak_t harmonic;
+
+  if (predicted < low_frequency || predicted > high_frequency) return 0;
+
+  fundamental = find_peak_near(signal, predicted);
+  if (fundamental.index == -1 || fundamental.power < signal->lowest_power) return 0;
+
+  for (int multiplier = TRACK_HARMONICS; multiplier >= 2; multiplier--) {
+    if (predicted * multiplier > high_frequency) continue;
+
+    harmonic = find_peak_near(signal, predicted * multiplier);
+    if (harmonic.index != -1 && harmonic.power >= signal->lowest_power) {
+      add_peak(signal->list, &harmonic);
+    }
+  }
+
+  add_peak(signal->list, &fundamental);
+  return 1;
+}
+
+static void compute_full_peak_list(signal_t* signal, double low_frequency, double high_frequency);
+static void refine_fundamental(signal_t* signal);
+
+/**
+ * @brief set the peak search thresholds (LOWEST_PEAK_POWER, HIGHEST_RATIO and 
+ * @brief SEARCH_WINDOW by default)
+ * @param lowest_power lowest power of a peak (on the double spectrum scale)
+ * @param highest_ratio lowest power of a divider peak, relative to the highest peak
+ * @param search_window half width of the window around a divider frequency, 
+ * @param search_window relative to this frequency
+ * @returns 1 if OK, 0 if a threshold is out of range (thresholds are unchanged)
+ */
+int set_peak_thresholds(signal_t* signal, double lowest_power, double highest_ratio, 
+                        double search_window)
+{
+  if (lowest_power < 0.0 || highest_ratio < 0.0 || search_window <= 0.0 || search_window >= 0.5) {
+    return 0;
+  }
+  signal->lowest_power = lowest_power;
+  signal->highest_ratio = highest_ratio;
+  signal->search_window = search_window;
+  return 1;
+}
+
 /**
  * @brief find the PEAK_NUMBER highest peaks from the signal
  * @param low_frequency the starting frequency of peak search
@@ -224,6 +1110,35 @@ void erase_signal_at_peak(signal_t* signal, peak_t* peak)
  * @details the list is in decreasing order of peak power 
  * @details (highest peak is at index 0). 
  * @details this function modifies the spectrum data
+ * @details if the peak list tracks a fundamental (see enable_tracking()), 
+ * @details only narrow windows around it and its harmonics are searched.
+ * @details The whole band is scanned when the fundamental is lost.
+ * @details With refinement enabled, the fundamental's frequency is refined.
+ */
+void compute_peak_list(signal_t* signal, double low_frequency, double high_frequency)
+{
+  profile_begin(PROFILE_PEAK_LIST);
+  erase_peak_list(signal->list);
+
+  if (is_tracking(signal->list)) {
+    if (compute_tracked_peak_list(signal, low_frequency, high_frequency)) {
+      refine_fundamental(signal);
+      update_tracking(signal->list);
+      profile_end(PROFILE_PEAK_LIST);
+      return;
+    }
+    // lost: lower confidence, then scan the whole band
+    update_tracking(signal->list);
+  }
+
+  compute_full_peak_list(signal, low_frequency, high_frequency);
+  refine_fundamental(signal);
+  update_tracking(signal->list);
+  profile_end(PROFILE_PEAK_LIST);
+}
+
+/**
+ * @brief find the highest peak of the band, then its sub-harmonics
  */
 /*
 "The fundamental frequency of a signal is the greatest common divisor (GCD) 
@@ -235,7 +1150,7 @@ http://fourier.eng.hmc.edu/e59/lectures/Fundamental_Frequency/node1.html
 
 #include <stdio.h>
 
-void compute_peak_list(signal_t* signal, double low_frequency, double high_frequency)
+static void compute_full_peak_list(signal_t* signal, double low_frequency, double high_frequency)
 {
   peak_t highest;
   double candidate_frequency;
@@ -260,7 +1175,7 @@ void compute_peak_list(signal_t* signal, double low_frequency, double high_frequ
 
   // find highest peak in entire frequency range
   highest = find_highest_power(signal, low_frequency, high_frequency);
-  if (highest.power < LOWEST_PEAK_POWER) return;
+  if (highest.power < signal->lowest_power) return;
   add_peak(signal->list, &highest);
 
   // check if peaks exist in the spectrum at lower frequencies that
@@ -272,13 +1187,13 @@ void compute_peak_list(signal_t* signal, double low_frequency, double high_frequ
     if (candidate_frequency < low_frequency) return;
 
     // define a search window where the peak will be sought
-    candidate_low = candidate_frequency - candidate_frequency * SEARCH_WINDOW;
-    candidate_high = candidate_frequency + candidate_frequency * SEARCH_WINDOW;
+    candidate_low = candidate_frequency - candidate_frequency * signal->search_window;
+    candidate_high = candidate_frequency + candidate_frequency * signal->search_window;
     peak_found = find_highest_power(signal, candidate_low, candidate_high);
 
     // if a peak was found in the search window, make sure its power is sufficient
     if (peak_found.index != -1) {
-      if (peak_found.power > highest.power * HIGHEST_RATIO) {
+      if (peak_found.power > highest.power * signal->highest_ratio) {
         add_peak(signal->list, &peak_found);
       }
     }
@@ -302,7 +1217,6 @@ peak_t find_highest_power(signal_t* signal, double low_frequency, double high_fr
   int low_index;
   int high_index;
   int max_index;
-  double max_power;
   int is_max;
 
   // to be returned if a peak is not found
@@ -316,14 +1230,7 @@ peak_t find_highest_power(signal_t* signal, double low_frequency, double high_fr
   if (high_index >= signal->length-1) return not_found;
 
   // find max peak in specified frequency range
-  max_index = low_index;
-  max_power = signal->real[low_index];
-  for (int i = low_index; i <= high_index; i++) {
-    if (max_power < signal->real[i]) {
-      max_power = signal->real[i]; 
-      max_index = i;
-    }
-  }
+  max_index = find_peak_index(signal, low_index, high_index);
 
   /*
   sprintf(uuu[uuu_c++], "li = %d, hi = %d, mi = %d", low_index, high_index, max_index);
@@ -334,13 +1241,71 @@ peak_t find_highest_power(signal_t* signal, double low_frequency, double high_fr
   if (max_index == high_index) return not_found;
 
   // power at max_index must be surrounded by lower power values
-  is_max = signal->real[max_index] > signal->real[max_index-1] &&
-           signal->real[max_index] > signal->real[max_index+1];
+  is_max = get_value(signal, max_index) > get_value(signal, max_index-1) &&
+           get_value(signal, max_index) > get_value(signal, max_index+1);
   if (!is_max) return not_found;
 
   return find_precise_peak(signal, max_index);  
 }
 
+/**
+ * @brief return the index of the highest value of array in [low_index, high_index]
+ */
+template <typename T>
+static int find_array_peak_index(T* array, int low_index, int high_index)
+{
+  int max_index = low_index;
+  T max_power = array[low_index];
+
+  for (int i = low_index; i <= high_index; i++) {
+    if (max_power < array[i]) {
+      max_power = array[i]; 
+      max_index = i;
+    }
+  }
+  return max_index;
+}
+
+/**
+ * @brief find the index of the highest spectrum value in [low_index, high_index]
+ */
+int find_peak_index(signal_t* signal, int low_index, int high_index)
+{
+  switch (signal->sample_type) {
+    case SAMPLE_FLOAT: return find_array_peak_index((float*) signal->real, low_index, high_index);
+    case SAMPLE_Q15:   return find_array_peak_index((q15_t*) signal->real, low_index, high_index);
+    case SAMPLE_Q31:   return find_array_peak_index((q31_t*) signal->real, low_index, high_index);
+    default:           return find_array_peak_index((double*) signal->real, low_index, high_index);
+  }
+}
+
+/**
+ * @brief parabolic interpolation around a floating point spectrum maximum
+ * @param delta offset of the parabola's apex from index (in bins)
+ * @param power peak power
+ */
+template <typename T>
+static void interpolate_floating_peak(T* array, int index, double* delta, double* power)
+{
+  *delta = (array[index-1] - array[index+1]) * (T) 0.5 /
+           (array[index-1] - ((T) 2.0 * array[index]) + array[index+1]);
+  *power = (array[index-1] + ((T) 2.0 * array[index]) + array[index+1]) / 4;
+}
+
+/**
+ * @brief parabolic interpolation around a fixed point spectrum maximum
+ * @details computed with integers, delta has 16 fractional bits
+ */
+template <typename T>
+static void interpolate_fixed_peak(T* array, int index, double* delta, double* power)
+{
+  int64_t numerator = (int64_t) array[index-1] - array[index+1];
+  int64_t denominator = (int64_t) array[index-1] - 2 * (int64_t) array[index] + array[index+1];
+
+  *delta = denominator ? (double) ((numerator << 15) / denominator) / 65536.0 : 0.0;
+  *power = (double) (((int64_t) array[index-1] + 2 * (int64_t) array[index] + array[index+1]) / 4);
+}
+
 /**
  * @brief find the precise frequency of a peak given its index
  * @param signal struct containing signal info (the spectrum)
@@ -351,20 +1316,428 @@ peak_t find_precise_peak(signal_t* signal, int index)
 {
   peak_t precise_peak;
   double delta;
-  double interpolated_frequency;
+  double power;
 
-  delta = (signal->real[index-1] - signal->real[index+1]) * 0.5 /
-          (signal->real[index-1] - (2.0 * signal->real[index]) + signal->real[index+1]);
+  erase_peak(&precise_peak);
 
-  interpolated_frequency = index_to_frequency(signal, index + delta);
+  switch (signal->sample_type) {
+    case SAMPLE_FLOAT: interpolate_floating_peak((float*) signal->real, index, &delta, &power);  break;
+    case SAMPLE_Q15:   interpolate_fixed_peak((q15_t*) signal->real, index, &delta, &power);     break;
+    case SAMPLE_Q31:   interpolate_fixed_peak((q31_t*) signal->real, index, &delta, &power);     break;
+    default:           interpolate_floating_peak((double*) signal->real, index, &delta, &power); break;
+  }
 
   precise_peak.index = index;
-  precise_peak.frequency = interpolated_frequency;
-  precise_peak.power = (signal->real[index-1] + (2.0 * signal->real[index]) + signal->real[index+1]) / 4;
+  precise_peak.frequency = index_to_frequency(signal, index + delta);
+  precise_peak.power = power * signal->magnitude_scale;
 
   return precise_peak;
 }
 
+/**
+ * @brief enable or disable frequency refinement (disabled by default)
+ * @returns 1 on success, 0 if out of memory (refinement is then disabled)
+ * @details compute_spectrum() and compute_autocorrelation() then keep a copy 
+ * @details of the windowed frame: 'length' floats of RAM.  The fundamental 
+ * @details found by compute_peak_list() and estimate_fundamental() is refined
+ * @details with refine_frequency().
+ */
+int enable_refinement(signal_t* signal, int enabled)
+{
+  if (!enabled) {
+    free(signal->frame);
+    signal->frame = NULL;
+    return 1;
+  }
+
+  if (signal->frame == NULL) {
+    signal->frame = (float*) malloc(signal->length * sizeof(float));
+    if (signal->frame == NULL) return 0;
+    memset(signal->frame, 0, signal->length * sizeof(float));
+  }
+  return 1;
+}
+
+int is_refinement_enabled(signal_t* signal) { return signal->frame != NULL; }
+
+/**
+ * @brief power of the saved frame at frequency (Goertzel algorithm)
+ * @details the frequency does not have to be a bin's: this is the DTFT 
+ * @details of the windowed frame.  Costs one multiplication per sample.
+ */
+static double goertzel_power(signal_t* signal, double frequency)
+{
+  float coefficient = (float) (2.0 * cos(2.0 * M_PI * frequency / signal->sampling_frequency));
+  float s1 = 0.0f;
+  float s2 = 0.0f;
+
+  for (int i = 0; i < signal->length; i++) {
+    float s0 = signal->frame[i] + coefficient * s1 - s2;
+    s2 = s1;
+    s1 = s0;
+  }
+  return (double) s1 * s1 + (double) s2 * s2 - (double) coefficient * s1 * s2;
+}
+
+/**
+ * @brief offset of the apex of a parabola through the logarithm of three powers
+ * @returns the offset from the center point, in steps
+ * @details the main lobe of the Hamming window is close to a gaussian, 
+ * @details a parabola on the log scale
+ */
+static double interpolate_log_peak(double left, double center, double right)
+{
+  if (left <= 0.0 || center <= 0.0 || right <= 0.0) return 0.0;
+
+  left = log(left);
+  center = log(center);
+  right = log(right);
+
+  double denominator = left - 2.0 * center + right;
+  return denominator < 0.0 ? 0.5 * (left - right) / denominator : 0.0;
+}
+
+/**
+ * @brief Goertzel bank and interpolations of refine_frequency()
+ */
+static double search_frequency(signal_t* signal, double frequency)
+{
+  double bin = signal->sampling_frequency / signal->length_with_padding;
+  double low = frequency - REFINE_BINS * bin;
+  double power[REFINE_POINTS];
+  int best = 0;
+
+  if (low <= 0.0) return frequency;
+
+  for (int i = 0; i < REFINE_POINTS; i++) {
+    power[i] = goertzel_power(signal, low + i * REFINE_STEP * bin);
+    if (power[i] > power[best]) best = i;
+  }
+
+  // the peak is not within the bank
+  if (best == 0 || best == REFINE_POINTS - 1) return frequency;
+
+  double delta = interpolate_log_peak(power[best - 1], power[best], power[best + 1]);
+  double center = low + (best + delta) * REFINE_STEP * bin;
+  double step = REFINE_FINE_STEP * bin;
+
+  delta = interpolate_log_peak(goertzel_power(signal, center - step), goertzel_power(signal, center),
+                               goertzel_power(signal, center + step));
+  return center + delta * step;
+}
+
+/**
+ * @brief refine the frequency of a spectral peak beyond the spectrum's resolution
+ * @param frequency coarse frequency of the peak
+ * @returns the refined frequency, or frequency if refinement is disabled or 
+ * @returns if no maximum was found within REFINE_BINS bins
+ * @details a bank of REFINE_POINTS Goertzel filters spans +/- REFINE_BINS 
+ * @details bins around frequency.  A parabola through the log powers 
+ * @details around the highest one gives a first estimate, refined by a 
+ * @details second parabola with REFINE_FINE_STEP spacing.  With 1024 
+ * @details samples at 4000 Hz, the error on a clean tone drops from about 
+ * @details 0.03 Hz (parabola on the spectrum) to under 0.01 Hz, for the 
+ * @details cost of 12 Goertzel filters instead of a larger FFT.
+ */
+double refine_frequency(signal_t* signal, double frequency)
+{
+  if (signal->frame == NULL) return frequency;
+
+  profile_begin(PROFILE_REFINE);
+  frequency = search_frequency(signal, frequency);
+  profile_end(PROFILE_REFINE);
+  return frequency;
+}
+
+/**
+ * @brief refine the fundamental of the peak list (its last peak), see refine_frequency()
+ */
+static void refine_fundamental(signal_t* signal)
+{
+  peak_t fundamental = find_fundamental_frequency(signal->list);
+
+  if (signal->frame == NULL || fundamental.index == -1) return;
+
+  fundamental.frequency = refine_frequency(signal, fundamental.frequency);
+  set_peak(signal->list, list_size(signal->list) - 1, &fundamental);
+}
+
+/**
+ * @brief index of the highest value around the harmonic of a candidate fundamental
+ * @details the tolerance grows with the harmonic number (the fundamental's 
+ * @details index is only known within half a bin)
+ */
+template <typename T>
+static int find_harmonic_index(T* array, int index, int harmonic)
+{
+  int spread = harmonic >> 1;
+  return find_array_peak_index(array, index * harmonic - spread, index * harmonic + spread);
+}
+
+/**
+ * @brief score every candidate fundamental index in [low_index, high_index] in one pass
+ * @param limit harmonics at or above this index are ignored
+ * @param best_index the candidate with the highest score
+ * @returns the confidence of best_index: 1 - mean sum / best_index's sum, within [0, 1]
+ * @details the score is the sum (harmonic summation) or the product (harmonic
+ * @details product spectrum) of the HARMONIC_NUMBER harmonics' magnitudes.
+ * @details Sums are accumulated in type A (integer types for fixed point).
+ * @details The confidence always uses the sums: products are too peaky.  The
+ * @details product's winner may have a sum below the mean: its confidence is 0.
+ */
+template <typename T, typename A>
+static double score_harmonics(T* array, int limit, int low_index, int high_index, int estimator,
+                              int* best_index)
+{
+  double best_score = 0.0;
+  double best_sum = 0.0;
+  double total_sum = 0.0;
+
+  *best_index = -1;
+
+  for (int i = low_index; i <= high_index; i++) {
+    A sum = 0;
+    double product = 1.0;
+
+    for (int k = 1; k <= HARMONIC_NUMBER && i * k + (k >> 1) < limit; k++) {
+      T value = array[find_harmonic_index(array, i, k)];
+      sum += value;
+      product *= (double) value;
+    }
+
+    double score = estimator == ESTIMATOR_HARMONIC_PRODUCT ? product : (double) sum;
+    total_sum += (double) sum;
+    if (score > best_score) {
+      best_score = score;
+      best_sum = (double) sum;
+      *best_index = i;
+    }
+  }
+
+  if (*best_index == -1 || best_sum <= 0.0) return 0.0;
+  double confidence = 1.0 - total_sum / (high_index - low_index + 1) / best_sum;
+  return confidence < 0.0 ? 0.0 : confidence;
+}
+
+/**
+ * @brief estimate the fundamental directly from the spectrum's harmonics
+ * @param estimator ESTIMATOR_HARMONIC_SUM or ESTIMATOR_HARMONIC_PRODUCT
+ * @returns the fundamental, with its confidence, or index = -1 if not found
+ * @details every candidate in [low_frequency, high_frequency] is scored in a
+ * @details single pass over the magnitude spectrum.  The frequency is refined 
+ * @details on the strongest harmonic of the best candidate (divided by its 
+ * @details harmonic number) and its power is this harmonic's power.
+ * @details It must be at least the lowest peak power (see set_peak_thresholds()).
+ * @details With refinement enabled, the harmonic's frequency goes through
+ * @details refine_frequency().
+ */
+peak_t find_harmonic_fundamental(signal_t* signal, double low_frequency, double high_frequency, 
+                                 int estimator)
+{
+  peak_t not_found;
+  peak_t strongest;
+  int low_index = frequency_to_index(signal, low_frequency);
+  int high_index = frequency_to_index(signal, high_frequency);
+  int limit = signal->length - 1;    // keep a neighbour for peak interpolation
+  int best_index;
+  int harmonic_index;
+  int strongest_harmonic = 1;
+  double confidence;
+
+  erase_peak(&not_found);
+
+  if (low_index <= 0) low_index = 1;
+  if (high_index >= limit) high_index = limit - 1;
+  if (low_index > high_index) return not_found;
+
+  switch (signal->sample_type) {
+    case SAMPLE_FLOAT:
+      confidence = score_harmonics<float, float>((float*) signal->real, limit, low_index, high_index,
+                                                 estimator, &best_index);
+      break;
+    case SAMPLE_Q15:
+      confidence = score_harmonics<q15_t, int32_t>((q15_t*) signal->real, limit, low_index, high_index,
+                                                   estimator, &best_index);
+      break;
+    case SAMPLE_Q31:
+      confidence = score_harmonics<q31_t, int64_t>((q31_t*) signal->real, limit, low_index, high_index,
+                                                   estimator, &best_index);
+      break;
+    default:
+      confidence = score_harmonics<double, double>((double*) signal->real, limit, low_index, high_index,
+                                                   estimator, &best_index);
+      break;
+  }
+  if (best_index == -1) return not_found;
+
+  // refine on the strongest harmonic
+  harmonic_index = best_index;
+  for (int k = 2; k <= HARMONIC_NUMBER && best_index * k + (k >> 1) < limit; k++) {
+    int index = find_peak_index(signal, best_index * k - (k >> 1), best_index * k + (k >> 1));
+    if (get_value(signal, index) > get_value(signal, harmonic_index)) {
+      harmonic_index = index;
+      strongest_harmonic = k;
+    }
+  }
+
+  strongest = find_precise_peak(signal, harmonic_index);
+  if (strongest.power < signal->lowest_power) return not_found;
+  strongest.frequency = refine_frequency(signal, strongest.frequency);
+
+  strongest.index = best_index;
+  strongest.frequency /= strongest_harmonic;
+  strongest.confidence = confidence;
+  return strongest;
+}
+
+/**
+ * @brief normalized square difference function (NSDF) at lag from the autocorrelation
+ * @param energy autocorrelation at lag 0
+ * @details NSDF = 2 r(lag) / m(lag) = (r(lag) / r(0)) / (m(lag) / m(0))
+ */
+static double get_nsdf(signal_t* signal, int lag, double energy)
+{
+  float ratio = signal->lag_energy[lag];
+  return ratio > 0.0f ? get_value(signal, lag) / (energy * ratio) : 0.0;
+}
+
+/**
+ * @brief estimate the fundamental from the signal's autocorrelation (McLeod pitch method)
+ * @returns the fundamental, or index = -1 if not found
+ * @details compute_autocorrelation() must have been called.  Lags are limited 
+ * @details to length/2 (two periods in the signal).  Key maxima are 
+ * @details the highest NSDF values of the positive lobes, after the lag 0 lobe.
+ * @details The first key maximum above MPM_THRESHOLD times the highest one
+ * @details gives the period, refined by parabolic interpolation.  Its NSDF 
+ * @details value (clarity) is the confidence; it must be at least MPM_CLARITY.
+ * @details index is the period in samples and power is left at 0.
+ * @details With refinement enabled, the frequency goes through refine_frequency().
+ */
+peak_t find_period_fundamental(signal_t* signal, double low_frequency, double high_frequency)
+{
+  peak_t fundamental;
+  int low_lag = (int) (signal->sampling_frequency / high_frequency);
+  int high_lag = (int) ceil(signal->sampling_frequency / low_frequency);
+  double energy = get_value(signal, 0);
+  int key[MPM_KEY_NUMBER];
+  int n_key = 0;
+  int lag;
+  int best = -1;
+
+  erase_peak(&fundamental);
+
+  if (energy <= 0.0 || signal->lag_energy == NULL) return fundamental;
+  if (low_lag < 1) low_lag = 1;
+  if (high_lag > (signal->length >> 1) - 2) high_lag = (signal->length >> 1) - 2;
+
+  // skip the lag 0 lobe
+  for (lag = 1; lag <= high_lag && get_nsdf(signal, lag, energy) > 0.0; lag++);
+
+  // key maxima of the positive lobes
+  while (lag <= high_lag && n_key < MPM_KEY_NUMBER) {
+    int lobe_max = -1;
+    double lobe_value = 0.0;
+
+    for (; lag <= high_lag && get_nsdf(signal, lag, energy) <= 0.0; lag++);
+    for (; lag <= high_lag + 1; lag++) {
+      double value = get_nsdf(signal, lag, energy);
+      if (value <= 0.0) break;
+      if (value > lobe_value) {
+        lobe_value = value;
+        lobe_max = lag;
+      }
+    }
+
+    if (lobe_max >= low_lag && lobe_max <= high_lag) {
+      key[n_key++] = lobe_max;
+      if (best == -1 || lobe_value > get_nsdf(signal, key[best], energy)) best = n_key - 1;
+    }
+  }
+
+  if (best == -1) return fundamental;
+
+  double threshold = MPM_THRESHOLD * get_nsdf(signal, key[best], energy);
+  for (int i = 0; i < n_key; i++) {
+    if (get_nsdf(signal, key[i], energy) >= threshold) {
+      best = i;
+      break;
+    }
+  }
+
+  // parabolic interpolation
+  lag = key[best];
+  double left = get_nsdf(signal, lag - 1, energy);
+  double center = get_nsdf(signal, lag, energy);
+  double right = get_nsdf(signal, lag + 1, energy);
+  double denominator = left - 2.0 * center + right;
+  double delta = denominator != 0.0 ? 0.5 * (left - right) / denominator : 0.0;
+  double clarity = center - 0.25 * (left - right) * delta;
+
+  if (clarity < MPM_CLARITY) return fundamental;
+
+  fundamental.index = lag;
+  fundamental.frequency = refine_frequency(signal, signal->sampling_frequency / (lag + delta));
+  fundamental.confidence = clarity > 1.0 ? 1.0 : clarity;
+  return fundamental;
+}
+
+/**
+ * @brief select the estimator used by estimate_fundamental()
+ * @param estimator ESTIMATOR_PEAK_LIST (default), ESTIMATOR_HARMONIC_SUM,
+ * @param estimator ESTIMATOR_HARMONIC_PRODUCT or ESTIMATOR_MPM
+ * @details ESTIMATOR_MPM needs compute_autocorrelation() instead of compute_spectrum()
+ */
+void set_fundamental_estimator(signal_t* signal, int estimator)
+{
+  signal->estimator = estimator;
+}
+
+/**
+ * @brief estimate_fundamental() with the selected estimator
+ */
+static peak_t estimate_selected_fundamental(signal_t* signal, double low_frequency, double high_frequency)
+{
+  peak_t fundamental;
+
+  if (signal->estimator == ESTIMATOR_PEAK_LIST) {
+    compute_peak_list(signal, low_frequency, high_frequency);
+    fundamental = find_fundamental_frequency(signal->list);
+    fundamental.confidence = fundamental.index == -1 ? 0.0 : 1.0;
+    return fundamental;
+  }
+
+  if (signal->estimator == ESTIMATOR_MPM) {
+    fundamental = find_period_fundamental(signal, low_frequency, high_frequency);
+  }
+  else {
+    fundamental = find_harmonic_fundamental(signal, low_frequency, high_frequency, signal->estimator);
+  }
+
+  erase_peak_list(signal->list);
+  if (fundamental.index != -1) {
+    add_peak(signal->list, &fundamental);
+  }
+  update_tracking(signal->list);
+
+  if (fundamental.index == -1) return fundamental;
+  return find_fundamental_frequency(signal->list);
+}
+
+/**
+ * @brief estimate the fundamental frequency of the spectrum with the selected estimator
+ * @returns the fundamental, or index = -1 if not found
+ * @details the peak list holds the result, so that fundamental tracking 
+ * @details (see enable_tracking()) applies to every estimator.  The peak list 
+ * @details estimator has no confidence measure: it reports 1 when found.
+ */
+peak_t estimate_fundamental(signal_t* signal, double low_frequency, double high_frequency)
+{
+  profile_begin(PROFILE_FUNDAMENTAL);
+  peak_t fundamental = estimate_selected_fundamental(signal, low_frequency, high_frequency);
+  profile_end(PROFILE_FUNDAMENTAL);
+  return fundamental;
+}
+
 
 /**
  * @brief set array values to 0.0 
@@ -381,11 +1754,12 @@ void erase_array(double *array, int length)
 /**
  * @brief set signal (real & imag) and peal list values to 0.0 
  * @param signal struct containing signal info (the spectrum)
+ * @details in streaming mode, the ring buffer is emptied too
  */
 void erase_signal(signal_t* signal) {
   signal->index = 0;
-  erase_array(signal->real, signal->length_with_padding);
-  erase_array(signal->imag, signal->length_with_padding);
+  erase_ring(signal);
+  erase_buffers(signal);
   erase_peak_list(signal->list);
 }
 
@@ -19,31 +19,88 @@
 
 #define ZERO_PADDING_ENABLED  1
 #define ZERO_PADDING_DISABLED 0
+#define SAMPLE_DOUBLE         0       // sample types (see create_signal)
+#define SAMPLE_FLOAT          1
+#define SAMPLE_Q15            2
+#define SAMPLE_Q31            3
+#define REAL_FFT_ENABLED      1
+#define REAL_FFT_DISABLED     0
 #define ERASER_SIZE           9       // must be an odd number
 #define CYCLES_PER_MHZ        1000000.0
 #define LOWEST_PEAK_POWER     1000.0  // lowest peak power considered in peak search
 #define HIGHEST_RATIO         0.40    // ratio to highest peak power for a peak to be accepted
 #define SEARCH_WINDOW         0.07    // defines the frequency search window in peak detection
+#define ESTIMATOR_PEAK_LIST   0       // fundamental estimators (see estimate_fundamental)
+#define ESTIMATOR_HARMONIC_SUM     1
+#define ESTIMATOR_HARMONIC_PRODUCT 2
+#define ESTIMATOR_MPM         3       // McLeod pitch method (see compute_autocorrelation)
+#define HARMONIC_NUMBER       5       // harmonics scored by the harmonic estimators
+#define MPM_THRESHOLD         0.9     // first key maximum above this ratio of the highest one
+#define MPM_CLARITY           0.5     // lowest clarity (NSDF peak) of a pitched signal
+#define MPM_KEY_NUMBER        32      // most key maxima considered
+#define REFINE_BINS           2       // refinement: half width of the Goertzel bank (bins)
+#define REFINE_STEP           0.5     // refinement: Goertzel bank spacing (bins)
+#define REFINE_POINTS         9       // refinement: 2 * REFINE_BINS / REFINE_STEP + 1
+#define REFINE_FINE_STEP      0.125   // refinement: spacing of the final interpolation (bins)
+#define BATCH_MAX_SIGNALS     8       // most signals in a batched FFT (see compute_spectra)
+#define BATCH_MIN_SIGNALS     3       // fewest signals a batched FFT is faster for (see compute_spectra)
+#define SIGNAL_STATE_SIZE     448     // bytes of signal state for create_signal_at() (8 byte aligned)
 
 typedef struct signal signal_t;
 
-signal_t* create_signal(int length, double sampling_frequency, int zero_padding_enabled);
+/*
+ * Caller provided storage of a signal (see create_signal_at, static_signal.h)
+ */
+typedef struct signal_storage {
+    void* state;                // SIGNAL_STATE_SIZE bytes
+    void* real;                 // length_with_padding samples
+    void* imag;                 // length_with_padding samples (NULL with the real input FFT)
+    void* window;               // length/2 samples
+    void* peak_list;            // PEAK_LIST_STATE_SIZE bytes
+} signal_storage_t;
+
+signal_t* create_signal(int length, double sampling_frequency, int zero_padding_enabled,
+                        int sample_type = SAMPLE_DOUBLE, int real_fft_enabled = REAL_FFT_DISABLED);
+signal_t* create_signal_at(const signal_storage_t* storage, int length, double sampling_frequency,
+                           int zero_padding_enabled, int sample_type = SAMPLE_DOUBLE,
+                           int real_fft_enabled = REAL_FFT_DISABLED);
 void delete_signal(signal_t* signal);
 
 int get_length(signal_t* signal);
 int get_length_with_padding(signal_t* signal);
 int is_padding_enabled(signal_t* signal);
+int is_real_fft_enabled(signal_t* signal);
 double get_sampling_frequency(signal_t* signal);
+int get_sample_type(signal_t* signal);
 double* get_signal_array(signal_t* signal);
+double get_sample_value(signal_t* signal, int index);
+double get_spectrum_value(signal_t* signal, int index);
+void* get_signal_data(signal_t* signal);
 peak_list_t* get_peak_list(signal_t* signal);
 
-void set_window_type(signal_t* signal, unsigned char window_type);
+int sample_type_size(int sample_type);
+
+int set_window_type(signal_t* signal, FFTWindow window_type);
+int enable_twiddle_table(signal_t* signal, int enabled);
+int enable_const_tables(signal_t* signal, int enabled);
+int share_tables(signal_t* signal, signal_t* owner);
   
 void acquire(signal_t* signal, int channel, int removeBias);
 void add_sample(signal_t*, int sample);
 int is_buffer_full(signal_t*);
 
+int set_decimation(signal_t* signal, int factor);
+int get_decimation(signal_t* signal);
+
+int enable_streaming(signal_t* signal, int hop);
+int get_hop(signal_t* signal);
+void load_latest_frame(signal_t* signal);
+int load_latest_frame_from(signal_t* signal, signal_t* source);
+void schedule_frame(signal_t* signal, int samples);
+
 void compute_spectrum(signal_t* signal);
+int compute_spectra(signal_t** signals, int count);
+int compute_autocorrelation(signal_t* signal);
 int frequency_to_index(signal_t* signal, double frequency);
 double index_to_frequency(signal_t* signal, double index);
 
@@ -51,11 +108,23 @@ void remove_bias(signal_t* signal);
 void erase_signal(signal_t* signal);
 void erase_signal_at_peak(signal_t* signal, peak_t* peak);
 
+int set_peak_thresholds(signal_t* signal, double lowest_power, double highest_ratio, 
+                        double search_window);
 void compute_peak_list(signal_t* signal, double low_frequency, double high_frequency);
 peak_t find_highest_power(signal_t* signal, double low_frequency, double high_frequency);
 peak_t find_precise_peak(signal_t* signal, int index);
+
+int enable_refinement(signal_t* signal, int enabled);
+int is_refinement_enabled(signal_t* signal);
+double refine_frequency(signal_t* signal, double frequency);
 int find_peak_index(signal_t* signal, int low_index, int high_index); 
 
+void set_fundamental_estimator(signal_t* signal, int estimator);
+peak_t estimate_fundamental(signal_t* signal, double low_frequency, double high_frequency);
+peak_t find_harmonic_fundamental(signal_t* signal, double low_frequency, double high_frequency, 
+                                 int estimator);
+peak_t find_period_fundamental(signal_t* signal, double low_frequency, double high_frequency);
+
 void erase_array(double *array, int length);
 void erase_signal(signal_t* signal);
 void copy_array(double *dst, double* src, int length);
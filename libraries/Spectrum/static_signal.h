@@ -0,0 +1,128 @@
+/**
+ * static_signal.h
+ *
+ * Compile time sized signal: static storage (no heap) and constant
+ * bin/frequency conversions, usable with the signal_t functions
+ *
+ * Author: Vincent Lacasse (lacasse4@yahoo.com)
+ * Date: 2026-10-18
+ * Target system: Arduino Due
+ *
+ */
+
+/*
+ * A Signal holds the signal state, its arrays, its window and its peak
+ * list; create_signal_at() builds a signal_t in them.  Declared as a
+ * global, it never touches the heap and its memory shows in the sketch's
+ * static RAM usage at compile time:
+ *
+ *   Signal<1024, 4000, ZeroPad::On> tuner;
+ *
+ *   enable_streaming(tuner, 256);              // a Signal converts to signal_t*
+ *   compute_peak_list(tuner, 40, 900);
+ *
+ * The bin width and frequency/index conversions are constant expressions:
+ *
+ *   static_assert(decltype(tuner)::is_searchable(40, 900), "band out of the spectrum");
+ *   const int low_index = decltype(tuner)::frequency_to_index(40);
+ *
+ * Features enabled later (streaming, twiddle table, MPM, refinement) still
+ * allocate their buffers.  set_decimation() changes the sampling frequency:
+ * the constants do not follow it.
+ */
+
+#ifndef _STATIC_SIGNAL_H
+#define _STATIC_SIGNAL_H
+
+#include <stdint.h>
+#include "spectrum.h"
+#include "fixed_fft.h"
+
+enum class ZeroPad { Off, On };
+
+/*
+ * SAMPLE_xxx value of a sample type
+ */
+template <typename T> struct sample_type_of;
+template <> struct sample_type_of<double> { static constexpr int value = SAMPLE_DOUBLE; };
+template <> struct sample_type_of<float>  { static constexpr int value = SAMPLE_FLOAT; };
+template <> struct sample_type_of<q15_t>  { static constexpr int value = SAMPLE_Q15; };
+template <> struct sample_type_of<q31_t>  { static constexpr int value = SAMPLE_Q31; };
+
+/**
+ * @brief signal of N samples at Fs Hertz in static storage
+ * @param N signal length, a power of 2
+ * @param Fs sampling frequency in Hertz
+ * @param Padding FFT zero padding (see create_signal)
+ * @param Sample double, float, q15_t or q31_t
+ * @param RealFft real input FFT (no imaginary array)
+ */
+template <int N, unsigned long Fs, ZeroPad Padding = ZeroPad::On, typename Sample = double,
+          bool RealFft = false>
+class Signal {
+public:
+  static constexpr int length = N;
+  static constexpr int length_with_padding = Padding == ZeroPad::On ? 2 * N : N;
+  static constexpr double sampling_frequency = Fs;
+  static constexpr double bin_width = (double) Fs / length_with_padding;    // Hz
+
+  static_assert(N >= 4 && (N & (N - 1)) == 0, "the signal length must be a power of 2");
+  static_assert(Fs > 0, "the sampling frequency must be positive");
+
+  /**
+   * @brief spectrum array index of a (positive) frequency, see frequency_to_index()
+   */
+  static constexpr int frequency_to_index(double frequency)
+  {
+    return (int) (frequency / bin_width + 0.5);
+  }
+
+  /**
+   * @brief frequency of a spectrum array index, see index_to_frequency()
+   */
+  static constexpr double index_to_frequency(double index)
+  {
+    return index * bin_width;
+  }
+
+  /**
+   * @brief true if the peak search can cover [low_frequency, high_frequency]
+   * @details the bounds need a neighbour bin on each side (see find_highest_power)
+   */
+  static constexpr bool is_searchable(double low_frequency, double high_frequency)
+  {
+    return frequency_to_index(low_frequency) > 0 &&
+           frequency_to_index(high_frequency) < length - 1 &&
+           low_frequency < high_frequency;
+  }
+
+  Signal()
+  {
+    signal_storage_t storage = { state, real, RealFft ? NULL : imag, window, list };
+    signal = create_signal_at(&storage, N, sampling_frequency, Padding == ZeroPad::On,
+                              sample_type_of<Sample>::value, RealFft);
+  }
+
+  ~Signal() { delete_signal(signal); }
+
+  Signal(const Signal&) = delete;
+  Signal& operator=(const Signal&) = delete;
+
+  /**
+   * @brief the signal_t view, for the signal_t functions
+   */
+  signal_t* view() { return signal; }
+  operator signal_t*() { return signal; }
+
+  Sample* data() { return real; }
+
+private:
+  signal_t* signal;
+  alignas(8) uint8_t state[SIGNAL_STATE_SIZE];
+  alignas(8) uint8_t list[PEAK_LIST_STATE_SIZE];
+  Sample real[length_with_padding];
+  Sample imag[RealFft ? 1 : length_with_padding];
+  Sample window[N / 2];
+};
+
+#endif
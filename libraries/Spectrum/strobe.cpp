@@ -0,0 +1,208 @@
+/**
+ * strobe.cpp
+ *
+ * C module driving the strobe output: a square wave whose period and duty
+ * change at period boundaries only, through interchangeable backends
+ * (Due PWM, host mock)
+ *
+ * Author: Vincent Lacasse (lacasse4@yahoo.com)
+ * Date: 2026-10-18
+ * Target system: Arduino Due
+ *
+ */
+
+/*
+ * Stopping and restarting a PWM channel to change its frequency cuts the
+ * current period short: the strobe flickers at every update.  Here the
+ * output never stops.  The backend is given the next period and duty while
+ * the current period runs, and applies both at its end.
+ *
+ * The period is kept in counts of the backend's clock with
+ * STROBE_FRACTION_BITS more bits.  Every period, it glides toward the
+ * target period set by set_strobe() (first order, STROBE_GLIDE time
+ * constant), and its fraction goes to an accumulator: the backend gets
+ * the integer part, plus one count whenever the accumulator carries.  On
+ * average the output has the exact period: at 900 Hz and 1.3125 MHz
+ * (1458 counts), a count is 0.6 Hz, most of the 1 Hz strobe offset.
+ *
+ * The duty is a ratio of the period (16 bit fraction), so a frequency
+ * change keeps the LED intensity.  set_strobe() and the period interrupt
+ * share the target period and the duty ratio: each is a single aligned
+ * word, no critical zone is needed.
+ */
+
+#include <stdlib.h>
+#include <math.h>
+#include "strobe.h"
+
+#define FRACTION_MASK   ((1UL << STROBE_FRACTION_BITS) - 1)
+#define DUTY_ONE        65536UL      // duty ratio of 1
+
+struct strobe {
+    const strobe_backend_t* backend;
+    void* context;               // backend's own data
+    volatile uint32_t target;    // target period (counts, with fraction bits)
+    volatile uint32_t duty;      // duty ratio (16 bit fraction)
+    uint32_t period;             // current period (counts, with fraction bits)
+    uint32_t fraction;           // sub-count accumulator
+    uint32_t glide;              // glide time constant (counts), 0 for none
+    int running;
+};
+
+/**
+ * @brief period of 'frequency' in counts with fraction bits, 0 if out of range
+ */
+static uint32_t to_period(strobe_t* strobe, double frequency)
+{
+  if (frequency <= 0.0) return 0;
+
+  double period = ldexp(strobe->backend->clock / frequency, STROBE_FRACTION_BITS);
+  // the accumulator may add a count
+  if (period < ldexp(2.0, STROBE_FRACTION_BITS) ||
+      period > ldexp((double) strobe->backend->max_period - 2, STROBE_FRACTION_BITS)) {
+    return 0;
+  }
+  return (uint32_t) (period + 0.5);
+}
+
+/**
+ * @brief create a strobe output
+ * @param backend the backend producing the wave (due_pwm_backend or a mock)
+ * @param context backend's own data (NULL for due_pwm_backend)
+ * @returns the strobe, or NULL if out of memory
+ */
+strobe_t* create_strobe(const strobe_backend_t* backend, void* context)
+{
+  strobe_t* strobe = (strobe_t*) malloc(sizeof(strobe_t));
+  if (strobe == NULL) return NULL;
+
+  strobe->backend = backend;
+  strobe->context = context;
+  strobe->target = 0;
+  strobe->duty = 0;
+  strobe->period = 0;
+  strobe->fraction = 0;
+  strobe->running = 0;
+  set_strobe_glide(strobe, STROBE_GLIDE);
+  return strobe;
+}
+
+/**
+ * @brief stop the strobe and release its resources
+ */
+void delete_strobe(strobe_t* strobe)
+{
+  stop_strobe(strobe);
+  free(strobe);
+}
+
+/**
+ * @brief start the wave at 'frequency', with a duty of 0 (LEDs off)
+ * @returns 1 if OK, 0 if the frequency is out of range or if the backend failed to start
+ * @details the wave then runs until stop_strobe(): set_strobe() changes
+ * @details its frequency and duty without interrupting it.
+ */
+int start_strobe(strobe_t* strobe, double frequency)
+{
+  uint32_t period = to_period(strobe, frequency);
+  if (period == 0 || strobe->running) return 0;
+
+  strobe->target = period;
+  strobe->period = period;
+  strobe->duty = 0;
+  strobe->fraction = 0;
+  strobe->running = strobe->backend->start(strobe, period >> STROBE_FRACTION_BITS, 0);
+  return strobe->running;
+}
+
+/**
+ * @brief stop the wave
+ */
+void stop_strobe(strobe_t* strobe)
+{
+  if (!strobe->running) return;
+  strobe->running = 0;
+  strobe->backend->stop(strobe);
+}
+
+/**
+ * @brief set the frequency the wave glides to, and its duty
+ * @param duty ratio of the period, 0 (off) to 1
+ * @returns 1 if OK, 0 if the frequency is out of range (nothing changes)
+ * @details the change reaches the output within two periods; the
+ * @details frequency then glides with the STROBE_GLIDE time constant.
+ */
+int set_strobe(strobe_t* strobe, double frequency, double duty)
+{
+  uint32_t period = to_period(strobe, frequency);
+  if (period == 0) return 0;
+
+  if (duty < 0.0) duty = 0.0;
+  if (duty > 1.0) duty = 1.0;
+  strobe->target = period;
+  strobe->duty = (uint32_t) (duty * DUTY_ONE + 0.5);
+  return 1;
+}
+
+/**
+ * @brief set the glide time constant (STROBE_GLIDE by default)
+ * @param glide seconds, 0 to jump to the target frequency
+ * @returns 1 if OK, 0 if glide is negative
+ */
+int set_strobe_glide(strobe_t* strobe, double glide)
+{
+  if (glide < 0.0) return 0;
+  strobe->glide = (uint32_t) (glide * strobe->backend->clock + 0.5);
+  return 1;
+}
+
+/**
+ * @brief return the current frequency of the wave (it may be gliding)
+ */
+double get_strobe_frequency(strobe_t* strobe)
+{
+  if (strobe->period == 0) return 0.0;
+  return strobe->backend->clock / ldexp((double) strobe->period, -STROBE_FRACTION_BITS);
+}
+
+/**
+ * @brief return the lowest frequency the backend can produce
+ */
+double get_min_strobe_frequency(strobe_t* strobe)
+{
+  return strobe->backend->clock / (strobe->backend->max_period - 2);
+}
+
+/**
+ * @brief backend's own data (backend side)
+ */
+void* get_strobe_context(strobe_t* strobe)
+{
+  return strobe->context;
+}
+
+/**
+ * @brief a period ended: give the backend the period after the next one (backend side)
+ * @details called from the backend's interrupt handler, once per period
+ */
+void strobe_period_elapsed(strobe_t* strobe)
+{
+  if (!strobe->running) return;
+
+  // glide: the step is the distance over the time constant, times the period
+  int32_t distance = (int32_t) (strobe->target - strobe->period);
+  int32_t step = distance;
+  if (strobe->glide > 0) {
+    step = (int32_t) ((int64_t) distance * (strobe->period >> STROBE_FRACTION_BITS) / strobe->glide);
+    if (step == 0 && distance != 0) step = distance > 0 ? 1 : -1;
+  }
+  strobe->period += step;
+
+  // the fraction carries into a count now and then
+  strobe->fraction += strobe->period & FRACTION_MASK;
+  uint32_t counts = (strobe->period >> STROBE_FRACTION_BITS) + (strobe->fraction >> STROBE_FRACTION_BITS);
+  strobe->fraction &= FRACTION_MASK;
+
+  uint32_t duty = (uint32_t) (((uint64_t) counts * strobe->duty) >> 16);
+  strobe->backend->update(strobe, counts, duty);
+}
@@ -0,0 +1,57 @@
+/**
+ * strobe.h
+ *
+ * C module driving the strobe output: a square wave whose period and duty
+ * change at period boundaries only, through interchangeable backends
+ * (Due PWM, host mock)
+ *
+ * Author: Vincent Lacasse (lacasse4@yahoo.com)
+ * Date: 2026-10-18
+ * Target system: Arduino Due
+ *
+ */
+
+#ifndef _STROBE_H
+#define _STROBE_H
+
+#include <stdint.h>
+
+#define STROBE_FRACTION_BITS  8       // sub-count bits of the period
+#define STROBE_GLIDE          0.05    // frequency glide time constant (s)
+
+typedef struct strobe strobe_t;
+
+/*
+ * A backend outputs periods of 'period' counts of its clock, high for
+ * 'duty' counts.  update() gives the period after the current one: the
+ * backend applies period and duty together, at the end of the current
+ * period, then calls strobe_period_elapsed() (from its interrupt handler).
+ */
+typedef struct strobe_backend {
+    const char* name;
+    double clock;                                // counts per second
+    uint32_t max_period;                         // longest period (counts)
+    int (*start)(strobe_t* strobe, uint32_t period, uint32_t duty);   // returns 1 if OK, 0 on failure
+    void (*stop)(strobe_t* strobe);
+    void (*update)(strobe_t* strobe, uint32_t period, uint32_t duty);
+} strobe_backend_t;
+
+#if defined(ARDUINO_ARCH_SAM)
+extern const strobe_backend_t due_pwm_backend;
+#endif
+
+strobe_t* create_strobe(const strobe_backend_t* backend, void* context);
+void delete_strobe(strobe_t* strobe);
+
+int start_strobe(strobe_t* strobe, double frequency);
+void stop_strobe(strobe_t* strobe);
+int set_strobe(strobe_t* strobe, double frequency, double duty);
+int set_strobe_glide(strobe_t* strobe, double glide);
+double get_strobe_frequency(strobe_t* strobe);
+double get_min_strobe_frequency(strobe_t* strobe);
+
+// backend side
+void* get_strobe_context(strobe_t* strobe);
+void strobe_period_elapsed(strobe_t* strobe);
+
+#endif
@@ -0,0 +1,75 @@
+/**
+ * tables.cpp
+ * 
+ * C module building the window and twiddle factor tables of a signal
+ * 
+ * Author: Vincent Lacasse (lacasse4@yahoo.com)
+ * Date: 2026-10-18
+ * Target system: Arduino Due
+ * 
+ */
+
+/*
+ * Tables hold values of the signal's sample type (Q15 and Q31 tables hold 
+ * fixed point values).  Windows are symmetric, only the first half is kept.
+ * Sine tables cover a quarter wave: sine[m] = sin(2*pi*m/period) for m in 
+ * [0, period/4].  See fft_core.h.
+ *
+ * const versions of the most used tables are in const_tables.cpp.
+ */
+
+#include <stdlib.h>
+#include <math.h>
+#include "tables.h"
+#include "spectrum.h"
+#include "fixed_fft.h"
+#include "fft_core.h"
+#include "window.h"
+
+template <typename M, typename T>
+static void fill_window(T* table, FFTWindow window_type, int length)
+{
+  for (int i = 0; i < (length >> 1); i++) {
+    table[i] = (T) M::coefficient(window_weight(window_type, i, length));
+  }
+}
+
+template <typename M, typename T>
+static void fill_sine(T* table, int period)
+{
+  for (int m = 0; m <= (period >> 2); m++) {
+    table[m] = (T) M::coefficient(sin(2.0 * M_PI * m / period));
+  }
+}
+
+/**
+ * @brief fill a table with the first half of a window
+ * @param table length/2 values of type sample_type
+ */
+void fill_window_table(void* table, int sample_type, FFTWindow window_type, int length)
+{
+  switch (sample_type) {
+    case SAMPLE_DOUBLE: fill_window<floating_math<double> >((double*) table, window_type, length); break;
+    case SAMPLE_FLOAT:  fill_window<floating_math<float> >((float*) table, window_type, length);   break;
+    case SAMPLE_Q15:    fill_window<q15_math>((q15_t*) table, window_type, length);                break;
+    case SAMPLE_Q31:    fill_window<q31_math>((q31_t*) table, window_type, length);                break;
+  }
+}
+
+/**
+ * @brief allocate and fill a quarter wave sine table
+ * @returns the table or NULL if out of memory
+ */
+void* create_sine_table(int sample_type, int period)
+{
+  void* table = malloc(((period >> 2) + 1) * sample_type_size(sample_type));
+  if (table == NULL) return NULL;
+
+  switch (sample_type) {
+    case SAMPLE_DOUBLE: fill_sine<floating_math<double> >((double*) table, period); break;
+    case SAMPLE_FLOAT:  fill_sine<floating_math<float> >((float*) table, period);   break;
+    case SAMPLE_Q15:    fill_sine<q15_math>((q15_t*) table, period);                break;
+    case SAMPLE_Q31:    fill_sine<q31_math>((q31_t*) table, period);                break;
+  }
+  return table;
+}
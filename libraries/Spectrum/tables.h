@@ -0,0 +1,25 @@
+/**
+ * tables.h
+ * 
+ * C module building the window and twiddle factor tables of a signal
+ * 
+ * Author: Vincent Lacasse (lacasse4@yahoo.com)
+ * Date: 2026-10-18
+ * Target system: Arduino Due
+ * 
+ */
+
+#ifndef _TABLES_H
+#define _TABLES_H
+
+#include "arduinoFFT.h"
+
+#define CONST_SINE_PERIOD     4096    // period of the const (flash) sine tables
+
+void fill_window_table(void* table, int sample_type, FFTWindow window_type, int length);
+void* create_sine_table(int sample_type, int period);
+
+const void* find_const_window_table(int sample_type, FFTWindow window_type, int length);
+const void* find_const_sine_table(int sample_type);
+
+#endif
@@ -0,0 +1,359 @@
+/**
+ * telemetry.cpp
+ *
+ * C module sending pitch results, peak lists, frames and spectra as
+ * COBS framed binary records, through a non-blocking transmit queue
+ *
+ * Author: Vincent Lacasse (lacasse4@yahoo.com)
+ * Date: 2026-10-18
+ * Target system: Arduino Due
+ *
+ */
+
+/*
+ * A record is a header (type, 16 bit sequence number, micros() at the
+ * time it was queued), a payload and a CRC-16/CCITT-FALSE of both.
+ * Numbers are little endian, reals are 32 bit floats.  The record is COBS
+ * encoded (Consistent Overhead Byte Stuffing: no 0 byte inside, one byte
+ * of overhead per 254 bytes) and followed by a 0 byte: a receiver finds
+ * the next record after any lost or corrupted byte.
+ *
+ * Payloads:
+ *   PITCH     frequency, power, confidence (float), peaks (u16), dropped blocks (u32)
+ *   PEAKS     count (u8), then index (u16), frequency, power (float) per peak
+ *   FRAME     start (s), step (s), scale (float), count (u16), values (i16)
+ *   SPECTRUM  start (Hz), step (Hz), scale (float), count (u16), values (i16)
+ *   TEXT      characters, without the terminating 0
+ * A FRAME or SPECTRUM value is round(x * scale): the largest magnitude of
+ * the array is scaled to 32767, the receiver divides by scale.
+ *
+ * Records are encoded directly in the transmit queue, a ring of bytes.
+ * A record that does not fit in the free space is dropped whole (its
+ * sequence number is used: the receiver sees the gap).  The loop never
+ * waits for the link: service_telemetry() hands the writer what it can
+ * take at once (for a serial port: its transmit buffer space).
+ *
+ * As with the sample queue (sample_queue.cpp), the loop (producer) only
+ * writes 'head' and the writer side (consumer) only writes 'tail', with
+ * release stores and acquire loads: service_telemetry() may run from an
+ * interrupt handler.  A record becomes visible once complete.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <Arduino.h>
+#include "telemetry.h"
+
+struct telemetry {
+    uint8_t* buffer;             // transmit queue
+    uint32_t mask;               // queue size - 1 (size is a power of two)
+    uint32_t head;               // end of the complete records (producer only)
+    uint32_t tail;               // next byte to write (consumer only)
+    telemetry_write_t write;     // link writer
+    void* context;               // writer's own data
+
+    uint16_t sequence;           // sequence number of the next record
+    uint32_t sent;               // records queued
+    uint32_t dropped;            // records dropped on a full queue
+
+    uint32_t cursor;             // record being encoded: next byte
+    uint32_t code_at;            // record being encoded: COBS code byte of the current block
+    uint8_t code;                // record being encoded: COBS code (block length + 1)
+    uint16_t crc;                // record being encoded: CRC so far
+};
+
+/**
+ * @brief create a telemetry stream
+ * @param size transmit queue size in bytes (rounded up to a power of two)
+ * @param write writer taking bytes without blocking (see telemetry_write_t)
+ * @param context passed to the writer
+ * @returns the stream, or NULL if out of memory
+ * @details a record takes its payload plus 10 bytes and 1 per 254 bytes:
+ * @details the queue must hold the largest record sent (a 1024 point
+ * @details frame or spectrum takes 2071 bytes)
+ */
+telemetry_t* create_telemetry(int size, telemetry_write_t write, void* context)
+{
+  uint32_t capacity = 64;
+
+  if (size <= 0 || write == NULL) return NULL;
+  while (capacity < (uint32_t) size) capacity <<= 1;
+
+  telemetry_t* telemetry = (telemetry_t*) malloc(sizeof(telemetry_t));
+  if (telemetry == NULL) return NULL;
+
+  telemetry->buffer = (uint8_t*) malloc(capacity);
+  if (telemetry->buffer == NULL) {
+    free(telemetry);
+    return NULL;
+  }
+
+  telemetry->mask = capacity - 1;
+  telemetry->head = 0;
+  telemetry->tail = 0;
+  telemetry->write = write;
+  telemetry->context = context;
+  telemetry->sequence = 0;
+  telemetry->sent = 0;
+  telemetry->dropped = 0;
+  return telemetry;
+}
+
+/**
+ * @brief release telemetry resources
+ */
+void delete_telemetry(telemetry_t* telemetry)
+{
+  free(telemetry->buffer);
+  free(telemetry);
+}
+
+/**
+ * @brief getters
+ */
+uint32_t get_sent_records(telemetry_t* telemetry)    { return telemetry->sent; }
+uint32_t get_dropped_records(telemetry_t* telemetry) { return telemetry->dropped; }
+
+/**
+ * @brief return the number of bytes waiting for the link
+ */
+int pending_telemetry(telemetry_t* telemetry)
+{
+  return __atomic_load_n(&telemetry->head, __ATOMIC_RELAXED) -
+         __atomic_load_n(&telemetry->tail, __ATOMIC_ACQUIRE);
+}
+
+/**
+ * @brief append an encoded byte to the record
+ */
+static inline void put_encoded(telemetry_t* telemetry, uint8_t byte)
+{
+  if (byte == 0) {
+    telemetry->buffer[telemetry->code_at & telemetry->mask] = telemetry->code;
+    telemetry->code_at = telemetry->cursor++;
+    telemetry->code = 1;
+    return;
+  }
+
+  telemetry->buffer[telemetry->cursor++ & telemetry->mask] = byte;
+  if (++telemetry->code == 0xFF) {
+    telemetry->buffer[telemetry->code_at & telemetry->mask] = telemetry->code;
+    telemetry->code_at = telemetry->cursor++;
+    telemetry->code = 1;
+  }
+}
+
+/**
+ * @brief append a byte to the record, updating its CRC
+ */
+static void put_byte(telemetry_t* telemetry, uint8_t byte)
+{
+  uint16_t crc = telemetry->crc ^ (byte << 8);
+
+  for (int i = 0; i < 8; i++) {
+    crc = crc & 0x8000 ? (crc << 1) ^ 0x1021 : crc << 1;
+  }
+  telemetry->crc = crc;
+  put_encoded(telemetry, byte);
+}
+
+static void put_u16(telemetry_t* telemetry, uint16_t value)
+{
+  put_byte(telemetry, value);
+  put_byte(telemetry, value >> 8);
+}
+
+static void put_u32(telemetry_t* telemetry, uint32_t value)
+{
+  put_u16(telemetry, value);
+  put_u16(telemetry, value >> 16);
+}
+
+static void put_float(telemetry_t* telemetry, double value)
+{
+  float real = value;
+  uint32_t bits;
+
+  memcpy(&bits, &real, sizeof(bits));
+  put_u32(telemetry, bits);
+}
+
+/**
+ * @brief start a record of 'length' payload bytes
+ * @returns 1 if OK, 0 if it does not fit in the queue (the record is dropped)
+ */
+static int begin_record(telemetry_t* telemetry, int type, int length)
+{
+  uint32_t raw = TELEMETRY_HEADER + length + TELEMETRY_CRC;
+  uint32_t encoded = raw + raw / 254 + 2;      // code bytes and the delimiter
+  uint32_t head = telemetry->head;
+  uint32_t used = head - __atomic_load_n(&telemetry->tail, __ATOMIC_ACQUIRE);
+
+  if (encoded > telemetry->mask + 1 - used) {
+    telemetry->sequence++;
+    telemetry->dropped++;
+    return 0;
+  }
+
+  telemetry->code_at = head;
+  telemetry->cursor = head + 1;
+  telemetry->code = 1;
+  telemetry->crc = 0xFFFF;
+
+  put_byte(telemetry, type);
+  put_u16(telemetry, telemetry->sequence++);
+  put_u32(telemetry, micros());
+  return 1;
+}
+
+/**
+ * @brief append the CRC and the delimiter, then hand the record to the link
+ */
+static void end_record(telemetry_t* telemetry)
+{
+  uint16_t crc = telemetry->crc;
+
+  put_encoded(telemetry, crc);
+  put_encoded(telemetry, crc >> 8);
+  telemetry->buffer[telemetry->code_at & telemetry->mask] = telemetry->code;
+  telemetry->buffer[telemetry->cursor++ & telemetry->mask] = 0;
+
+  __atomic_store_n(&telemetry->head, telemetry->cursor, __ATOMIC_RELEASE);
+  telemetry->sent++;
+}
+
+/**
+ * @brief queue the fundamental frequency found in a frame
+ * @param peaks number of peaks in the peak list
+ * @param dropped blocks dropped by the acquisition so far
+ * @returns 1 if OK, 0 if the queue was full (the record is dropped)
+ */
+int send_pitch(telemetry_t* telemetry, peak_t* fundamental, int peaks, uint32_t dropped)
+{
+  if (!begin_record(telemetry, TELEMETRY_PITCH, 18)) return 0;
+
+  put_float(telemetry, fundamental->frequency);
+  put_float(telemetry, fundamental->power);
+  put_float(telemetry, fundamental->confidence);
+  put_u16(telemetry, peaks);
+  put_u32(telemetry, dropped);
+  end_record(telemetry);
+  return 1;
+}
+
+/**
+ * @brief queue the peaks of a peak list
+ * @returns 1 if OK, 0 if the queue was full (the record is dropped)
+ */
+int send_peak_list(telemetry_t* telemetry, peak_list_t* peak_list)
+{
+  int count = list_size(peak_list);
+
+  if (count > 255) count = 255;
+  if (!begin_record(telemetry, TELEMETRY_PEAKS, 1 + 10 * count)) return 0;
+
+  put_byte(telemetry, count);
+  for (int i = 0; i < count; i++) {
+    peak_t peak = get_peak(peak_list, i);
+    put_u16(telemetry, peak.index);
+    put_float(telemetry, peak.frequency);
+    put_float(telemetry, peak.power);
+  }
+  end_record(telemetry);
+  return 1;
+}
+
+/**
+ * @brief queue an array of the signal as 16 bit values with a scale
+ */
+static int send_array(telemetry_t* telemetry, signal_t* signal, int type, double step, int count,
+                      double (*get)(signal_t* signal, int index))
+{
+  double largest = 0.0;
+
+  for (int i = 0; i < count; i++) {
+    double value = fabs(get(signal, i));
+    if (value > largest) largest = value;
+  }
+  double scale = largest > 0.0 ? 32767.0 / largest : 1.0;
+
+  if (!begin_record(telemetry, type, 14 + 2 * count)) return 0;
+
+  put_float(telemetry, 0.0);
+  put_float(telemetry, step);
+  put_float(telemetry, scale);
+  put_u16(telemetry, count);
+  for (int i = 0; i < count; i++) {
+    put_u16(telemetry, (int16_t) lround(get(signal, i) * scale));
+  }
+  end_record(telemetry);
+  return 1;
+}
+
+/**
+ * @brief queue the signal's time domain frame ('length' samples)
+ * @returns 1 if OK, 0 if the queue was full (the record is dropped)
+ * @details call before compute_spectrum(), which overwrites the frame
+ */
+int send_frame(telemetry_t* telemetry, signal_t* signal)
+{
+  return send_array(telemetry, signal, TELEMETRY_FRAME, 1.0 / get_sampling_frequency(signal),
+                    get_length(signal), get_sample_value);
+}
+
+/**
+ * @brief queue the signal's spectrum (half the padded length, from 0 Hz)
+ * @returns 1 if OK, 0 if the queue was full (the record is dropped)
+ * @details call after compute_spectrum()
+ */
+int send_spectrum(telemetry_t* telemetry, signal_t* signal)
+{
+  return send_array(telemetry, signal, TELEMETRY_SPECTRUM, index_to_frequency(signal, 1.0),
+                    get_length_with_padding(signal) / 2, get_spectrum_value);
+}
+
+/**
+ * @brief queue a line of text (at most TELEMETRY_MAX_TEXT characters)
+ * @returns 1 if OK, 0 if the queue was full (the record is dropped)
+ */
+int send_text(telemetry_t* telemetry, const char* text)
+{
+  int length = strlen(text);
+
+  if (length > TELEMETRY_MAX_TEXT) length = TELEMETRY_MAX_TEXT;
+  if (!begin_record(telemetry, TELEMETRY_TEXT, length)) return 0;
+
+  for (int i = 0; i < length; i++) {
+    put_byte(telemetry, text[i]);
+  }
+  end_record(telemetry);
+  return 1;
+}
+
+/**
+ * @brief give the link as many queued bytes as it takes without blocking
+ * @returns the number of bytes written
+ * @details call often (every loop) or from the link's transmit interrupt
+ */
+int service_telemetry(telemetry_t* telemetry)
+{
+  uint32_t head = __atomic_load_n(&telemetry->head, __ATOMIC_ACQUIRE);
+  uint32_t tail = telemetry->tail;
+  int total = 0;
+
+  while (tail != head) {
+    uint32_t index = tail & telemetry->mask;
+    uint32_t chunk = head - tail;
+    if (chunk > telemetry->mask + 1 - index) chunk = telemetry->mask + 1 - index;
+
+    int written = telemetry->write(telemetry->context, telemetry->buffer + index, chunk);
+    if (written <= 0) break;
+
+    tail += written;
+    total += written;
+    __atomic_store_n(&telemetry->tail, tail, __ATOMIC_RELEASE);
+    if ((uint32_t) written < chunk) break;
+  }
+  return total;
+}
@@ -0,0 +1,54 @@
+/**
+ * telemetry.h
+ *
+ * C module sending pitch results, peak lists, frames and spectra as
+ * COBS framed binary records, through a non-blocking transmit queue
+ *
+ * Author: Vincent Lacasse (lacasse4@yahoo.com)
+ * Date: 2026-10-18
+ * Target system: Arduino Due
+ *
+ */
+
+#ifndef _TELEMETRY_H
+#define _TELEMETRY_H
+
+#include <stdint.h>
+#include "spectrum.h"
+#include "peak.h"
+#include "peak_list.h"
+
+// record types
+#define TELEMETRY_PITCH      1    // fundamental frequency, power, confidence, peaks, dropped blocks
+#define TELEMETRY_PEAKS      2    // peak list: index, frequency and power of each peak
+#define TELEMETRY_FRAME      3    // time domain frame (16 bit values with a scale)
+#define TELEMETRY_SPECTRUM   4    // spectrum magnitude (16 bit values with a scale)
+#define TELEMETRY_TEXT       5    // a line of text (profile, messages)
+
+#define TELEMETRY_HEADER     7    // type (1), sequence (2), time in us (4)
+#define TELEMETRY_CRC        2    // CRC-16/CCITT-FALSE of the header and payload
+#define TELEMETRY_MAX_TEXT   200  // longest line of text
+
+/**
+ * @brief writes up to 'length' bytes without blocking
+ * @returns the number of bytes written (0 when the link is busy)
+ */
+typedef int (*telemetry_write_t)(void* context, const uint8_t* data, int length);
+
+typedef struct telemetry telemetry_t;
+
+telemetry_t* create_telemetry(int size, telemetry_write_t write, void* context);
+void delete_telemetry(telemetry_t* telemetry);
+
+int send_pitch(telemetry_t* telemetry, peak_t* fundamental, int peaks, uint32_t dropped);
+int send_peak_list(telemetry_t* telemetry, peak_list_t* peak_list);
+int send_frame(telemetry_t* telemetry, signal_t* signal);
+int send_spectrum(telemetry_t* telemetry, signal_t* signal);
+int send_text(telemetry_t* telemetry, const char* text);
+
+int service_telemetry(telemetry_t* telemetry);
+int pending_telemetry(telemetry_t* telemetry);
+uint32_t get_sent_records(telemetry_t* telemetry);
+uint32_t get_dropped_records(telemetry_t* telemetry);
+
+#endif
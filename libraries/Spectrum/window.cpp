@@ -0,0 +1,53 @@
+/**
+ * window.cpp
+ * 
+ * C module computing FFT window weighing factors
+ * 
+ * Author: Vincent Lacasse (lacasse4@yahoo.com)
+ * Date: 2026-10-18
+ * Target system: Arduino Due
+ * 
+ */
+
+#include <math.h>
+#include "window.h"
+
+/**
+ * @brief return the weighing factor of a window at index
+ * @param window_type window type from arduinoFFT lib
+ * @param index sample index (0 to length-1)
+ * @param length window length
+ * @details factors are the same as arduinoFFT::windowing() so that every 
+ * @details sample type produces the same spectrum
+ */
+double window_weight(FFTWindow window_type, int index, int length)
+{
+  double last = length - 1.0;
+  double ratio = index / last;
+
+  switch (window_type) {
+    case FFTWindow::Hamming:
+      return 0.54 - (0.46 * cos(twoPi * ratio));
+    case FFTWindow::Hann:
+      return 0.54 * (1.0 - cos(twoPi * ratio));
+    case FFTWindow::Triangle:
+      return 1.0 - ((2.0 * fabs(index - (last / 2.0))) / last);
+    case FFTWindow::Nuttall:
+      return 0.355768 - (0.487396 * cos(twoPi * ratio)) +
+             (0.144232 * cos(fourPi * ratio)) - (0.012604 * cos(sixPi * ratio));
+    case FFTWindow::Blackman:
+      return 0.42323 - (0.49755 * cos(twoPi * ratio)) + (0.07922 * cos(fourPi * ratio));
+    case FFTWindow::Blackman_Nuttall:
+      return 0.3635819 - (0.4891775 * cos(twoPi * ratio)) +
+             (0.1365995 * cos(fourPi * ratio)) - (0.0106411 * cos(sixPi * ratio));
+    case FFTWindow::Blackman_Harris:
+      return 0.35875 - (0.48829 * cos(twoPi * ratio)) +
+             (0.14128 * cos(fourPi * ratio)) - (0.01168 * cos(sixPi * ratio));
+    case FFTWindow::Flat_top:
+      return 0.2810639 - (0.5208972 * cos(twoPi * ratio)) + (0.1980399 * cos(fourPi * ratio));
+    case FFTWindow::Welch:
+      return 1.0 - sq((index - last / 2.0) / (last / 2.0));
+    default:
+      return 1.0;
+  }
+}
@@ -0,0 +1,19 @@
+/**
+ * window.h
+ * 
+ * C module computing FFT window weighing factors
+ * 
+ * Author: Vincent Lacasse (lacasse4@yahoo.com)
+ * Date: 2026-10-18
+ * Target system: Arduino Due
+ * 
+ */
+
+#ifndef _WINDOW_H
+#define _WINDOW_H
+
+#include "arduinoFFT.h"
+
+double window_weight(FFTWindow window_type, int index, int length);
+
+#endif